@@ -38,5 +38,290 @@
 #ifndef CY_ETH_USER_CONFIG
 #define CY_ETH_USER_CONFIG
 
+/******************************************************
+ *       Buffer descriptor and buffer configuration
+ ******************************************************/
+/*
+ * Depth of each receive and transmit buffer descriptor ring. The Ethernet PDL driver sizes the ring of
+ * every enabled queue on every interface with these values. Each Rx descriptor holds one receive buffer from
+ * the network stack (a PBUF_POOL_BUFSIZE pbuf with lwIP); each Tx descriptor holds one transmit buffer of
+ * CY_ETH_SIZE_MAX_FRAME bytes owned by the Ethernet PDL driver.
+ * Deeper rings tolerate longer bursts at the cost of RAM; see cy_ecm_get_memory_usage().
+ */
+#ifndef CY_ECM_RX_BD_PER_QUEUE
+#if defined(CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE)
+#define CY_ECM_RX_BD_PER_QUEUE                CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE
+#else
+#define CY_ECM_RX_BD_PER_QUEUE                (4u)
+#endif
+#endif
+
+#ifndef CY_ECM_TX_BD_PER_QUEUE
+#if defined(CY_ETH_DEFINE_TOTAL_BD_PER_TXQUEUE)
+#define CY_ECM_TX_BD_PER_QUEUE                CY_ETH_DEFINE_TOTAL_BD_PER_TXQUEUE
+#else
+#define CY_ECM_TX_BD_PER_QUEUE                (4u)
+#endif
+#endif
+
+#ifndef CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE
+#define CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE    CY_ECM_RX_BD_PER_QUEUE
+#endif
+
+#ifndef CY_ETH_DEFINE_TOTAL_BD_PER_TXQUEUE
+#define CY_ETH_DEFINE_TOTAL_BD_PER_TXQUEUE    CY_ECM_TX_BD_PER_QUEUE
+#endif
+
+/*
+ * Per-interface queue enablement. Queue 0 is always enabled. Additional Rx queues are filled with
+ * receive buffers by ECM and only receive frames once frames are steered to them.
+ */
+#ifndef CY_ECM_ETH0_RXQ1_ENABLE
+#define CY_ECM_ETH0_RXQ1_ENABLE               (0u)
+#endif
+#ifndef CY_ECM_ETH0_RXQ2_ENABLE
+#define CY_ECM_ETH0_RXQ2_ENABLE               (0u)
+#endif
+#ifndef CY_ECM_ETH0_TXQ1_ENABLE
+#define CY_ECM_ETH0_TXQ1_ENABLE               (0u)
+#endif
+#ifndef CY_ECM_ETH0_TXQ2_ENABLE
+#define CY_ECM_ETH0_TXQ2_ENABLE               (0u)
+#endif
+
+#ifndef CY_ECM_ETH1_RXQ1_ENABLE
+#define CY_ECM_ETH1_RXQ1_ENABLE               (0u)
+#endif
+#ifndef CY_ECM_ETH1_RXQ2_ENABLE
+#define CY_ECM_ETH1_RXQ2_ENABLE               (0u)
+#endif
+#ifndef CY_ECM_ETH1_TXQ1_ENABLE
+#define CY_ECM_ETH1_TXQ1_ENABLE               (0u)
+#endif
+#ifndef CY_ECM_ETH1_TXQ2_ENABLE
+#define CY_ECM_ETH1_TXQ2_ENABLE               (0u)
+#endif
+
+/******************************************************
+ *               DMA buffer placement
+ ******************************************************/
+/* Placement options of the Ethernet DMA buffers and descriptors */
+#define CY_ECM_DMA_PLACEMENT_CACHEABLE        (0u)   /* Cacheable SRAM; ECM cleans and invalidates every receive buffer */
+#define CY_ECM_DMA_PLACEMENT_NONCACHEABLE     (1u)   /* SRAM region configured as non-cacheable by the MPU */
+#define CY_ECM_DMA_PLACEMENT_DTCM             (2u)   /* CM7 data TCM, which is never cached */
+
+#ifndef CY_ECM_DMA_BUFFER_PLACEMENT
+#define CY_ECM_DMA_BUFFER_PLACEMENT           CY_ECM_DMA_PLACEMENT_CACHEABLE
+#endif
+
+/* Linker section of the DMA memory for the non-cacheable and DTCM placements; the linker script must map it to the matching region */
+#ifndef CY_ECM_DMA_BUFFER_SECTION
+#define CY_ECM_DMA_BUFFER_SECTION             ".cy_ecm_dma_buffers"
+#endif
+
+/* Alignment of the DMA memory; the CM7 D-cache line size */
+#ifndef CY_ECM_DMA_BUFFER_ALIGNMENT
+#define CY_ECM_DMA_BUFFER_ALIGNMENT           (32u)
+#endif
+
+/******************************************************
+ *                     MDIO
+ ******************************************************/
+/*
+ * MDC clock. By default, ECM reads the frequency of the peripheral clock at initialization and selects the smallest
+ * divider that keeps MDC at or below CY_ECM_MDC_MAX_FREQUENCY_HZ. Define CY_ECM_MDC_SOURCE_CLOCK_HZ if the MAC is clocked
+ * from another source, or CY_ECM_MDC_DIVIDER to a cy_en_ethif_mdc_div_t value to bypass the selection.
+ */
+#ifndef CY_ECM_MDC_MAX_FREQUENCY_HZ
+#define CY_ECM_MDC_MAX_FREQUENCY_HZ           (2500000u)    /* IEEE 802.3 clause 22 limit */
+#endif
+
+/* Time a blocking MDIO access waits for the management frame interrupt; a frame takes 64 MDC cycles */
+#ifndef CY_ECM_MDIO_TIMEOUT_MS
+#define CY_ECM_MDIO_TIMEOUT_MS                (10u)
+#endif
+
+/*
+ * MDIO bus of each interface: the interface whose Ethernet MAC drives the MDC/MDIO pins of the PHY (0 for ETH0, 1 for ETH1).
+ * When the PHYs of both interfaces share the bus of ETH0, set CY_ECM_ETH1_MDIO_BUS to 0; ETH0 must then be initialized
+ * before ETH1 and deinitialized after it.
+ */
+#ifndef CY_ECM_ETH0_MDIO_BUS
+#define CY_ECM_ETH0_MDIO_BUS                  (0u)
+#endif
+
+#ifndef CY_ECM_ETH1_MDIO_BUS
+#define CY_ECM_ETH1_MDIO_BUS                  (1u)
+#endif
+
+/******************************************************
+ *                Generic PHY driver
+ ******************************************************/
+/* PHY address used by cy_ecm_phy_generic_callbacks unless cy_ecm_phy_generic_set_config is called; 0xFF (CY_ECM_PHY_ADDR_ANY) uses the PHY found by the MDIO bus scan */
+#ifndef CY_ECM_PHY_GENERIC_DEFAULT_ADDR
+#define CY_ECM_PHY_GENERIC_DEFAULT_ADDR       (0xFFu)
+#endif
+
+/* Time allowed for the PHY to clear the BMCR reset bit; IEEE 802.3 allows 0.5 s */
+#ifndef CY_ECM_PHY_RESET_TIMEOUT_MS
+#define CY_ECM_PHY_RESET_TIMEOUT_MS           (500u)
+#endif
+
+/******************************************************
+ *                  Link recovery
+ ******************************************************/
+/* Time allowed after link up for traffic to resume on a connected interface before the recovery is counted as timed out */
+#ifndef CY_ECM_NETWORK_RECOVERY_TIMEOUT_MS
+#define CY_ECM_NETWORK_RECOVERY_TIMEOUT_MS    (10000u)
+#endif
+
+/******************************************************
+ *                  Link quality
+ ******************************************************/
+/* Interval at which the error counters of a link that is up are sampled */
+#ifndef CY_ECM_LINK_QUALITY_INTERVAL_MS
+#define CY_ECM_LINK_QUALITY_INTERVAL_MS           (1000u)
+#endif
+
+/* Error rate, in errors per million frames, at which a sample scores 0; lower rates score linearly up to 100 */
+#ifndef CY_ECM_LINK_QUALITY_ERROR_FULL_SCALE_PPM
+#define CY_ECM_LINK_QUALITY_ERROR_FULL_SCALE_PPM  (10000u)
+#endif
+
+/* Each sample moves the rolling score by 1/N of its difference to the sample */
+#ifndef CY_ECM_LINK_QUALITY_SMOOTHING
+#define CY_ECM_LINK_QUALITY_SMOOTHING             (8u)
+#endif
+
+/* Scores below the degraded threshold raise CY_ECM_EVENT_LINK_DEGRADED; CY_ECM_EVENT_LINK_QUALITY_RESTORED follows at the restored threshold */
+#ifndef CY_ECM_LINK_QUALITY_DEGRADED_THRESHOLD
+#define CY_ECM_LINK_QUALITY_DEGRADED_THRESHOLD    (70u)
+#endif
+
+#ifndef CY_ECM_LINK_QUALITY_RESTORED_THRESHOLD
+#define CY_ECM_LINK_QUALITY_RESTORED_THRESHOLD    (85u)
+#endif
+
+/******************************************************
+ *                  Duplex mismatch
+ ******************************************************/
+/* Interval at which the late collision and retry limit counters of a link that is up are sampled */
+#ifndef CY_ECM_DUPLEX_MISMATCH_INTERVAL_MS
+#define CY_ECM_DUPLEX_MISMATCH_INTERVAL_MS        (1000u)
+#endif
+
+/* Late collisions plus retry limit errors in one interval that indicate a duplex mismatch */
+#ifndef CY_ECM_DUPLEX_MISMATCH_THRESHOLD
+#define CY_ECM_DUPLEX_MISMATCH_THRESHOLD          (4u)
+#endif
+
+/******************************************************
+ *                  Tx error recovery
+ ******************************************************/
+/* Interval at which the Tx underrun counter is sampled */
+#ifndef CY_ECM_TX_UNDERRUN_INTERVAL_MS
+#define CY_ECM_TX_UNDERRUN_INTERVAL_MS            (1000u)
+#endif
+
+/* Underruns in one interval after which the Tx DMA falls back to a more conservative setting */
+#ifndef CY_ECM_TX_UNDERRUN_THRESHOLD
+#define CY_ECM_TX_UNDERRUN_THRESHOLD              (3u)
+#endif
+
+/* Set to 0 to count the underruns without changing the Tx DMA setting */
+#ifndef CY_ECM_TX_FALLBACK_ENABLE
+#define CY_ECM_TX_FALLBACK_ENABLE                 (1u)
+#endif
+
+/******************************************************
+ *                  Interrupt moderation
+ ******************************************************/
+/* Set to 0 to keep one interrupt per frame; the frame and interrupt rates are still measured */
+#ifndef CY_ECM_INT_MODERATION_ENABLE
+#define CY_ECM_INT_MODERATION_ENABLE              (1u)
+#endif
+
+/* Interval over which the frame rates are measured and the moderation delays adjusted */
+#ifndef CY_ECM_INT_MODERATION_INTERVAL_MS
+#define CY_ECM_INT_MODERATION_INTERVAL_MS         (10u)
+#endif
+
+/* Latency bound: longest delay of an interrupt after the frame that raised it; at most 204 */
+#ifndef CY_ECM_INT_MODERATION_MAX_DELAY_US
+#define CY_ECM_INT_MODERATION_MAX_DELAY_US        (100u)
+#endif
+
+/* Frames per second up to which interrupts are not delayed, and from which the maximum delay applies */
+#ifndef CY_ECM_INT_MODERATION_LOW_RATE
+#define CY_ECM_INT_MODERATION_LOW_RATE            (2000u)
+#endif
+
+#ifndef CY_ECM_INT_MODERATION_HIGH_RATE
+#define CY_ECM_INT_MODERATION_HIGH_RATE           (20000u)
+#endif
+
+/******************************************************
+ *                  Raw frames
+ ******************************************************/
+/* Slots of the receive dispatch table per interface; a power of two. See cy_ecm_raw_register_vlan() */
+#ifndef CY_ECM_DISPATCH_TABLE_SIZE
+#define CY_ECM_DISPATCH_TABLE_SIZE                (16u)
+#endif
+
+/* Slots looked at per received frame. Every frame costs this many probes; an entry whose EtherType hashes to a run
+ * of this many occupied slots cannot be registered */
+#ifndef CY_ECM_DISPATCH_PROBE_MAX
+#define CY_ECM_DISPATCH_PROBE_MAX                 (4u)
+#endif
+
+/******************************************************
+ *                  Storm control
+ ******************************************************/
+/* Rate limits applied by cy_ecm_ethif_init, in received frames per second; 0 disables the limit.
+ * See cy_ecm_set_storm_control() */
+#ifndef CY_ECM_STORM_BROADCAST_RATE
+#define CY_ECM_STORM_BROADCAST_RATE               (0u)
+#endif
+
+#ifndef CY_ECM_STORM_MULTICAST_RATE
+#define CY_ECM_STORM_MULTICAST_RATE               (0u)
+#endif
+
+#ifndef CY_ECM_STORM_UNKNOWN_UNICAST_RATE
+#define CY_ECM_STORM_UNKNOWN_UNICAST_RATE         (0u)
+#endif
+
+/* Frames of a class accepted back to back above its rate */
+#ifndef CY_ECM_STORM_BURST
+#define CY_ECM_STORM_BURST                        (32u)
+#endif
+
+/* A storm ends once its class dropped no frame for this long */
+#ifndef CY_ECM_STORM_INTERVAL_MS
+#define CY_ECM_STORM_INTERVAL_MS                  (1000u)
+#endif
+
+/******************************************************
+ *                  Packet capture
+ ******************************************************/
+/* Size in bytes of the capture ring shared by the interfaces; a multiple of 4. Each frame takes 16 bytes plus its
+ * captured length, rounded up to 4. See cy_ecm_capture_start() */
+#ifndef CY_ECM_CAPTURE_RING_SIZE
+#define CY_ECM_CAPTURE_RING_SIZE                  (8192u)
+#endif
+
+/* Longest capture filter program, in instructions */
+#ifndef CY_ECM_CAPTURE_FILTER_MAX_LEN
+#define CY_ECM_CAPTURE_FILTER_MAX_LEN             (32u)
+#endif
+
+/******************************************************
+ *                  IP aliases
+ ******************************************************/
+/* Secondary IPv4 addresses per interface; each one takes an lwIP network interface while connected.
+ * See cy_ecm_add_ip_alias() */
+#ifndef CY_ECM_IP_ALIAS_MAX
+#define CY_ECM_IP_ALIAS_MAX                       (4u)
+#endif
 
 #endif /* CY_ETH_USER_CONFIG */
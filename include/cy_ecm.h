@@ -33,6 +33,7 @@
 #pragma once
 
 #include "cy_ecm_error.h"
+#include "cy_eth_user_config.h"
 #include "cy_ephy.h"
 
 /**
@@ -57,6 +58,31 @@ extern "C" {
  ******************************************************/
 #define CY_ECM_MAX_FILTER_ADDRESS                  (4U)         /**< Maximum number of addresses to be filtered by MAC */
 #define CY_ECM_MAC_ADDR_LEN                        (6U)         /**< MAC address length                              */
+#define CY_ECM_MDIO_PHY_ADDR_COUNT                 (32U)        /**< Number of PHY addresses on an MDIO bus          */
+#define CY_ECM_PHY_ADDR_ANY                        (0xFFU)      /**< PHY address found by the MDIO bus scan; see \ref cy_ecm_mdio_find_phy */
+#define CY_ECM_CABLE_PAIR_COUNT                    (4U)         /**< Maximum number of twisted pairs in a cable diagnostics report */
+#define CY_ECM_SQI_UNKNOWN                         (0xFFFFFFFFU) /**< Signal quality index not reported by the PHY */
+#define CY_ECM_TX_QUEUE_COUNT                      (3U)         /**< Number of Tx queues of an interface             */
+#define CY_ECM_RX_QUEUE_COUNT                      (3U)         /**< Number of Rx queues of an interface             */
+#define CY_ECM_RAW_FRAME_MIN_LEN                   (14U)        /**< Length of the Ethernet header; shorter frames are padded by the MAC */
+#define CY_ECM_RAW_FRAME_MAX_LEN                   (1518U)      /**< Longest raw frame without FCS, including one VLAN tag */
+#define CY_ECM_VLAN_ID_MAX                         (4094U)      /**< Highest VLAN ID                                 */
+#define CY_ECM_VLAN_ID_ANY                         (0xFFFFU)    /**< Matches tagged frames of any VLAN and untagged frames */
+#define CY_ECM_VLAN_ID_NONE                        (0U)         /**< No port VLAN; VLAN ID of priority tagged frames */
+#define CY_ECM_PRIORITY_COUNT                      (8U)         /**< Number of 802.1p priorities                     */
+#define CY_ECM_PRIORITY_DSCP                       (0xFFU)      /**< Priority taken from the DSCP of an IP frame     */
+#define CY_ECM_STORM_CLASS_COUNT                   (3U)         /**< Number of traffic classes of the storm control  */
+
+/**
+ * Attribute for memory accessed by the Ethernet DMA. It aligns the memory to the D-cache line and, unless
+ * CY_ECM_DMA_BUFFER_PLACEMENT in cy_eth_user_config.h selects cacheable SRAM, places it in CY_ECM_DMA_BUFFER_SECTION.
+ * Use it for the memory pools of the network stack that back the receive buffers.
+ */
+#if (CY_ECM_DMA_BUFFER_PLACEMENT == CY_ECM_DMA_PLACEMENT_CACHEABLE)
+#define CY_ECM_DMA_BUFFER_ATTRIBUTE                CY_ALIGN(CY_ECM_DMA_BUFFER_ALIGNMENT)
+#else
+#define CY_ECM_DMA_BUFFER_ATTRIBUTE                CY_SECTION(CY_ECM_DMA_BUFFER_SECTION) CY_ALIGN(CY_ECM_DMA_BUFFER_ALIGNMENT)
+#endif
 
 /** \} group_ecm_macros */
 
@@ -130,6 +156,33 @@ typedef enum
     CY_ECM_FILTER_TYPE_SOURCE      = 1, /**< filter on the source address */
 } cy_ecm_filter_type_t;
 
+/** Cable diagnostics status of a twisted pair */
+typedef enum
+{
+    CY_ECM_CABLE_STATUS_UNKNOWN = 0,         /**< Pair not tested, or the result is inconclusive */
+    CY_ECM_CABLE_STATUS_OK,                  /**< Pair correctly terminated */
+    CY_ECM_CABLE_STATUS_OPEN,                /**< Open pair */
+    CY_ECM_CABLE_STATUS_SHORT,               /**< Conductors of the pair shorted together */
+    CY_ECM_CABLE_STATUS_CROSS_SHORT,         /**< Pair shorted to another pair */
+    CY_ECM_CABLE_STATUS_IMPEDANCE_MISMATCH   /**< Impedance mismatch, such as a damaged cable or a bad connector */
+} cy_ecm_cable_status_t;
+
+/** Action taken by ECM when it detects a duplex mismatch */
+typedef enum
+{
+    CY_ECM_DUPLEX_MISMATCH_ACTION_NONE = 0,        /**< Only notify the CY_ECM_EVENT_DUPLEX_MISMATCH event */
+    CY_ECM_DUPLEX_MISMATCH_ACTION_RESTART_AUTONEG, /**< Reset the PHY and restart autonegotiation; the MAC follows the negotiated duplex */
+    CY_ECM_DUPLEX_MISMATCH_ACTION_FORCE_DUPLEX     /**< Force the configured duplex on the PHY and the MAC, at the current speed */
+} cy_ecm_duplex_mismatch_action_t;
+
+/** Received traffic classes rate limited by the storm control */
+typedef enum
+{
+    CY_ECM_STORM_BROADCAST = 0,       /**< Frames to the broadcast address */
+    CY_ECM_STORM_MULTICAST,           /**< Frames to a multicast address */
+    CY_ECM_STORM_UNKNOWN_UNICAST      /**< Unicast frames to another address than the interface MAC address, such as in promiscuous mode */
+} cy_ecm_storm_class_t;
+
 /**
  * Enumeration of ECM events
  */
@@ -137,7 +190,14 @@ typedef enum
 {
     CY_ECM_EVENT_CONNECTED = 0,      /**< Ethernet connection established event; notified on Ethernet link up       */
     CY_ECM_EVENT_DISCONNECTED,       /**< Ethernet disconnection event; notified on Ethernet link down  */
-    CY_ECM_EVENT_IP_CHANGED          /**< IP address change event; notified after connection, re-connection, and IP address change due to DHCP renewal */
+    CY_ECM_EVENT_IP_CHANGED,         /**< IP address change event; notified after connection, re-connection, and IP address change due to DHCP renewal */
+    CY_ECM_EVENT_NETWORK_RECOVERED,  /**< Traffic resumed after link up on a connected interface; the event data contains the time to traffic */
+    CY_ECM_EVENT_CABLE_DIAGNOSTICS,  /**< Cable diagnostics completed; the event data contains the report */
+    CY_ECM_EVENT_LINK_DEGRADED,      /**< Link quality score fell below CY_ECM_LINK_QUALITY_DEGRADED_THRESHOLD; the event data contains the link quality */
+    CY_ECM_EVENT_LINK_QUALITY_RESTORED, /**< Link quality score of a degraded link rose to CY_ECM_LINK_QUALITY_RESTORED_THRESHOLD; the event data contains the link quality */
+    CY_ECM_EVENT_DUPLEX_MISMATCH,    /**< Late collisions or retry limit errors indicate a duplex mismatch; the event data contains the duplex statistics */
+    CY_ECM_EVENT_STORM_START,        /**< The storm control started dropping frames of a class; the event data contains the storm statistics */
+    CY_ECM_EVENT_STORM_END           /**< A class dropped no frame for CY_ECM_STORM_INTERVAL_MS; the event data contains the storm statistics */
 } cy_ecm_event_t;
 
 /** \} group_ecm_enums */
@@ -210,6 +270,25 @@ typedef cy_rslt_t (*cy_ecm_phy_get_auto_neg_status)(uint8_t eth_idx, uint32_t *n
  */
 typedef cy_rslt_t (*cy_ecm_phy_get_link_partner_cap)(uint8_t eth_idx, uint32_t *duplex, uint32_t *speed);
 
+struct cy_ecm_cable_report;
+
+/**
+ * ECM PHY cable diagnostics callback function pointer type.
+ * Runs the time-domain reflectometry (TDR) test of the PHY and fills the pair_count and pair members of the report.
+ * The callback must return the PHY to normal operation before returning.
+ * Note: The callback function will be executed in the context of the task calling \ref cy_ecm_run_cable_diagnostics.
+ */
+typedef cy_rslt_t (*cy_ecm_phy_cable_diag)(uint8_t eth_idx, struct cy_ecm_cable_report *report);
+
+struct cy_ecm_phy_quality;
+
+/**
+ * ECM PHY get signal quality callback function pointer type.
+ * Fills the signal quality index and the receive error count of the PHY; members the PHY does not provide are left unchanged.
+ * Note: The callback function will be executed in the context of the ECM.
+ */
+typedef cy_rslt_t (*cy_ecm_phy_get_quality)(uint8_t eth_idx, struct cy_ecm_phy_quality *quality);
+
 /** \} group_ecm_typedefs */
 
 /**
@@ -256,21 +335,374 @@ typedef struct
 } cy_ecm_filter_address_t;
 
 /**
- * Structure used to pass the callback function implementation for PHY related operations
+ * Structure used to pass the callback function implementation for PHY related operations.
+ * ECM keeps a reference to this structure instead of a copy, so it can be declared const and placed in flash.
+ * Optional callbacks can be set to NULL.
  */
 typedef struct cy_ecm_phy_callbacks
 {
     cy_ecm_phy_init phy_init;                                   /**< Function pointer for Ethernet PHY Init.  */
     cy_ecm_phy_configure phy_configure;                         /**< Function pointer for Ethernet PHY Configure.  */
-    cy_ecm_phy_reset phy_reset;                                 /**< Function pointer for Ethernet PHY Reset.  */
-    cy_ecm_phy_discover phy_discover;                           /**< Function pointer for Ethernet PHY discover.  */
-    cy_ecm_phy_enable_ext_reg phy_enable_ext_reg;               /**< Function pointer for Ethernet PHY enable extended registers.  */
+    cy_ecm_phy_reset phy_reset;                                 /**< Function pointer for Ethernet PHY Reset. Optional.  */
+    cy_ecm_phy_discover phy_discover;                           /**< Function pointer for Ethernet PHY discover. Optional.  */
+    cy_ecm_phy_enable_ext_reg phy_enable_ext_reg;               /**< Function pointer for Ethernet PHY enable extended registers. Optional.  */
     cy_ecm_phy_get_linkspeed phy_get_linkspeed;                 /**< Function pointer for Ethernet PHY get link speed.  */
     cy_ecm_phy_get_linkstatus phy_get_linkstatus;               /**< Function pointer for Ethernet PHY get link status.  */
-    cy_ecm_phy_get_auto_neg_status phy_get_auto_neg_status;     /**< Function pointer for Ethernet PHY get Autonegotiation status.  */
-    cy_ecm_phy_get_link_partner_cap phy_get_link_partner_cap;   /**< Function pointer for Ethernet PHY get link partner capabilities.  */
+    cy_ecm_phy_get_auto_neg_status phy_get_auto_neg_status;     /**< Function pointer for Ethernet PHY get Autonegotiation status. Optional; if NULL, link up indicates that autonegotiation completed.  */
+    cy_ecm_phy_get_link_partner_cap phy_get_link_partner_cap;   /**< Function pointer for Ethernet PHY get link partner capabilities. Optional; if NULL, the negotiated link speed is used.  */
+    cy_ecm_phy_cable_diag phy_cable_diag;                       /**< Function pointer for Ethernet PHY cable diagnostics. Optional; if NULL, \ref cy_ecm_run_cable_diagnostics is not supported.  */
+    cy_ecm_phy_get_quality phy_get_quality;                     /**< Function pointer for Ethernet PHY get signal quality. Optional; if NULL, the link quality is computed from the MAC counters only.  */
 } cy_ecm_phy_callbacks_t;
 
+/**
+ * Structure used to report the RAM used by an ECM interface through \ref cy_ecm_get_memory_usage. All sizes are in bytes.
+ */
+typedef struct
+{
+    uint32_t rx_descriptors;   /**< Receive buffer descriptors of all enabled Rx queues */
+    uint32_t tx_descriptors;   /**< Transmit buffer descriptors of all enabled Tx queues */
+    uint32_t rx_buffers;       /**< Receive buffers posted to the Rx descriptors; pbufs of PBUF_POOL_BUFSIZE bytes with lwIP */
+    uint32_t tx_buffers;       /**< Transmit buffers of the Tx descriptors, CY_ETH_SIZE_MAX_FRAME bytes each, owned by the Ethernet PDL driver */
+    uint32_t object;           /**< ECM handle */
+    uint32_t stack;            /**< ECM event thread stack; shared by all interfaces. With FreeRTOS, it also holds the thread control block when the library is built with CY_ECM_STATIC_ALLOCATION */
+    uint32_t rtos_objects;     /**< RTOS objects outside the ECM handle: the ECM mutexes and event thread handle, shared by all interfaces, and the mutex and semaphore of the MDIO bus of the interface */
+    uint32_t total;            /**< Sum of all of the above */
+} cy_ecm_memory_usage_t;
+
+/**
+ * Structure used to report the cable diagnostics result of one twisted pair.
+ */
+typedef struct
+{
+    cy_ecm_cable_status_t status;       /**< Pair status */
+    uint32_t              distance_cm;  /**< Distance from the PHY to the fault, or the cable length if the pair is OK, in centimeters; 0 if not measured */
+} cy_ecm_cable_pair_t;
+
+/**
+ * Structure used to report the cable diagnostics through \ref cy_ecm_run_cable_diagnostics and the CY_ECM_EVENT_CABLE_DIAGNOSTICS event.
+ */
+typedef struct cy_ecm_cable_report
+{
+    cy_ecm_interface_t  eth_idx;                         /**< Interface tested */
+    uint32_t            pair_count;                      /**< Number of pairs tested; 2 for 10/100 Mbps PHYs, 4 for 1000 Mbps PHYs */
+    cy_ecm_cable_pair_t pair[CY_ECM_CABLE_PAIR_COUNT];   /**< Result per pair, in the order of the MDI pairs A to D */
+    uint32_t            duration_ms;                     /**< Duration of the test, in milliseconds */
+} cy_ecm_cable_report_t;
+
+/**
+ * Structure filled by the phy_get_quality PHY callback. ECM sets sqi to CY_ECM_SQI_UNKNOWN and rx_errors to 0 before the call.
+ */
+typedef struct cy_ecm_phy_quality
+{
+    uint32_t sqi;        /**< Signal quality index scaled from 0 (worst) to 100 (best), or CY_ECM_SQI_UNKNOWN */
+    uint32_t rx_errors;  /**< Receive errors counted by the PHY since the previous call, such as symbol errors and false carriers */
+} cy_ecm_phy_quality_t;
+
+/**
+ * Structure used to report the link quality through \ref cy_ecm_get_link_quality and the CY_ECM_EVENT_LINK_DEGRADED and
+ * CY_ECM_EVENT_LINK_QUALITY_RESTORED events. The error counts are accumulated while the link is up, since \ref cy_ecm_ethif_init.
+ */
+typedef struct
+{
+    cy_ecm_interface_t eth_idx;           /**< Interface */
+    uint32_t           score;             /**< Rolling link quality score, from 0 (worst) to 100 (best) */
+    bool               is_degraded;       /**< The score fell below CY_ECM_LINK_QUALITY_DEGRADED_THRESHOLD and has not yet risen back to CY_ECM_LINK_QUALITY_RESTORED_THRESHOLD */
+    uint32_t           sqi;               /**< Last signal quality index reported by the PHY, or CY_ECM_SQI_UNKNOWN */
+    uint32_t           frames_rx;         /**< Frames received without error */
+    uint32_t           fcs_errors;        /**< Frames received with a CRC error */
+    uint32_t           alignment_errors;  /**< Frames received with an alignment error */
+    uint32_t           symbol_errors;     /**< Frames received with a symbol error, as seen by the MAC */
+    uint32_t           phy_rx_errors;     /**< Receive errors reported by the PHY */
+    uint32_t           degraded_count;    /**< Number of CY_ECM_EVENT_LINK_DEGRADED events */
+} cy_ecm_link_quality_t;
+
+/**
+ * Structure used to report the duplex mismatch detection through \ref cy_ecm_get_duplex_stats and the
+ * CY_ECM_EVENT_DUPLEX_MISMATCH event. The counts are accumulated while the link is up, since \ref cy_ecm_ethif_init.
+ */
+typedef struct
+{
+    cy_ecm_interface_t              eth_idx;              /**< Interface */
+    cy_ecm_duplex_t                 mac_duplex;           /**< Duplex mode the MAC operates in */
+    uint32_t                        late_collisions;      /**< Frames that collided after the collision window; only possible in half duplex */
+    uint32_t                        excessive_collisions; /**< Frames dropped after the retry limit was exceeded */
+    uint32_t                        tx_error_events;      /**< Tx error interrupts, including retry limit exceeded and late collision */
+    uint32_t                        mismatch_count;       /**< Number of CY_ECM_EVENT_DUPLEX_MISMATCH events */
+    uint32_t                        action_count;         /**< Number of corrective actions taken */
+    cy_ecm_duplex_mismatch_action_t last_action;          /**< Action taken on the last mismatch */
+} cy_ecm_duplex_stats_t;
+
+/**
+ * Structure used to report the Tx errors through \ref cy_ecm_get_tx_error_stats. The counts are accumulated since the
+ * Ethernet driver started; the causes are counted by the MAC for all the queues together.
+ */
+typedef struct
+{
+    cy_ecm_interface_t eth_idx;                              /**< Interface */
+    uint32_t           frames_tx;                            /**< Frames transmitted without error */
+    uint32_t           queue_errors[CY_ECM_TX_QUEUE_COUNT];  /**< Tx error interrupts of each queue, whatever the cause */
+    uint32_t           underruns;                            /**< Frames aborted because the DMA did not deliver the data in time */
+    uint32_t           late_collisions;                      /**< Frames aborted by a late collision */
+    uint32_t           excessive_collisions;                 /**< Frames dropped after the retry limit was exceeded */
+    uint32_t           fallback_count;                       /**< Number of times ECM switched the Tx DMA to a more conservative setting */
+    uint32_t           dma_burst_len;                        /**< Current AMBA burst length of the DMA: 1 (single), 4, 8, or 16 */
+    bool               is_store_and_forward;                 /**< A frame is transmitted only once it is completely in the packet buffer */
+} cy_ecm_tx_error_stats_t;
+
+/**
+ * Structure used to report the adaptive interrupt moderation through \ref cy_ecm_get_int_moderation_stats.
+ * The rates are measured over the last CY_ECM_INT_MODERATION_INTERVAL_MS interval.
+ */
+typedef struct
+{
+    cy_ecm_interface_t eth_idx;        /**< Interface */
+    uint32_t           rx_delay_us;    /**< Current delay of the Rx interrupt after the first received frame, in microseconds */
+    uint32_t           tx_delay_us;    /**< Current delay of the Tx interrupt after the first transmitted frame, in microseconds */
+    uint32_t           rx_frame_rate;  /**< Frames received per second */
+    uint32_t           tx_frame_rate;  /**< Frames transmitted per second */
+    uint32_t           irq_rate;       /**< Ethernet interrupts per second */
+    uint32_t           irq_count;      /**< Ethernet interrupts since the driver started */
+    uint32_t           adjust_count;   /**< Number of changes of the moderation delays */
+} cy_ecm_int_moderation_stats_t;
+
+/**
+ * Structure used to report the polled mode statistics through \ref cy_ecm_get_poll_stats.
+ * The cycle counts are measured with the DWT cycle counter of the CPU, from the entry to the exit of the poll.
+ */
+typedef struct
+{
+    cy_ecm_interface_t eth_idx;                 /**< Interface */
+    bool               is_polled;               /**< Interface is in polled mode */
+    uint32_t           poll_count;              /**< Calls to \ref cy_ecm_poll */
+    uint32_t           frames;                  /**< Rx frames and Tx completions handled by \ref cy_ecm_poll */
+    uint32_t           max_frames;              /**< Most Rx frames and Tx completions handled by one call */
+    uint32_t           budget_exhausted_count;  /**< Calls that stopped because the budget was reached */
+    uint32_t           last_cycles;             /**< CPU cycles taken by the last call */
+    uint32_t           max_cycles;              /**< Most CPU cycles taken by one call; the measured worst case */
+} cy_ecm_poll_stats_t;
+
+/**
+ * Structure used to report the raw frame statistics through \ref cy_ecm_get_raw_stats.
+ * The cycle counts are measured with the DWT cycle counter of the CPU.
+ */
+typedef struct
+{
+    cy_ecm_interface_t eth_idx;        /**< Interface */
+    uint32_t           handler_count;  /**< Entries of the receive dispatch table */
+    uint32_t           rx_frames;      /**< Frames dispatched to a raw frame handler */
+    uint32_t           rx_max_cycles;  /**< Most CPU cycles taken by the dispatch of a frame, including its handler */
+    uint32_t           tx_frames;      /**< Raw frames queued for transmission */
+    uint32_t           tx_busy;        /**< Raw frames not sent because no Tx buffer was free */
+    uint32_t           tx_max_cycles;  /**< Most CPU cycles taken to queue a raw frame, from the call to the descriptor handover */
+} cy_ecm_raw_stats_t;
+
+/**
+ * Structure used to report the storm control through \ref cy_ecm_get_storm_stats and the CY_ECM_EVENT_STORM_START
+ * and CY_ECM_EVENT_STORM_END events. The arrays are indexed by \ref cy_ecm_storm_class_t; the counts are accumulated
+ * since the Ethernet driver started.
+ */
+typedef struct
+{
+    cy_ecm_interface_t   eth_idx;                                /**< Interface */
+    cy_ecm_storm_class_t storm_class;                            /**< Class of the event; CY_ECM_STORM_BROADCAST outside an event */
+    uint32_t             rate[CY_ECM_STORM_CLASS_COUNT];         /**< Rate limit in frames per second; 0 if not limited */
+    uint32_t             burst[CY_ECM_STORM_CLASS_COUNT];        /**< Frames accepted back to back at a higher rate */
+    uint32_t             passed[CY_ECM_STORM_CLASS_COUNT];       /**< Frames accepted while the class was rate limited */
+    uint32_t             dropped[CY_ECM_STORM_CLASS_COUNT];      /**< Frames dropped over the rate limit */
+    bool                 is_storm[CY_ECM_STORM_CLASS_COUNT];     /**< A storm is in progress */
+    uint32_t             storm_count[CY_ECM_STORM_CLASS_COUNT];  /**< Number of CY_ECM_EVENT_STORM_START events */
+} cy_ecm_storm_stats_t;
+
+/**
+ * Instruction of a capture filter, in the classic BPF encoding. The output of "tcpdump -dd" can be used as is.
+ */
+typedef struct
+{
+    uint16_t code;  /**< Operation */
+    uint8_t  jt;    /**< Instructions skipped if the condition is true */
+    uint8_t  jf;    /**< Instructions skipped if the condition is false */
+    uint32_t k;     /**< Operand */
+} cy_ecm_capture_insn_t;
+
+/**
+ * Structure used to start a packet capture with \ref cy_ecm_capture_start.
+ */
+typedef struct
+{
+    const cy_ecm_capture_insn_t *filter;      /**< Filter program; copied at the start. NULL captures every frame */
+    uint32_t                     filter_len;  /**< Instructions in the filter, up to CY_ECM_CAPTURE_FILTER_MAX_LEN */
+    uint32_t                     snap_len;    /**< Bytes captured per frame at most; 0 for the whole frame */
+    bool                         capture_tx;  /**< Also capture the frames sent with \ref cy_ecm_raw_send */
+} cy_ecm_capture_config_t;
+
+/**
+ * Structure used to report the packet capture through \ref cy_ecm_get_capture_stats. The counts are reset by
+ * \ref cy_ecm_capture_start.
+ */
+typedef struct
+{
+    cy_ecm_interface_t eth_idx;          /**< Interface */
+    bool               is_running;       /**< A capture is in progress on the interface */
+    bool               is_tx_captured;   /**< Frames sent with \ref cy_ecm_raw_send are captured */
+    uint32_t           frames_matched;   /**< Frames accepted by the filter */
+    uint32_t           frames_rejected;  /**< Frames rejected by the filter */
+    uint32_t           frames_dropped;   /**< Frames accepted by the filter but not captured because the ring was full */
+    uint32_t           bytes_pending;    /**< Bytes of the ring not read yet */
+} cy_ecm_capture_stats_t;
+
+/**
+ * Structure used to start a port mirror with \ref cy_ecm_mirror_start.
+ */
+typedef struct
+{
+    cy_ecm_t                     destination; /**< Handle of the interface the frames are sent out of */
+    bool                         mirror_rx;   /**< Mirror the received frames */
+    bool                         mirror_tx;   /**< Mirror the frames sent with \ref cy_ecm_raw_send */
+    const cy_ecm_capture_insn_t *filter;      /**< Filter selecting the frames, as for \ref cy_ecm_capture_start; NULL mirrors every frame */
+    uint32_t                     filter_len;  /**< Instructions in the filter, up to CY_ECM_CAPTURE_FILTER_MAX_LEN */
+    uint32_t                     rate;        /**< Mirrored frames per second at most; at least 1 */
+    uint32_t                     burst;       /**< Frames mirrored back to back above the rate; at least 1 */
+    uint8_t                      queue;       /**< Tx queue of the destination; 0, or 1 and 2 if enabled in cy_eth_user_config.h */
+} cy_ecm_mirror_config_t;
+
+/**
+ * Structure used to report the port mirroring through \ref cy_ecm_get_mirror_stats. The counts are reset by
+ * \ref cy_ecm_mirror_start.
+ */
+typedef struct
+{
+    cy_ecm_interface_t eth_idx;       /**< Source interface */
+    cy_ecm_interface_t destination;   /**< Destination interface */
+    bool               is_rx;         /**< Received frames are mirrored */
+    bool               is_tx;         /**< Frames sent with \ref cy_ecm_raw_send are mirrored */
+    uint32_t           mirrored;      /**< Frames queued on the destination */
+    uint32_t           rate_dropped;  /**< Frames selected by the filter but not mirrored because of the rate limit */
+    uint32_t           tx_dropped;    /**< Frames not mirrored because no Tx buffer was free or the destination link was down */
+} cy_ecm_mirror_stats_t;
+
+/**
+ * Structure used to configure the 802.1Q VLANs of an interface with \ref cy_ecm_set_vlan_config.
+ */
+typedef struct
+{
+    uint16_t pvid;      /**< Port VLAN ID up to CY_ECM_VLAN_ID_MAX: the VLAN of the untagged and priority tagged frames; CY_ECM_VLAN_ID_NONE if there is none */
+    bool     filter;    /**< Drop the received frames of the VLANs the interface is not a member of; see \ref cy_ecm_set_vlan_member */
+    bool     strip_rx;  /**< Remove the VLAN tag of the received frames of the port VLAN before they reach the network stack; the frames of the other VLANs only reach the raw frame handlers */
+    bool     tag_tx;    /**< Tag the untagged frames sent with \ref cy_ecm_raw_send with the port VLAN ID; requires a port VLAN */
+} cy_ecm_vlan_config_t;
+
+/**
+ * Structure used to report the VLAN configuration and counters of an interface through \ref cy_ecm_get_vlan_stats.
+ */
+typedef struct
+{
+    cy_ecm_interface_t eth_idx;         /**< Interface */
+    uint16_t           pvid;            /**< Port VLAN ID, or CY_ECM_VLAN_ID_NONE */
+    uint32_t           member_count;    /**< VLANs added with \ref cy_ecm_set_vlan_member, besides the port VLAN */
+    bool               is_hw_filtered;  /**< The MAC discards the untagged frames */
+    uint32_t           rx_dropped;      /**< Received frames dropped because the interface is not a member of their VLAN */
+    uint32_t           rx_stripped;     /**< Received frames whose tag was removed */
+    uint32_t           rx_raw_only;     /**< Received frames of a member VLAN other than the port VLAN, kept from the network stack with the tag removal */
+    uint32_t           tx_tagged;       /**< Frames sent with \ref cy_ecm_raw_send that were tagged with the port VLAN ID */
+} cy_ecm_vlan_stats_t;
+
+/**
+ * Structure used to map the 802.1p priorities to the queues of an interface with \ref cy_ecm_set_priority_map.
+ */
+typedef struct
+{
+    uint8_t rx_queue[CY_ECM_PRIORITY_COUNT];  /**< Rx queue of the tagged frames of each priority code point; 0, or 1 and 2 if enabled in cy_eth_user_config.h */
+    uint8_t tx_queue[CY_ECM_PRIORITY_COUNT];  /**< Tx queue of the frames of each priority; 0, or 1 and 2 if enabled in cy_eth_user_config.h */
+    uint8_t tx_pcp[CY_ECM_PRIORITY_COUNT];    /**< Priority code point written to the VLAN tag of the frames of each priority */
+} cy_ecm_priority_map_t;
+
+/**
+ * Structure used to report the network recovery after link up through the CY_ECM_EVENT_NETWORK_RECOVERED event.
+ */
+typedef struct
+{
+    cy_ecm_interface_t eth_idx;            /**< Interface on which the link came up */
+    uint32_t           time_to_traffic_ms; /**< Time from the link up detection to the first unicast frame received, in milliseconds */
+} cy_ecm_recovery_info_t;
+
+/**
+ * Structure used to report the network recovery statistics of an interface through \ref cy_ecm_get_recovery_stats.
+ */
+typedef struct
+{
+    uint32_t link_up_count;               /**< Number of recoveries started, on link up of a connected interface or by \ref cy_ecm_resume */
+    uint32_t recovered_count;             /**< Number of recoveries that completed with received traffic */
+    uint32_t timeout_count;               /**< Number of recoveries with no traffic within CY_ECM_NETWORK_RECOVERY_TIMEOUT_MS */
+    uint32_t last_time_to_traffic_ms;     /**< Time to traffic of the last completed recovery, in milliseconds */
+    uint32_t max_time_to_traffic_ms;      /**< Largest time to traffic observed, in milliseconds */
+    uint32_t resume_count;                /**< Number of successful \ref cy_ecm_resume calls */
+    uint32_t connect_count;               /**< Number of successful \ref cy_ecm_connect calls; each one adds a network interface to the stack */
+    uint32_t last_connect_time_ms;        /**< Duration of the last successful \ref cy_ecm_connect call, until the IP address was assigned, in milliseconds */
+} cy_ecm_recovery_stats_t;
+
+/**
+ * Structure used to report the MDIO statistics of an interface through \ref cy_ecm_get_mdio_stats.
+ */
+typedef struct
+{
+    uint32_t reads;               /**< Register reads requested through \ref cy_ecm_mdio_read */
+    uint32_t cache_hits;          /**< Reads served from the register cache without an MDIO frame */
+    uint32_t bus_reads;           /**< MDIO read frames issued */
+    uint32_t bus_writes;          /**< MDIO write frames issued */
+    uint32_t bus_time_us;         /**< Total time spent in MDIO frames, in microseconds */
+    uint32_t max_transaction_us;  /**< Longest MDIO frame, in microseconds */
+    uint32_t poll_cycles;         /**< PHY poll cycles; bus_reads / poll_cycles is the MDIO traffic per cycle */
+    uint32_t timeouts;            /**< Blocking accesses abandoned after CY_ECM_MDIO_TIMEOUT_MS */
+    uint32_t mdc_frequency_hz;    /**< MDC frequency selected at initialization; a frame takes 64 MDC cycles */
+} cy_ecm_mdio_stats_t;
+
+struct cy_ecm_mdio_transaction;
+
+/**
+ * MDIO transaction completion callback; invoked in the Ethernet interrupt context.
+ */
+typedef void (*cy_ecm_mdio_callback_t)(struct cy_ecm_mdio_transaction *txn);
+
+/**
+ * Structure describing an asynchronous MDIO transaction submitted with \ref cy_ecm_mdio_submit.
+ * The structure must remain valid until the callback is invoked.
+ */
+typedef struct cy_ecm_mdio_transaction
+{
+    uint8_t                          phy_addr;  /**< PHY address on the MDIO bus (0 to 31) */
+    uint8_t                          reg_addr;  /**< Clause 22 register address (0 to 31) */
+    bool                             is_write;  /**< true for a write, false for a read */
+    uint16_t                         data;      /**< Value to write; the value read on completion of a read */
+    cy_ecm_mdio_callback_t           callback;  /**< Completion callback; may be NULL */
+    void                            *arg;       /**< Argument for the completion callback */
+    struct cy_ecm_mdio_transaction  *next;      /**< Used internally by ECM */
+} cy_ecm_mdio_transaction_t;
+
+/**
+ * Structure used to report the PHY address scan and the lock contention of an MDIO bus through \ref cy_ecm_get_mdio_bus_info.
+ */
+typedef struct
+{
+    cy_ecm_interface_t bus;                                  /**< Interface of the Ethernet MAC driving the MDIO bus */
+    uint32_t           interface_count;                      /**< Number of initialized interfaces sharing the bus */
+    uint32_t           phy_mask;                             /**< One bit per PHY address that responded to the scan */
+    uint32_t           phy_id[CY_ECM_MDIO_PHY_ADDR_COUNT];   /**< PHY identifier per address, PHY identifier 1 in the upper 16 bits; 0 if no PHY responded */
+    uint32_t           scan_time_us;                         /**< Duration of the PHY address scan, in microseconds */
+    uint32_t           lock_count;                           /**< Number of times the bus lock was taken */
+    uint32_t           contended_count;                      /**< Number of times the bus lock was held by another task */
+    uint32_t           total_wait_us;                        /**< Time spent waiting for the bus lock, in microseconds */
+    uint32_t           max_wait_us;                          /**< Longest wait for the bus lock, in microseconds */
+} cy_ecm_mdio_bus_info_t;
+
+/**
+ * Structure used to configure the generic PHY driver of an interface through \ref cy_ecm_phy_generic_set_config.
+ */
+typedef struct
+{
+    uint8_t                        phy_addr;   /**< PHY address on the MDIO bus (0 to 31), or CY_ECM_PHY_ADDR_ANY to use the PHY found by \ref cy_ecm_mdio_find_phy */
+    const cy_ecm_phy_callbacks_t  *overrides;  /**< Vendor-specific callbacks; each non-NULL member replaces the generic implementation. May be NULL. Referenced, not copied. */
+} cy_ecm_phy_generic_config_t;
+
 /** \} group_ecm_structures */
 
 /**
@@ -282,7 +714,12 @@ typedef struct cy_ecm_phy_callbacks
  */
 typedef union
 {
-    cy_ecm_ip_address_t ip_addr;  /**< Contains the IP address for the CY_ECM_EVENT_IP_CHANGED event */
+    cy_ecm_ip_address_t    ip_addr;   /**< Contains the IP address for the CY_ECM_EVENT_IP_CHANGED event */
+    cy_ecm_recovery_info_t recovery;  /**< Contains the recovery details for the CY_ECM_EVENT_NETWORK_RECOVERED event */
+    cy_ecm_cable_report_t  cable;     /**< Contains the cable diagnostics report for the CY_ECM_EVENT_CABLE_DIAGNOSTICS event */
+    cy_ecm_link_quality_t  quality;   /**< Contains the link quality for the CY_ECM_EVENT_LINK_DEGRADED and CY_ECM_EVENT_LINK_QUALITY_RESTORED events */
+    cy_ecm_duplex_stats_t  duplex;    /**< Contains the duplex statistics for the CY_ECM_EVENT_DUPLEX_MISMATCH event */
+    cy_ecm_storm_stats_t   storm;     /**< Contains the storm statistics for the CY_ECM_EVENT_STORM_START and CY_ECM_EVENT_STORM_END events */
 } cy_ecm_event_data_t;
 
 /** \} group_ecm_union */
@@ -300,6 +737,19 @@ typedef union
  */
 typedef void (*cy_ecm_event_callback_t)(cy_ecm_event_t event, cy_ecm_event_data_t *event_data);
 
+/**
+ * ECM raw frame receive callback function pointer type.
+ * @param[in] ecm_handle       : ECM handle of the interface that received the frame
+ * @param[in] frame            : The received frame, from the destination MAC address to the end of the payload, without FCS.
+ *                               The frame is in the receive buffer and is valid only until the callback returns.
+ * @param[in] length           : Length of the frame in bytes
+ * @param[in] ctx              : Context registered with the callback
+ *
+ * Note: The callback function is executed in the Ethernet interrupt context, or in the context of \ref cy_ecm_poll in polled mode;
+ * it must not block.
+ */
+typedef void (*cy_ecm_raw_rx_cb_t)(cy_ecm_t ecm_handle, const uint8_t *frame, uint32_t length, void *ctx);
+
 /** \} group_ecm_typedefs */
 
 /**
@@ -345,14 +795,18 @@ cy_rslt_t cy_ecm_deinit( void );
  * The handle to the ECM instance is returned via the handle pointer supplied by the user on success.
  *
  * \note
- * 1. Ethernet Connection Manager library returns error as required ethernet phy driver callbacks functions were not passed with this API.
+ * 1. Ethernet Connection Manager library returns error if the required ethernet phy driver callback functions (phy_init, phy_configure, phy_get_linkspeed and phy_get_linkstatus) were not passed with this API.
+ *    If phy_callbacks is NULL, the generic PHY driver \ref cy_ecm_phy_generic_callbacks is used.
  * 2. As a part of \ref cy_ecm_ethif_init, Ethernet driver initialization is called, which does GPIO and clock divider settings for the given physical configurations. But, Ethernet driver deinitialization is not available to clear these clock and GPIO settings.Hence, \ref cy_ecm_ethif_init cannot be called more than once in a single session, with different physical configurations.
  * 3. If either speed or duplex mode is set to AUTO, the Autonegotiation will be enabled. Application can call \ref cy_ecm_get_link_speed, to check the speed and duplex mode configured.
  *
  * @param[in]  eth_idx        : Ethernet port to be initialized
- * @param[in]  phy_callbacks  : Structure containing the Ethernet physical driver callback implementation for required ethernet PHY chip.
+ * @param[in]  phy_callbacks  : Structure containing the Ethernet physical driver callback implementation for required ethernet PHY chip, or NULL for the generic PHY driver.
+ *                              ECM keeps a reference to this structure; it must remain valid until \ref cy_ecm_ethif_deinit returns.
+ *                              The same structure can be shared by both interfaces.
  * @param[out] ecm_handle     : Pointer to store the ECM handle allocated by this function on a successful return.
  *                              Caller should not free the handle directly. You should invoke \ref cy_ecm_ethif_deinit to free the handle.
+ *                              When the library is built with CY_ECM_STATIC_ALLOCATION, the handle is taken from a static per-interface pool instead of the heap.
  *
  * @return CY_RSLT_SUCCESS if ECM initialization was successful; an error code on failure.
  *             Important error code related to this API function are: \n
@@ -363,7 +817,7 @@ cy_rslt_t cy_ecm_deinit( void );
  *             \ref CY_RSLT_ECM_INIT_ERROR
  */
 cy_rslt_t cy_ecm_ethif_init(cy_ecm_interface_t eth_idx,
-                            cy_ecm_phy_callbacks_t *phy_callbacks,
+                            const cy_ecm_phy_callbacks_t *phy_callbacks,
                             cy_ecm_t *ecm_handle);
 
 /**
@@ -460,6 +914,44 @@ cy_rslt_t cy_ecm_connect(cy_ecm_t ecm_handle, cy_ecm_ip_setting_t *static_ip_add
  */
 cy_rslt_t cy_ecm_disconnect(cy_ecm_t ecm_handle);
 
+/**
+ * Suspends the network traffic of a connected interface while keeping it registered with the network stack.
+ *
+ * Unlike \ref cy_ecm_disconnect, the network interface, its address configuration, the DHCP lease, and the open sockets are kept.
+ * Call this function on the CY_ECM_EVENT_DISCONNECTED event and \ref cy_ecm_resume on the CY_ECM_EVENT_CONNECTED event
+ * instead of disconnecting and connecting again. While the interface is suspended, ECM does not recover the network layer
+ * automatically on link up.
+ *
+ * @param[in]  ecm_handle: ECM handle created using \ref cy_ecm_ethif_init.
+ *
+ * @return CY_RSLT_SUCCESS if the interface was suspended or was already suspended; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_CONNECTED
+ */
+cy_rslt_t cy_ecm_suspend(cy_ecm_t ecm_handle);
+
+/**
+ * Resumes the network traffic of an interface suspended with \ref cy_ecm_suspend.
+ *
+ * The link must be up. ECM flushes the ARP cache of the interface, restarts DHCP from the previous lease (or re-announces the
+ * static address), and sends a gratuitous ARP; the function does not wait for the network stack to complete these steps.
+ * The time to traffic is reported with the CY_ECM_EVENT_NETWORK_RECOVERED event and in \ref cy_ecm_get_recovery_stats.
+ *
+ * @param[in]  ecm_handle: ECM handle created using \ref cy_ecm_ethif_init.
+ *
+ * @return CY_RSLT_SUCCESS if the interface was resumed; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR \n
+ *             \ref CY_RSLT_ECM_NOT_SUSPENDED \n
+ *             \ref CY_RSLT_ECM_LINK_DOWN
+ */
+cy_rslt_t cy_ecm_resume(cy_ecm_t ecm_handle);
+
 /**
  * Registers an event callback to monitor the connection and IP address change events.
  * This is an optional registration; use it if the application needs to monitor events across disconnection and reconnection.
@@ -612,16 +1104,854 @@ cy_rslt_t cy_ecm_get_link_speed(cy_ecm_t ecm_handle, cy_ecm_duplex_t *duplex, cy
  * Deinitializes the Ethernet physical driver.
  * Disables Ethernet port, brings down the network stack, and frees the handle. This function should be called after calling \ref cy_ecm_ethif_init.
  *
+ * An interface whose MAC drives an MDIO bus shared with another interface (see CY_ECM_ETH1_MDIO_BUS) is deinitialized
+ * after the other interface; until then, this function returns CY_RSLT_ECM_BUSY.
+ *
  * @param[in, out]  ecm_handle : Pointer containing the ECM handle created using \ref cy_ecm_ethif_init
  *
  * @return CY_RSLT_SUCCESS if ECM de-initialization was successful; an error code on failure.
  *             Important error code related to this API function are: \n
  *             \ref CY_RSLT_MODULE_ECM_BADARG \n
  *             \ref CY_RSLT_ECM_MUTEX_ERROR \n
- *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_BUSY
  */
 cy_rslt_t cy_ecm_ethif_deinit(cy_ecm_t *ecm_handle);
 
+/**
+ * Reports the RAM used by the given interface for buffer descriptors, buffers, the ECM handle, and the ECM event thread stack.
+ *
+ * The descriptor and buffer sizes follow the ring depths and queue enablement configured in cy_eth_user_config.h. The
+ * receive buffers are counted at the size of the network stack buffers posted to the descriptors, and the transmit buffers
+ * at the frame size of the Ethernet PDL driver.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  usage      : Pointer to a structure filled with the memory usage on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the memory usage was reported; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_get_memory_usage(cy_ecm_t ecm_handle, cy_ecm_memory_usage_t *usage);
+
+/**
+ * Retrieves the network recovery statistics of the given interface.
+ *
+ * When the link of a connected interface comes up again, ECM flushes the ARP cache of the interface, restarts DHCP
+ * (or re-announces the static address), and sends a gratuitous ARP. The time from the link up detection to the first
+ * unicast frame received is reported through the CY_ECM_EVENT_NETWORK_RECOVERED event and accumulated in these statistics.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  stats      : Pointer to a structure filled with the recovery statistics on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the statistics were retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_get_recovery_stats(cy_ecm_t ecm_handle, cy_ecm_recovery_stats_t *stats);
+
+/**
+ * Reads a clause 22 PHY register through the ECM MDIO access layer.
+ *
+ * PHY callbacks should access the PHY registers through this function instead of the Ethernet PDL driver. Identification and
+ * configuration registers are cached until they are written or the PHY is reset; status registers (BMCR, BMSR, link partner
+ * ability, 1000BASE-T status) are read from the PHY once per PHY poll cycle of ECM; latched, clear-on-read, MMD access, and
+ * vendor-specific registers are always read from the PHY.
+ *
+ * @param[in]   eth_idx  : Ethernet interface; the value passed to the PHY callbacks
+ * @param[in]   phy_addr : PHY address on the MDIO bus (0 to 31)
+ * @param[in]   reg_addr : Register address (0 to 31)
+ * @param[out]  value    : Pointer filled with the register value on successful return
+ *
+ * Once the Ethernet MAC interrupts are enabled, the caller blocks on the management frame interrupt instead of polling the bus.
+ *
+ * @return CY_RSLT_SUCCESS if the register was read; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MDIO_TIMEOUT
+ */
+cy_rslt_t cy_ecm_mdio_read(cy_ecm_interface_t eth_idx, uint8_t phy_addr, uint8_t reg_addr, uint16_t *value);
+
+/**
+ * Writes a clause 22 PHY register through the ECM MDIO access layer and updates the register cache.
+ *
+ * @param[in]   eth_idx  : Ethernet interface; the value passed to the PHY callbacks
+ * @param[in]   phy_addr : PHY address on the MDIO bus (0 to 31)
+ * @param[in]   reg_addr : Register address (0 to 31)
+ * @param[in]   value    : Value to write
+ *
+ * @return CY_RSLT_SUCCESS if the register was written; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MDIO_TIMEOUT
+ */
+cy_rslt_t cy_ecm_mdio_write(cy_ecm_interface_t eth_idx, uint8_t phy_addr, uint8_t reg_addr, uint16_t value);
+
+/**
+ * Queues an MDIO transaction without waiting for it to complete.
+ *
+ * Transactions are queued per PHY address and the PHY addresses on the bus are served round-robin. Each frame is completed by
+ * the management frame interrupt, which invokes the callback of the transaction. Until the Ethernet MAC interrupts are enabled
+ * during \ref cy_ecm_ethif_init, the transaction is completed before this function returns. The register cache is not
+ * updated with the values read.
+ *
+ * @param[in]      eth_idx : Ethernet interface; the value passed to the PHY callbacks
+ * @param[in,out]  txn     : Transaction to queue
+ *
+ * @return CY_RSLT_SUCCESS if the transaction was queued; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED
+ */
+cy_rslt_t cy_ecm_mdio_submit(cy_ecm_interface_t eth_idx, cy_ecm_mdio_transaction_t *txn);
+
+/**
+ * Retrieves the MDIO transaction statistics of the given interface.
+ *
+ * The MDIO frame times are measured with the DWT cycle counter, which ECM enables if it is not running.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  stats      : Pointer to a structure filled with the MDIO statistics on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the statistics were retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED
+ */
+cy_rslt_t cy_ecm_get_mdio_stats(cy_ecm_t ecm_handle, cy_ecm_mdio_stats_t *stats);
+
+/**
+ * Returns the address of the PHY of an interface, found by the PHY address scan of its MDIO bus.
+ *
+ * Each MDIO bus is scanned once, on the first access through the ECM MDIO access layer; the PHY identifiers found are
+ * cached, and reads of the PHY identifier registers of these PHYs do not access the bus. The first call for an interface
+ * claims the lowest PHY address that no other interface on the bus has claimed; later calls return the same address.
+ *
+ * @param[in]   eth_idx  : Ethernet interface; the value passed to the PHY callbacks
+ * @param[out]  phy_addr : Pointer filled with the PHY address on successful return
+ *
+ * @return CY_RSLT_SUCCESS if a PHY was found; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_PHY_NOT_FOUND
+ */
+cy_rslt_t cy_ecm_mdio_find_phy(cy_ecm_interface_t eth_idx, uint8_t *phy_addr);
+
+/**
+ * Retrieves the PHY address scan results and the lock contention of the MDIO bus used by the given interface.
+ *
+ * Interfaces sharing an MDIO bus report the same information. The bus is scanned by this function if it was not yet accessed.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  info       : Pointer to a structure filled with the MDIO bus information on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the information was retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED
+ */
+cy_rslt_t cy_ecm_get_mdio_bus_info(cy_ecm_t ecm_handle, cy_ecm_mdio_bus_info_t *info);
+
+/**
+ * Reads a clause 45 MMD register through the clause 22 MMD access registers (IEEE 802.3 annex 22D).
+ *
+ * The register select and data frames are not interleaved with the other blocking accesses of the interface. The MMD
+ * registers are not cached.
+ *
+ * @param[in]   eth_idx  : Ethernet interface; the value passed to the PHY callbacks
+ * @param[in]   phy_addr : PHY address on the MDIO bus (0 to 31)
+ * @param[in]   devad    : MMD device address (0 to 31)
+ * @param[in]   reg_addr : Register address within the MMD
+ * @param[out]  value    : Pointer filled with the register value on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the register was read; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MDIO_TIMEOUT
+ */
+cy_rslt_t cy_ecm_mdio_read_mmd(cy_ecm_interface_t eth_idx, uint8_t phy_addr, uint8_t devad, uint16_t reg_addr, uint16_t *value);
+
+/**
+ * Writes a clause 45 MMD register through the clause 22 MMD access registers (IEEE 802.3 annex 22D).
+ *
+ * @param[in]   eth_idx  : Ethernet interface; the value passed to the PHY callbacks
+ * @param[in]   phy_addr : PHY address on the MDIO bus (0 to 31)
+ * @param[in]   devad    : MMD device address (0 to 31)
+ * @param[in]   reg_addr : Register address within the MMD
+ * @param[in]   value    : Value to write
+ *
+ * @return CY_RSLT_SUCCESS if the register was written; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MDIO_TIMEOUT
+ */
+cy_rslt_t cy_ecm_mdio_write_mmd(cy_ecm_interface_t eth_idx, uint8_t phy_addr, uint8_t devad, uint16_t reg_addr, uint16_t value);
+
+/**
+ * Generic PHY driver for IEEE 802.3 compliant 10/100/1000 PHYs.
+ *
+ * The callbacks use the standard clause 22 registers through the ECM MDIO access layer: the PHY is identified and its
+ * abilities are read from BMSR and the extended status register; autonegotiation advertises the abilities that match the
+ * requested speed and duplex and is restarted only if the advertisement changed; the negotiated mode is resolved from
+ * the advertisement and the link partner ability registers. A 10 or 100 Mbps mode with a fixed duplex is forced
+ * without autonegotiation; 1000 Mbps with a fixed duplex is negotiated with only that mode advertised, as 1000BASE-T
+ * requires autonegotiation. A mode that the PHY does not support is rejected. Pass this table, or NULL, to
+ * \ref cy_ecm_ethif_init.
+ * By default, the PHY address is CY_ECM_PHY_GENERIC_DEFAULT_ADDR, which selects the PHY found by \ref cy_ecm_mdio_find_phy;
+ * use \ref cy_ecm_phy_generic_set_config to set the address or to add vendor-specific callbacks.
+ */
+extern const cy_ecm_phy_callbacks_t cy_ecm_phy_generic_callbacks;
+
+/**
+ * Configures the generic PHY driver for an interface. Must be called before \ref cy_ecm_ethif_init.
+ *
+ * Each non-NULL member of config->overrides replaces the corresponding generic callback; phy_init still identifies the
+ * PHY before the vendor-specific phy_init is called. Vendor-specific callbacks can access the clause 45 registers through
+ * \ref cy_ecm_mdio_read_mmd and \ref cy_ecm_mdio_write_mmd.
+ *
+ * @param[in]  eth_idx : Ethernet interface
+ * @param[in]  config  : Generic PHY driver configuration
+ *
+ * @return CY_RSLT_SUCCESS if the configuration was applied; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG
+ */
+cy_rslt_t cy_ecm_phy_generic_set_config(cy_ecm_interface_t eth_idx, const cy_ecm_phy_generic_config_t *config);
+
+/**
+ * Runs the cable diagnostics of the PHY of an interface through the phy_cable_diag PHY callback.
+ *
+ * The time-domain reflectometry test reports the status of each twisted pair and the distance to a fault. The link of the
+ * tested interface goes down while the test runs, and ECM does not report the link changes of this interface until the test
+ * completes; the other interface is polled as usual. On success, the report is also published with the
+ * CY_ECM_EVENT_CABLE_DIAGNOSTICS event. This function blocks until the test completes.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  report     : Pointer to a structure filled with the diagnostics report on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the diagnostics completed; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR \n
+ *             \ref CY_RSLT_ECM_NOT_SUPPORTED \n
+ *             \ref CY_RSLT_ECM_BUSY
+ */
+cy_rslt_t cy_ecm_run_cable_diagnostics(cy_ecm_t ecm_handle, cy_ecm_cable_report_t *report);
+
+/**
+ * Retrieves the link quality of the given interface.
+ *
+ * While the link is up, ECM samples the CRC, alignment, and symbol error counters of the MAC and, through the optional
+ * phy_get_quality PHY callback, the signal quality index and receive errors of the PHY every CY_ECM_LINK_QUALITY_INTERVAL_MS.
+ * Each sample is scored from the error rate, bounded by the signal quality index, and folded into a rolling score.
+ * The CY_ECM_EVENT_LINK_DEGRADED and CY_ECM_EVENT_LINK_QUALITY_RESTORED events are notified when the score crosses the
+ * thresholds set in cy_eth_user_config.h. The score restarts from 100 on each link up.
+ *
+ * \note ECM reads the statistics registers of the MAC, which clear on read.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  quality    : Pointer to a structure filled with the link quality on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the link quality was retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_get_link_quality(cy_ecm_t ecm_handle, cy_ecm_link_quality_t *quality);
+
+/**
+ * Sets the action taken when a duplex mismatch is detected on the given interface.
+ *
+ * While the link is up, ECM counts the late collisions and the retry limit errors of the MAC every
+ * CY_ECM_DUPLEX_MISMATCH_INTERVAL_MS. At least CY_ECM_DUPLEX_MISMATCH_THRESHOLD of them in one interval indicate that
+ * this end runs half duplex against a full duplex link partner, typically an autonegotiating PHY facing a forced
+ * full duplex link partner. ECM then notifies the CY_ECM_EVENT_DUPLEX_MISMATCH event once and takes the configured action.
+ * The mismatch is reported again only after a link change or an interval without collisions.
+ * By default, the action is CY_ECM_DUPLEX_MISMATCH_ACTION_NONE.
+ *
+ * \note The full duplex end of a mismatched link does not see collisions; its CRC errors are reported by the link
+ *       quality monitor, see \ref cy_ecm_get_link_quality.
+ *
+ * @param[in]   ecm_handle    : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[in]   action        : Action taken on a duplex mismatch
+ * @param[in]   forced_duplex : Duplex forced by CY_ECM_DUPLEX_MISMATCH_ACTION_FORCE_DUPLEX; CY_ECM_DUPLEX_HALF or CY_ECM_DUPLEX_FULL.
+ *                              Ignored for the other actions.
+ *
+ * @return CY_RSLT_SUCCESS if the action was set; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_set_duplex_mismatch_action(cy_ecm_t ecm_handle, cy_ecm_duplex_mismatch_action_t action, cy_ecm_duplex_t forced_duplex);
+
+/**
+ * Retrieves the late collision, retry limit error, and duplex mismatch statistics of the given interface.
+ *
+ * \note ECM reads the statistics registers of the MAC, which clear on read.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  stats      : Pointer to a structure filled with the statistics on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the statistics were retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_get_duplex_stats(cy_ecm_t ecm_handle, cy_ecm_duplex_stats_t *stats);
+
+/**
+ * Retrieves the Tx error statistics and the current Tx DMA setting of the given interface.
+ *
+ * Use these statistics to tell whether lost throughput comes from the MAC. When at least CY_ECM_TX_UNDERRUN_THRESHOLD
+ * underruns occur within CY_ECM_TX_UNDERRUN_INTERVAL_MS, ECM switches the transmitter to store and forward or, if it already
+ * is, reduces the AMBA burst length of the DMA by one step. ECM halts the transmitter at the end of the frame in progress
+ * to apply the change, and resumes it right after; the ECM event thread does not wait for the frame, but checks every
+ * few milliseconds whether it ended. Store and forward only affects the transmitter and is kept until the
+ * Ethernet driver is initialized again. The burst length is shared with the Rx DMA, so a reduced burst also lowers the
+ * receive throughput; ECM restores the original burst length on the next link up. Set CY_ECM_TX_FALLBACK_ENABLE to 0
+ * to only count the underruns.
+ *
+ * \note ECM reads the statistics registers of the MAC, which clear on read.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  stats      : Pointer to a structure filled with the statistics on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the statistics were retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_get_tx_error_stats(cy_ecm_t ecm_handle, cy_ecm_tx_error_stats_t *stats);
+
+/**
+ * Retrieves the adaptive interrupt moderation state and its effect on the interrupt rate of the given interface.
+ *
+ * Every CY_ECM_INT_MODERATION_INTERVAL_MS, the Ethernet interrupt handler measures the Rx and Tx frame rates and sets
+ * the corresponding interrupt moderation delay of the MAC: none up to CY_ECM_INT_MODERATION_LOW_RATE frames per second,
+ * so that light traffic is handled with the lowest latency, then rising linearly to CY_ECM_INT_MODERATION_MAX_DELAY_US
+ * at CY_ECM_INT_MODERATION_HIGH_RATE, so that bursts are handled with fewer interrupts. The delay drops at once when the
+ * load falls. Set CY_ECM_INT_MODERATION_ENABLE to 0 to only measure the rates.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  stats      : Pointer to a structure filled with the statistics on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the statistics were retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_get_int_moderation_stats(cy_ecm_t ecm_handle, cy_ecm_int_moderation_stats_t *stats);
+
+/**
+ * Switches the given interface between interrupt mode, the default, and polled mode.
+ *
+ * In polled mode, the Ethernet interrupt of the interface is disabled, so that no Ethernet processing preempts the
+ * application at an arbitrary time. The application calls \ref cy_ecm_poll from its own time slot to receive the frames
+ * and reclaim the transmitted buffers. The MDIO frames of the bus driven by the interface are completed synchronously in
+ * polled mode: the calling thread polls the bus for the duration of the frame, 64 MDC periods (about 26 us at 2.5 MHz),
+ * so that the PHY access does not depend on the rate of \ref cy_ecm_poll. The interrupt moderation is disabled in polled mode.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[in]   enable     : true to switch to polled mode; false to return to interrupt mode
+ *
+ * @return CY_RSLT_SUCCESS if the mode was set; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_set_polled_mode(cy_ecm_t ecm_handle, bool enable);
+
+/**
+ * Handles the pending Ethernet events of an interface in polled mode: receives the frames and reclaims the transmitted
+ * buffers.
+ *
+ * The events are handled in passes over the descriptor rings, which stop once budget Rx frames and Tx completions have been
+ * handled or a pass finds nothing. A call therefore handles at most budget frames plus one pass, that is, the Rx and Tx
+ * descriptors of the enabled queues (CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE and CY_ETH_DEFINE_TOTAL_BD_PER_TXQUEUE each).
+ * The cost of a frame depends on the network stack input path; \ref cy_ecm_get_poll_stats reports the measured worst case
+ * in CPU cycles, to be checked against the time slot on the target.
+ *
+ * This function takes no lock and does not log, so that its duration is bounded; do not call it concurrently with
+ * \ref cy_ecm_ethif_deinit or \ref cy_ecm_set_polled_mode on the same interface.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[in]   budget     : Number of Rx frames and Tx completions after which no further pass is started; must be non-zero
+ *
+ * @return CY_RSLT_SUCCESS if the events were handled; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_NOT_POLLED_MODE
+ */
+cy_rslt_t cy_ecm_poll(cy_ecm_t ecm_handle, uint32_t budget);
+
+/**
+ * Retrieves the polled mode statistics of the given interface, including the measured worst case duration of \ref cy_ecm_poll.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  stats      : Pointer to a structure filled with the statistics on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the statistics were retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_get_poll_stats(cy_ecm_t ecm_handle, cy_ecm_poll_stats_t *stats);
+
+/**
+ * Registers a handler for the received frames of an EtherType, for layer 2 protocols that bypass the network stack.
+ *
+ * Matching frames are passed to the handler in place, before they reach the network stack. The network stack still
+ * releases the receive buffer after the handler returns; it drops the frames of the EtherTypes it does not handle, so
+ * registering an IP or ARP EtherType taps these frames without diverting them. The handler is matched for tagged and
+ * untagged frames; see \ref cy_ecm_raw_register_vlan. Registering an EtherType again replaces its handler; a NULL
+ * callback unregisters it.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[in]   ethertype  : EtherType in host byte order; at least 0x0600
+ * @param[in]   callback   : Handler; NULL to unregister
+ * @param[in]   ctx        : Context passed back to the handler
+ *
+ * @return CY_RSLT_SUCCESS if the handler was registered or unregistered; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_ERROR_NOMEM \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_raw_register(cy_ecm_t ecm_handle, uint16_t ethertype, cy_ecm_raw_rx_cb_t callback, void *ctx);
+
+/**
+ * Registers a handler for the received frames of an EtherType on a VLAN.
+ *
+ * The handlers are held in a dispatch table of CY_ECM_DISPATCH_TABLE_SIZE entries per interface. A frame is looked up
+ * by its EtherType, or by the VLAN ID and the inner EtherType of a tagged frame, in a fixed number of table slots, so
+ * the dispatch cost per frame does not depend on the number of handlers. A handler for CY_ECM_VLAN_ID_ANY is matched
+ * for untagged frames and for the frames of the VLANs that have no handler of their own for the EtherType: the handler
+ * of a VLAN always takes precedence, whatever the registration order. Frames that match no handler only go to the
+ * network stack.
+ *
+ * The table may be updated while frames are received: the receive path is never blocked, and sees either the previous
+ * or the new handler. The call returns once the previous handler can no longer be called.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[in]   ethertype  : EtherType in host byte order; at least 0x0600 and not 0x8100
+ * @param[in]   vlan_id    : VLAN ID up to CY_ECM_VLAN_ID_MAX, or CY_ECM_VLAN_ID_ANY
+ * @param[in]   callback   : Handler; NULL to unregister
+ * @param[in]   ctx        : Context passed back to the handler
+ *
+ * @return CY_RSLT_SUCCESS if the handler was registered or unregistered; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_ERROR_NOMEM \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_raw_register_vlan(cy_ecm_t ecm_handle, uint16_t ethertype, uint16_t vlan_id, cy_ecm_raw_rx_cb_t callback, void *ctx);
+
+/**
+ * Transmits a complete Ethernet frame as is, bypassing the network stack.
+ *
+ * The frame is copied into a Tx buffer of the driver and queued on the given Tx queue; the caller may reuse it on
+ * return. The MAC appends the FCS and pads frames shorter than the minimum length. The frames are serialized with
+ * the output of the network stack. If tagging is configured with \ref cy_ecm_set_vlan_config, an untagged frame is
+ * sent with the tag of the port VLAN inserted, so it must be at most CY_ECM_RAW_FRAME_MAX_LEN - 4 bytes long.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[in]   frame      : Frame from the destination MAC address to the end of the payload, without FCS
+ * @param[in]   length     : Length of the frame; CY_ECM_RAW_FRAME_MIN_LEN to CY_ECM_RAW_FRAME_MAX_LEN
+ * @param[in]   queue      : Tx queue; 0, or 1 and 2 if enabled in cy_eth_user_config.h
+ *
+ * @return CY_RSLT_SUCCESS if the frame was queued; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_BUSY \n
+ *             \ref CY_RSLT_ECM_LINK_DOWN \n
+ *             \ref CY_RSLT_ECM_ERROR
+ */
+cy_rslt_t cy_ecm_raw_send(cy_ecm_t ecm_handle, const uint8_t *frame, uint32_t length, uint8_t queue);
+
+/**
+ * Retrieves the raw frame statistics of the given interface, including the measured dispatch and send durations.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  stats      : Pointer to a structure filled with the statistics on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the statistics were retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_get_raw_stats(cy_ecm_t ecm_handle, cy_ecm_raw_stats_t *stats);
+
+/**
+ * Sets the rate limit of a received traffic class, to protect the CPU from broadcast and multicast storms.
+ *
+ * Each class is limited by a token bucket: frames are accepted at up to the rate on average, and up to the burst
+ * back to back. The limit is enforced in the Ethernet interrupt context, before the frame is handed to the network
+ * stack; the receive buffer of a dropped frame is given back to the DMA, so the network stack neither allocates a
+ * buffer for it nor processes it. Unlike \ref cy_ecm_broadcast_disable, ARP keeps working during a storm as long as
+ * its frames fit in the rate. The CY_ECM_EVENT_STORM_START event is notified when a class starts dropping frames,
+ * and CY_ECM_EVENT_STORM_END when it dropped none for CY_ECM_STORM_INTERVAL_MS.
+ *
+ * The limits set with the CY_ECM_STORM_*_RATE and CY_ECM_STORM_BURST values of cy_eth_user_config.h are applied by
+ * \ref cy_ecm_ethif_init.
+ *
+ * @param[in]   ecm_handle  : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[in]   storm_class : Traffic class
+ * @param[in]   rate        : Frames per second; 0 to remove the limit
+ * @param[in]   burst       : Frames accepted back to back; at least 1 if the rate is not 0
+ *
+ * @return CY_RSLT_SUCCESS if the limit was set; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_set_storm_control(cy_ecm_t ecm_handle, cy_ecm_storm_class_t storm_class, uint32_t rate, uint32_t burst);
+
+/**
+ * Retrieves the storm control limits and counters of the given interface.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  stats      : Pointer to a structure filled with the statistics on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the statistics were retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_get_storm_stats(cy_ecm_t ecm_handle, cy_ecm_storm_stats_t *stats);
+
+/**
+ * Starts capturing the frames of an interface selected by a filter into the capture ring.
+ *
+ * The filter is a program in the classic BPF encoding, such as the output of "tcpdump -dd"; its return value is the
+ * number of bytes to capture, 0 to skip the frame. The program is validated when the capture starts, so its run time
+ * is bounded by its length. It runs in the Ethernet interrupt context for each received frame; a rejected frame costs
+ * the filter run only. An accepted frame is copied, up to the snap length, into a ring of CY_ECM_CAPTURE_RING_SIZE
+ * bytes with a millisecond timestamp; frames are dropped while the ring is full. The frames are captured as received,
+ * before the storm control. Combine with \ref cy_ecm_set_promiscuous_mode to capture the traffic to other stations.
+ *
+ * The network stack does not pass its frames through ECM on transmission; only the frames sent with
+ * \ref cy_ecm_raw_send are captured on Tx. One interface is captured at a time; starting a capture discards the
+ * frames not read from the previous one.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[in]   config     : Capture filter and options
+ *
+ * @return CY_RSLT_SUCCESS if the capture started; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_INVALID_FILTER \n
+ *             \ref CY_RSLT_ECM_BUSY \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_capture_start(cy_ecm_t ecm_handle, const cy_ecm_capture_config_t *config);
+
+/**
+ * Stops the packet capture of an interface. The frames already captured can still be read.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ *
+ * @return CY_RSLT_SUCCESS if the capture is stopped; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_capture_stop(cy_ecm_t ecm_handle);
+
+/**
+ * Reads the captured frames in pcap format and frees their space in the capture ring.
+ *
+ * The first read after \ref cy_ecm_capture_start returns the pcap file header; every read returns whole pcap
+ * records, as many as fit in the buffer. Concatenating the data of successive reads gives a pcap file, which can be
+ * written to a file system or streamed over a serial port to Wireshark.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  buffer     : Buffer filled with the pcap data
+ * @param[in]   size       : Size of the buffer; at least 24 bytes, and at least 16 bytes more than the longest captured frame
+ * @param[out]  length     : Number of bytes written to the buffer; 0 if no frame is pending
+ *
+ * @return CY_RSLT_SUCCESS if the data was read; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_capture_read(cy_ecm_t ecm_handle, uint8_t *buffer, uint32_t size, uint32_t *length);
+
+/**
+ * Retrieves the packet capture counters of the given interface.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  stats      : Pointer to a structure filled with the statistics on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the statistics were retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_get_capture_stats(cy_ecm_t ecm_handle, cy_ecm_capture_stats_t *stats);
+
+/**
+ * Mirrors the frames of an interface out of the other interface, for example to a laptop running Wireshark.
+ *
+ * The frames selected by the filter are copied to a Tx queue of the destination in the Ethernet interrupt context, up
+ * to the given rate, so that a busy source does not overload the CPU or the destination. Only the frames sent with
+ * \ref cy_ecm_raw_send are mirrored on Tx; the network stack does not pass its frames through ECM on transmission.
+ *
+ * The destination is dedicated to the mirror: it must be initialized with \ref cy_ecm_ethif_init, not connected, and
+ * in interrupt mode. While the mirror runs, \ref cy_ecm_connect, \ref cy_ecm_raw_send, and
+ * \ref cy_ecm_set_polled_mode fail with CY_RSLT_ECM_BUSY on the destination. The interrupt priority of the
+ * destination must be at least that of the source.
+ *
+ * @param[in]   ecm_handle : ECM handle of the source interface
+ * @param[in]   config     : Destination, filter, and rate limit
+ *
+ * @return CY_RSLT_SUCCESS if the mirror started; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_INVALID_FILTER \n
+ *             \ref CY_RSLT_ECM_BUSY \n
+ *             \ref CY_RSLT_ECM_NOT_SUPPORTED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_mirror_start(cy_ecm_t ecm_handle, const cy_ecm_mirror_config_t *config);
+
+/**
+ * Stops the port mirror of a source interface and releases its destination.
+ *
+ * @param[in]   ecm_handle : ECM handle of the source interface
+ *
+ * @return CY_RSLT_SUCCESS if the mirror is stopped; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_mirror_stop(cy_ecm_t ecm_handle);
+
+/**
+ * Retrieves the port mirroring counters of a source interface.
+ *
+ * @param[in]   ecm_handle : ECM handle of the source interface
+ * @param[out]  stats      : Pointer to a structure filled with the statistics on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the statistics were retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_get_mirror_stats(cy_ecm_t ecm_handle, cy_ecm_mirror_stats_t *stats);
+
+/**
+ * Configures the 802.1Q VLANs of an interface, for networks that carry several VLANs on one link.
+ *
+ * With the filter enabled, the received frames of the VLANs the interface is not a member of are dropped in the
+ * Ethernet interrupt context, before they reach the network stack or the raw frame handlers; their receive buffer is
+ * reused. Untagged and priority tagged frames belong to the port VLAN. Without a port VLAN, the MAC discards the
+ * untagged frames itself; the GEM has no VLAN ID filter, so the membership of the tagged frames is checked in software,
+ * at a constant cost per frame.
+ *
+ * The tag is stripped after the raw frame handlers have matched the frame, by moving the frame payload down by four
+ * bytes. The network stack has a single interface in the port VLAN, so with the tag removal enabled only the untagged
+ * frames and the frames of the port VLAN reach it; the frames of the other member VLANs are handed to the raw frame
+ * handlers with their tag, then dropped. The network stack transmits its frames without a tag, so its traffic is in the port VLAN of the link partner;
+ * only the frames sent with \ref cy_ecm_raw_send are tagged by ECM. Packet capture and port mirroring see the frames
+ * as received from the wire. The configuration is reset to VLAN unaware by \ref cy_ecm_ethif_init.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[in]   config     : VLAN configuration
+ *
+ * @return CY_RSLT_SUCCESS if the configuration was applied; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_set_vlan_config(cy_ecm_t ecm_handle, const cy_ecm_vlan_config_t *config);
+
+/**
+ * Adds or removes a VLAN of the interface for the VLAN filter. The port VLAN is always a member.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[in]   vlan_id    : VLAN ID from 1 to CY_ECM_VLAN_ID_MAX
+ * @param[in]   is_member  : true to add the VLAN; false to remove it
+ *
+ * @return CY_RSLT_SUCCESS if the membership was updated; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_set_vlan_member(cy_ecm_t ecm_handle, uint16_t vlan_id, bool is_member);
+
+/**
+ * Retrieves the VLAN configuration and counters of an interface.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  stats      : Pointer to a structure filled with the statistics on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the statistics were retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_get_vlan_stats(cy_ecm_t ecm_handle, cy_ecm_vlan_stats_t *stats);
+
+/**
+ * Maps the 802.1p priorities to the Rx and Tx queues of an interface, so that frames of a high priority are not held
+ * up or dropped behind bulk traffic.
+ *
+ * The received tagged frames are steered to the Rx queue of their priority code point by the type 2 screeners of the
+ * MAC; untagged frames always use queue 0. Each Rx queue has its own descriptor ring, so a burst on one queue does not
+ * drop the frames of the others. The driver empties the Rx queues one after the other, so a frame still waits for the
+ * frames already received on the queue being emptied.
+ *
+ * The Tx map is applied by \ref cy_ecm_raw_send_priority. The MAC sends from the highest numbered Tx queue that holds
+ * a frame, so a frame on queue 2 waits for at most the frame being sent. The network stack sends on queue 0.
+ *
+ * \ref cy_ecm_ethif_init maps every priority to queue 0, with a priority code point equal to the priority.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[in]   map        : Queues and priority code points of the priorities
+ *
+ * @return CY_RSLT_SUCCESS if the map was applied; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_set_priority_map(cy_ecm_t ecm_handle, const cy_ecm_priority_map_t *map);
+
+/**
+ * Retrieves the 802.1p priority map of an interface.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  map        : Pointer to a structure filled with the map on successful return
+ *
+ * @return CY_RSLT_SUCCESS if the map was retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_get_priority_map(cy_ecm_t ecm_handle, cy_ecm_priority_map_t *map);
+
+/**
+ * Transmits a complete Ethernet frame on the Tx queue of its priority, bypassing the network stack.
+ *
+ * The frame is sent as with \ref cy_ecm_raw_send, on the Tx queue that the priority map of the interface assigns to
+ * the priority. The priority code point of the map is written to the VLAN tag of a tagged frame, and to the tag that
+ * \ref cy_ecm_set_vlan_config inserts; an untagged frame is otherwise sent untagged. With CY_ECM_PRIORITY_DSCP, the
+ * priority is the class selector of the DSCP of an IPv4 or IPv6 frame, that is, its three most significant bits, and
+ * 0 for other frames.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[in]   frame      : Frame from the destination MAC address to the end of the payload, without FCS
+ * @param[in]   length     : Length of the frame; CY_ECM_RAW_FRAME_MIN_LEN to CY_ECM_RAW_FRAME_MAX_LEN
+ * @param[in]   priority   : Priority below CY_ECM_PRIORITY_COUNT, or CY_ECM_PRIORITY_DSCP
+ *
+ * @return CY_RSLT_SUCCESS if the frame was queued; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_BUSY \n
+ *             \ref CY_RSLT_ECM_LINK_DOWN \n
+ *             \ref CY_RSLT_ECM_ERROR
+ */
+cy_rslt_t cy_ecm_raw_send_priority(cy_ecm_t ecm_handle, const uint8_t *frame, uint32_t length, uint8_t priority);
+
+/**
+ * Adds a secondary IPv4 address to an interface.
+ *
+ * The interface answers ARP requests for the alias and accepts the IP traffic to it, in addition to its own address.
+ * Each alias is an lwIP network interface that shares the Ethernet port; lwIP finds the interface of an incoming IP
+ * frame by its destination address, so frames to the address of the interface take no additional processing. While
+ * aliases are attached, an ARP frame is checked against the alias addresses, and other frames take one EtherType
+ * comparison. An alias has no gateway, IGMP, or IPv6; a frame sent from the alias address to another subnet leaves
+ * through the default network interface.
+ *
+ * An alias added before \ref cy_ecm_connect is attached on connect and announced with a gratuitous ARP; aliases are kept
+ * across \ref cy_ecm_disconnect. Up to CY_ECM_IP_ALIAS_MAX aliases can be added per interface. The address must not
+ * be the address of a connected interface or an alias already added to either interface; an alias whose address an
+ * interface takes later is not attached on connect.
+ *
+ * \note Requires lwIP with LWIP_TCPIP_CORE_LOCKING, and MEMP_NUM_NETIF sized for the aliases when it limits the
+ *       network interfaces.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[in]   ip_addr    : IPv4 address of the alias
+ * @param[in]   netmask    : IPv4 netmask of the alias
+ *
+ * @return CY_RSLT_SUCCESS if the alias was added; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_ERROR_NOMEM \n
+ *             \ref CY_RSLT_ECM_INTERFACE_ERROR \n
+ *             \ref CY_RSLT_ECM_NOT_SUPPORTED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_add_ip_alias(cy_ecm_t ecm_handle, const cy_ecm_ip_address_t *ip_addr, const cy_ecm_ip_address_t *netmask);
+
+/**
+ * Removes a secondary IPv4 address added by \ref cy_ecm_add_ip_alias.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[in]   ip_addr    : IPv4 address of the alias
+ *
+ * @return CY_RSLT_SUCCESS if the alias was removed; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_NOT_SUPPORTED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_remove_ip_alias(cy_ecm_t ecm_handle, const cy_ecm_ip_address_t *ip_addr);
+
+/**
+ * Retrieves the secondary IPv4 addresses of an interface.
+ *
+ * @param[in]   ecm_handle : ECM handle created using \ref cy_ecm_ethif_init
+ * @param[out]  ip_addr    : Array filled with the addresses of the aliases on successful return
+ * @param[out]  count      : Number of aliases
+ *
+ * @return CY_RSLT_SUCCESS if the aliases were retrieved; an error code on failure.
+ *             Important error code related to this API function are: \n
+ *             \ref CY_RSLT_MODULE_ECM_BADARG \n
+ *             \ref CY_RSLT_MODULE_ECM_NOT_INITIALIZED \n
+ *             \ref CY_RSLT_ECM_MUTEX_ERROR
+ */
+cy_rslt_t cy_ecm_get_ip_aliases(cy_ecm_t ecm_handle, cy_ecm_ip_address_t ip_addr[CY_ECM_IP_ALIAS_MAX], uint32_t *count);
+
 /** \} group_ecm_functions */
 
 #ifdef __cplusplus
@@ -130,6 +130,22 @@ extern "C" {
 #define CY_RSLT_ECM_ERROR                                         (CY_RSLT_ECM_ERR_BASE + 24)
 /** Interface not supported */
 #define CY_RSLT_ECM_INTERFACE_NOT_SUPPORTED                       (CY_RSLT_ECM_ERR_BASE + 25)
+/** Ethernet link is down */
+#define CY_RSLT_ECM_LINK_DOWN                                     (CY_RSLT_ECM_ERR_BASE + 26)
+/** Interface is not suspended */
+#define CY_RSLT_ECM_NOT_SUSPENDED                                 (CY_RSLT_ECM_ERR_BASE + 27)
+/** MDIO frame did not complete in time */
+#define CY_RSLT_ECM_MDIO_TIMEOUT                                  (CY_RSLT_ECM_ERR_BASE + 28)
+/** No PHY found on the MDIO bus */
+#define CY_RSLT_ECM_PHY_NOT_FOUND                                 (CY_RSLT_ECM_ERR_BASE + 29)
+/** Operation not supported by the PHY driver */
+#define CY_RSLT_ECM_NOT_SUPPORTED                                 (CY_RSLT_ECM_ERR_BASE + 30)
+/** Operation in progress on the interface */
+#define CY_RSLT_ECM_BUSY                                          (CY_RSLT_ECM_ERR_BASE + 31)
+/** Interface not in polled mode */
+#define CY_RSLT_ECM_NOT_POLLED_MODE                               (CY_RSLT_ECM_ERR_BASE + 32)
+/** Capture filter program not valid */
+#define CY_RSLT_ECM_INVALID_FILTER                                (CY_RSLT_ECM_ERR_BASE + 33)
 
 /** \} Error codes */
 
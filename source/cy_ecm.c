@@ -57,6 +57,13 @@
 
 #include "cy_log.h"
 
+#if defined(COMPONENT_LWIP)
+#include "lwip/netif.h"
+#include "lwip/etharp.h"
+#include "lwip/tcpip.h"
+#include "lwip/pbuf.h"
+#endif
+
 /******************************************************
  *                      Macros
  ******************************************************/
@@ -67,7 +74,6 @@
 #endif
 
 #define DHCP_TIMEOUT_COUNT                          (6000) /* 6000 times */
-#define CY_ECM_ETH_INTERFACE_MAX                    (2)
 #define CY_POLL_ETHERNET_PHY_STATUS_TIME            (1000) /* Interval to poll the physical connection status in milliseconds*/
 #define WAIT_CHECK_ETHERNET_PHY_STATUS              (100) /* Interval to check the Ethernet PHY status in milliseconds. The driver takes ~1 second to update the register. */
 #define RETRY_WAIT_TIME_GET_IP_ADDR                 (10) /* Interval to check the IP address assigned for every 10ms */
@@ -79,6 +85,18 @@
 #endif
 #define CY_ECM_EVENT_THREAD_PRIORITY                (CY_RTOS_PRIORITY_NORMAL)
 
+/* RTOS objects of an interface outside its handle: the global ECM mutexes, the event thread handle, and the mutex and
+ * the semaphore of the MDIO bus of the interface */
+#define CY_ECM_RTOS_OBJECTS_SIZE                    ((2u * sizeof(cy_mutex_t)) + sizeof(cy_thread_t) + sizeof(cy_mutex_t) + sizeof(cy_semaphore_t))
+
+#if defined(CY_ECM_STATIC_ALLOCATION) && defined(COMPONENT_FREERTOS)
+/* The RTOS abstraction creates the mutexes and the semaphores in the memory of their cy_mutex_t and cy_semaphore_t
+ * objects, and the event thread in the static stack, only when FreeRTOS supports static allocation */
+#if !defined(configSUPPORT_STATIC_ALLOCATION) || (configSUPPORT_STATIC_ALLOCATION != 1)
+#error "CY_ECM_STATIC_ALLOCATION requires configSUPPORT_STATIC_ALLOCATION to be set to 1 in FreeRTOSConfig.h"
+#endif
+#endif
+
 /** Maximum number of callbacks that can be registered with the ECM library */
 #define CY_ECM_MAXIMUM_CALLBACKS_COUNT              (3)
 
@@ -90,31 +108,14 @@
 #define MAC_ADDR4                                (0x00U)
 #define MAC_ADDR5                                (0x00U)
 
-/******************************************************
- *             Structures
- ******************************************************/
-/*
- * Ethernet Connection Manager handle
- */
-
-typedef struct ecm_object
-{
-    cy_ecm_interface_t            eth_idx;
-    ETH_Type                     *eth_base_type;
-    cy_network_interface_context *iface_context;
-    cy_ecm_phy_callbacks_t        eth_phy_cb;
-    void*                         user_data;            /* Argument to be passed back to the user while invoking the callback */
-    bool                          isobjinitialized;     /* Indicates that the ECM object is initialized      */
-    cy_mutex_t                    obj_mutex;            /* Mutex to serialize object access in multi-threading mode  */
-    bool                          network_up;
-    uint8_t                       mac_address[CY_ECM_MAC_ADDR_LEN];
-} cy_ecm_object_t;
-
 /******************************************************
  *                 Static variables
  ******************************************************/
 static bool                     is_ecm_initialized = false;
 static cy_mutex_t               ecm_mutex;
+/* Serializes the event thread poll with the changes of the state it reads; held only for short sections that do not wait,
+ * so that a connect holding ecm_mutex does not stop the monitoring of the interfaces. Taken after ecm_mutex */
+static cy_mutex_t               ecm_poll_mutex;
 static cy_thread_t              ecm_event_thread = NULL;
 static cy_ecm_event_callback_t  ecm_event_handler[CY_ECM_MAXIMUM_CALLBACKS_COUNT];
 
@@ -129,9 +130,75 @@ static bool                    is_ethernet_link_up[CY_ECM_ETH_INTERFACE_MAX] = {
 /* ECM event thread create status */
 static uint8_t                 is_ecm_thread_created = 0;
 
+/* Initialized ECM objects, indexed by interface; monitored by the ECM event thread */
+static cy_ecm_object_t        *ecm_obj_list[CY_ECM_ETH_INTERFACE_MAX] = {0};
+
+#if defined(COMPONENT_LWIP) && LWIP_TCPIP_CORE_LOCKING
+#define ECM_IP_ALIAS_SUPPORTED
+#define ECM_ETHERTYPE_ARP                           (0x0806u)
+#define ECM_ARP_TARGET_IP_OFFSET                    (38u)  /* Ethernet header and the ARP fields before the target protocol address */
+
+/* Network interfaces of the IP aliases of a connected interface. An alias is an lwIP network interface that shares the
+ * Ethernet output of the interface; lwIP accepts the IP frames to its address through its interface lookup. The
+ * receive path reads the attached aliases without a lock: an alias is filled in before it is marked attached, and is
+ * only removed once the receive path is out of the input function */
+typedef struct
+{
+    struct netif                *primary;           /* Network interface added by cy_ecm_connect; NULL while not connected */
+    netif_input_fn               primary_input;     /* Input function of the primary interface, hooked while aliases are attached */
+    struct netif                 netif[CY_ECM_IP_ALIAS_MAX];
+    uint32_t                     address[CY_ECM_IP_ALIAS_MAX];  /* Alias addresses as read by the receive path */
+    volatile bool                is_attached[CY_ECM_IP_ALIAS_MAX];
+    uint32_t                     attached_count;
+    volatile uint32_t            input_seq;         /* Odd while the receive path is in the input function */
+} ecm_ip_alias_netifs_t;
+
+static ecm_ip_alias_netifs_t   ecm_ip_alias_netifs[CY_ECM_ETH_INTERFACE_MAX];
+#endif
+
+#ifdef CY_ECM_STATIC_ALLOCATION
+/* Per-interface object pool and event thread stack; used instead of the heap when CY_ECM_STATIC_ALLOCATION is defined */
+static cy_ecm_object_t         ecm_obj_pool[CY_ECM_ETH_INTERFACE_MAX];
+static uint64_t                ecm_event_thread_stack[CY_ECM_EVENT_THREAD_STACK_SIZE / sizeof(uint64_t)];
+#define CY_ECM_EVENT_THREAD_STACK                   ((void *)ecm_event_thread_stack)
+#else
+#define CY_ECM_EVENT_THREAD_STACK                   (NULL)
+#endif
+
 /******************************************************
  *                 Static functions
  ******************************************************/
+static void ecm_poll_lock( void )
+{
+    (void)cy_rtos_get_mutex( &ecm_poll_mutex, CY_RTOS_NEVER_TIMEOUT );
+}
+
+static void ecm_poll_unlock( void )
+{
+    (void)cy_rtos_set_mutex( &ecm_poll_mutex );
+}
+
+static cy_ecm_object_t *ecm_object_alloc( cy_ecm_interface_t eth_idx )
+{
+#ifdef CY_ECM_STATIC_ALLOCATION
+    /* The slot of an interface is free whenever is_ethernet_initiated[eth_idx] is false */
+    return &ecm_obj_pool[eth_idx];
+#else
+    CY_UNUSED_PARAMETER( eth_idx );
+    return ( cy_ecm_object_t * )malloc( sizeof( cy_ecm_object_t ) );
+#endif
+}
+
+static void ecm_object_free( cy_ecm_object_t *ecm_obj )
+{
+#ifdef CY_ECM_STATIC_ALLOCATION
+    /* Clearing the slot also invalidates stale handles, as isobjinitialized becomes false */
+    memset( ecm_obj, 0x00, sizeof( cy_ecm_object_t ) );
+#else
+    free( ecm_obj );
+#endif
+}
+
 static void invoke_app_callbacks( cy_ecm_event_t event_type, cy_ecm_event_data_t* arg )
 {
     int i = 0;
@@ -165,428 +232,3303 @@ static void ip_change_callback( cy_network_interface_context *iface_context, voi
     }
 }
 
-static void ecm_event_thread_func( cy_thread_arg_t arg )
+#ifdef ECM_IP_ALIAS_SUPPORTED
+/* Input function of the primary interface while aliases are attached; runs in the Ethernet receive context. An ARP
+ * frame for an alias is handed over to the alias, so that lwIP answers it with the alias address. The other frames
+ * take one EtherType comparison */
+static err_t ecm_ip_alias_input( struct pbuf *p, struct netif *inp )
 {
-    cy_rslt_t result = CY_RSLT_SUCCESS;
-    uint32_t linkstatus =0;
-    cy_ecm_phy_callbacks_t *phy_cb = (cy_ecm_phy_callbacks_t *)arg;
-
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+    ecm_ip_alias_netifs_t *aliases = NULL;
+    const uint8_t *frame = (const uint8_t *)p->payload;
+    uint32_t target;
+    uint32_t i;
 
-    while( true )
+    for( i = 0; i < CY_ECM_ETH_INTERFACE_MAX; i++ )
     {
-        if( is_ethernet_initiated[CY_ECM_INTERFACE_ETH0] == true )
+        if( ecm_ip_alias_netifs[i].primary == inp )
         {
-            // Read from the ETH0 register set
-            result = phy_cb->phy_get_linkstatus((uint8_t)CY_ECM_INTERFACE_ETH0, &linkstatus);
-            if(result == CY_RSLT_SUCCESS)
-            {
-                if(linkstatus == 1)
-                {
-                    if( is_ethernet_link_up[CY_ECM_INTERFACE_ETH0] == false )
-                    {
-                        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "get Link status : UP \n" );
-                        is_ethernet_link_up[CY_ECM_INTERFACE_ETH0] = true;
-
-                        /*Call the application callback function*/
-                        invoke_app_callbacks( CY_ECM_EVENT_CONNECTED, NULL );
-                    }
-                }
-                else
-                {
-                    if( is_ethernet_link_up[CY_ECM_INTERFACE_ETH0] == true )
-                    {
-                        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "get Link status : DOWN \n" );
-                        is_ethernet_link_up[CY_ECM_INTERFACE_ETH0] = false;
-                        /*Call the application callback function*/
-                        invoke_app_callbacks( CY_ECM_EVENT_DISCONNECTED, NULL );
-                    }
-                }
-            }
+            aliases = &ecm_ip_alias_netifs[i];
+            break;
         }
-        else if( is_ethernet_initiated[CY_ECM_INTERFACE_ETH1] == true )
+    }
+
+    if( aliases == NULL )
+    {
+        return ERR_ARG;
+    }
+
+    aliases->input_seq++;
+    __DMB();
+    if( ( p->len >= ( ECM_ARP_TARGET_IP_OFFSET + sizeof( target ) ) ) &&
+        ( frame[12] == (uint8_t)( ECM_ETHERTYPE_ARP >> 8 ) ) && ( frame[13] == (uint8_t)ECM_ETHERTYPE_ARP ) )
+    {
+        memcpy( &target, &frame[ECM_ARP_TARGET_IP_OFFSET], sizeof( target ) );
+        for( i = 0; i < CY_ECM_IP_ALIAS_MAX; i++ )
         {
-            //Read from the ETH1 register set
-            result = phy_cb->phy_get_linkstatus((uint8_t)CY_ECM_INTERFACE_ETH1, &linkstatus);
-            if(result == CY_RSLT_SUCCESS)
+            if( aliases->is_attached[i] && ( aliases->address[i] == target ) )
             {
-                if(linkstatus == 1)
-                {
-                    if( is_ethernet_link_up[CY_ECM_INTERFACE_ETH1] == false )
-                    {
-                        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "get Link status : UP \n" );
-                        is_ethernet_link_up[CY_ECM_INTERFACE_ETH1] = true;
-                        /*Call the application callback function*/
-                        invoke_app_callbacks( CY_ECM_EVENT_CONNECTED, NULL );
-                    }
-                }
-                else
-                {
-                    if( is_ethernet_link_up[CY_ECM_INTERFACE_ETH1] == true )
-                    {
-                        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "get Link status : DOWN \n" );
-                        is_ethernet_link_up[CY_ECM_INTERFACE_ETH1] = false;
-                        /*Call the application callback function*/
-                        invoke_app_callbacks( CY_ECM_EVENT_DISCONNECTED, NULL );
-                    }
-                }
+                inp = &aliases->netif[i];
+                break;
             }
         }
-        cy_rtos_delay_milliseconds( CY_POLL_ETHERNET_PHY_STATUS_TIME );
+    }
+    __DMB();
+    aliases->input_seq++;
+
+    return aliases->primary_input( p, inp );
+}
+
+/* Waits until the receive path is out of the input function, if it was in it; the detached aliases are then no longer read */
+static void ecm_ip_alias_wait_grace( ecm_ip_alias_netifs_t *aliases )
+{
+    uint32_t seq = aliases->input_seq;
+
+    while( ( ( seq & 1u ) != 0u ) && ( aliases->input_seq == seq ) )
+    {
+        cy_rtos_delay_milliseconds( 1 );
     }
 }
 
-cy_rslt_t cy_ecm_init( void )
+/* Called by netif_add(); the state passed in is the primary interface, whose Ethernet output the alias shares */
+static err_t ecm_ip_alias_netif_init( struct netif *netif )
 {
-    cy_rslt_t result = CY_RSLT_SUCCESS;
+    struct netif *primary = (struct netif *)netif->state;
+
+    netif->name[0]    = 'e';
+    netif->name[1]    = 'a';
+    netif->state      = primary->state;
+    netif->output     = etharp_output;
+    netif->linkoutput = primary->linkoutput;
+    netif->mtu        = primary->mtu;
+    netif->hwaddr_len = primary->hwaddr_len;
+    memcpy( netif->hwaddr, primary->hwaddr, sizeof( netif->hwaddr ) );
+    /* No IGMP or IPv6 on an alias; the primary interface already joins the groups of the link */
+    netif->flags      = (uint8_t)( primary->flags & ( NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_ETHERNET ) );
+
+    return ERR_OK;
+}
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+/* Adds the network interface of an alias; called with the lwIP core lock held */
+static bool ecm_ip_alias_attach( ecm_ip_alias_netifs_t *aliases, uint32_t index, const ecm_ip_alias_t *alias )
+{
+    ip4_addr_t address, netmask, gateway;
 
-    if( is_ecm_initialized )
+    address.addr = alias->address;
+    netmask.addr = alias->netmask;
+    gateway.addr = 0;
+    if( netif_add( &aliases->netif[index], &address, &netmask, &gateway, aliases->primary, ecm_ip_alias_netif_init, tcpip_input ) == NULL )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM Library is already initialized \n" );
-        return CY_RSLT_ECM_INIT_ERROR;
+        return false;
     }
 
-    /** Initialize the network stack **/
-    if( !is_tcp_initialized )
+    aliases->address[index] = alias->address;
+    __DMB();
+    aliases->is_attached[index] = true;
+    if( aliases->attached_count++ == 0u )
     {
-        result = cy_network_init();
-        if( result != CY_RSLT_SUCCESS )
-        {
-            return CY_RSLT_ECM_NW_INIT_ERROR;
-        }
-        is_tcp_initialized = true;
+        aliases->primary_input = aliases->primary->input;
+        __DMB();
+        aliases->primary->input = ecm_ip_alias_input;
     }
 
-    result = cy_rtos_init_mutex2( &ecm_mutex, false );
-    if( result != CY_RSLT_SUCCESS )
+    /* Once up with the link, lwIP announces the alias with a gratuitous ARP */
+    netif_set_up( &aliases->netif[index] );
+    if( netif_is_link_up( aliases->primary ) )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Creating new mutex failed with result = 0x%X\n", (unsigned long)result );
-        is_tcp_initialized = false;
-        result = CY_RSLT_ECM_MUTEX_ERROR;
-        goto exit;
+        netif_set_link_up( &aliases->netif[index] );
     }
+    return true;
+}
 
-     is_ecm_initialized = true;
+/* Removes the network interface of an alias; called with the lwIP core lock held */
+static void ecm_ip_alias_detach( ecm_ip_alias_netifs_t *aliases, uint32_t index )
+{
+    aliases->is_attached[index] = false;
+    if( --aliases->attached_count == 0u )
+    {
+        aliases->primary->input = aliases->primary_input;
+    }
+    __DMB();
+    ecm_ip_alias_wait_grace( aliases );
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+    netif_set_down( &aliases->netif[index] );
+    netif_remove( &aliases->netif[index] );
+}
 
-    return result;
+/* Attaches the aliases of an interface once cy_ecm_connect has added its network interface */
+static void ecm_ip_alias_connect( cy_ecm_object_t *ecm_obj )
+{
+    ecm_ip_alias_netifs_t *aliases = &ecm_ip_alias_netifs[ecm_obj->eth_idx];
 
-exit:
-    if( !is_tcp_initialized )
+    aliases->primary = (struct netif *)cy_network_get_nw_interface( CY_NETWORK_ETH_INTERFACE, (uint8_t)ecm_obj->eth_idx );
+    if( aliases->primary == NULL )
     {
-        (void)cy_network_deinit();
+        return;
     }
-    return result;
+
+    LOCK_TCPIP_CORE();
+    for( uint32_t i = 0; i < CY_ECM_IP_ALIAS_MAX; i++ )
+    {
+        if( !ecm_obj->ip_alias[i].is_used )
+        {
+            continue;
+        }
+        /* A static address of the interface may have been set to an alias address since the alias was added */
+        if( ecm_obj->ip_alias[i].address == netif_ip4_addr( aliases->primary )->addr )
+        {
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "IP alias %u is the address of the interface; not attached \n", (unsigned int)i );
+            continue;
+        }
+        if( !ecm_ip_alias_attach( aliases, i, &ecm_obj->ip_alias[i] ) )
+        {
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to add the network interface of IP alias %u \n", (unsigned int)i );
+        }
+    }
+    UNLOCK_TCPIP_CORE();
 }
 
-cy_rslt_t cy_ecm_deinit( void )
+/* Detaches the aliases of an interface before cy_ecm_disconnect removes its network interface */
+static void ecm_ip_alias_disconnect( cy_ecm_object_t *ecm_obj )
 {
-    cy_rslt_t result = CY_RSLT_SUCCESS;
+    ecm_ip_alias_netifs_t *aliases = &ecm_ip_alias_netifs[ecm_obj->eth_idx];
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+    if( aliases->primary == NULL )
+    {
+        return;
+    }
 
-    if( !is_ecm_initialized )
+    LOCK_TCPIP_CORE();
+    for( uint32_t i = 0; i < CY_ECM_IP_ALIAS_MAX; i++ )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Ethernet connection manager Library is not initialized (or) already de-initialized\n" );
-        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        if( aliases->is_attached[i] )
+        {
+            ecm_ip_alias_detach( aliases, i );
+        }
     }
-    else
+    UNLOCK_TCPIP_CORE();
+    aliases->primary = NULL;
+}
+#endif
+
+#if defined(COMPONENT_LWIP)
+/* Runs in the lwIP TCP/IP thread */
+static void ecm_lwip_netif_link_up( struct netif *netif )
+{
+    /* Neighbors may have moved or changed their addresses while the link was down */
+    etharp_cleanup_netif( netif );
+
+    /* A link flap shorter than the poll interval is not seen as link down; replay the transition */
+    if( netif_is_link_up( netif ) )
     {
-        is_ecm_initialized = false;
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "De-initialize ethernet connection manager library\n" );
+        netif_set_link_down( netif );
+    }
 
-        is_tcp_initialized = false;
+    /* On link up, lwIP moves a bound DHCP client to INIT-REBOOT and announces the current address with a gratuitous ARP */
+    netif_set_link_up( netif );
+}
 
-        (void)cy_network_deinit(); /* Fall through */
-        cy_rtos_deinit_mutex( &ecm_mutex );
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Global Mutex Deinit..!\n" );
+/* Runs in the lwIP TCP/IP thread; the IP aliases follow the link of their interface */
+static void ecm_lwip_link_changed( struct netif *netif, bool is_link_up )
+{
+    if( is_link_up )
+    {
+        ecm_lwip_netif_link_up( netif );
+    }
+    else
+    {
+        netif_set_link_down( netif );
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+#ifdef ECM_IP_ALIAS_SUPPORTED
+    for( uint32_t i = 0; i < CY_ECM_ETH_INTERFACE_MAX; i++ )
+    {
+        if( ecm_ip_alias_netifs[i].primary != netif )
+        {
+            continue;
+        }
+        for( uint32_t j = 0; j < CY_ECM_IP_ALIAS_MAX; j++ )
+        {
+            if( !ecm_ip_alias_netifs[i].is_attached[j] )
+            {
+                continue;
+            }
+            if( is_link_up )
+            {
+                ecm_lwip_netif_link_up( &ecm_ip_alias_netifs[i].netif[j] );
+            }
+            else
+            {
+                netif_set_link_down( &ecm_ip_alias_netifs[i].netif[j] );
+            }
+        }
+    }
+#endif
+}
 
-    return result;
+/* Runs in the lwIP TCP/IP thread */
+static void ecm_lwip_link_down( void *arg )
+{
+    ecm_lwip_link_changed( (struct netif *)arg, false );
 }
 
-cy_rslt_t cy_ecm_ethif_init( cy_ecm_interface_t eth_idx,
-                             cy_ecm_phy_callbacks_t *phy_callbacks,
-                             cy_ecm_t *ecm_handle )
+/* Runs in the lwIP TCP/IP thread */
+static void ecm_lwip_link_up( void *arg )
 {
-    cy_rslt_t                     result = CY_RSLT_SUCCESS;
-    cy_ecm_object_t              *ecm_obj       = NULL;
-    bool                          obj_mutex_init_status = false;
-    cy_ecm_phy_config_t           phy_interface_type;
+    ecm_lwip_link_changed( (struct netif *)arg, true );
+}
+#endif
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+/* Propagates a link change of a connected interface to the network stack; called with the global lock held */
+static void ecm_network_link_changed( cy_ecm_object_t *ecm_obj, bool is_link_up )
+{
+#if defined(COMPONENT_LWIP)
+    struct netif *netif;
 
-    if( ecm_handle == NULL || eth_idx >= CY_ECM_INTERFACE_INVALID )
+    netif = (struct netif *)cy_network_get_nw_interface( CY_NETWORK_ETH_INTERFACE, (uint8_t)ecm_obj->eth_idx );
+    if( netif == NULL )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid arguments passed \n" );
-        return CY_RSLT_MODULE_ECM_BADARG;
+        return;
     }
 
-    if( eth_idx == CY_ECM_INTERFACE_ETH1 )
+    if( tcpip_callback( ( is_link_up == true ) ? ecm_lwip_link_up : ecm_lwip_link_down, netif ) != ERR_OK )
     {
-#if !(defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
-        return CY_RSLT_MODULE_ECM_BADARG;
-#else
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\n Ethernet interface 1 is enabled in configurator \n" );
-#endif
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to post the link change to the network stack \n" );
     }
-    else
-    {
-#if !(defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
-        return CY_RSLT_MODULE_ECM_BADARG;
 #else
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\n Ethernet interface 0 is enabled in configurator \n" );
-#endif
+    /* Without access to the stack internals, restart DHCP; static addresses are announced by the stack on its own */
+    if( ( is_link_up == true ) && ( ecm_obj->is_static_ip == false ) )
+    {
+        if( cy_network_dhcp_renew( ecm_obj->iface_context ) != CY_RSLT_SUCCESS )
+        {
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "DHCP renew after link up failed \n" );
+        }
     }
+#endif
+}
 
-    if( phy_callbacks == NULL )
+static void ecm_recovery_start( cy_ecm_object_t *ecm_obj )
+{
+    if( cy_rtos_get_time( &ecm_obj->link_up_time ) != CY_RSLT_SUCCESS )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid arguments passed \n" );
-        return CY_RSLT_MODULE_ECM_BADARG;
+        ecm_obj->link_up_time = 0;
     }
-    else
+    ecm_obj->recovery_pending = true;
+    ecm_obj->recovery_stats.link_up_count++;
+
+    cy_eth_rx_timestamp_arm( ecm_obj->eth_idx, true );
+    ecm_network_link_changed( ecm_obj, true );
+}
+
+static void ecm_recovery_stop( cy_ecm_object_t *ecm_obj )
+{
+    ecm_obj->recovery_pending = false;
+    cy_eth_rx_timestamp_arm( ecm_obj->eth_idx, false );
+}
+
+/* Completes a pending recovery once traffic is received; returns true if the recovery completed */
+static bool ecm_recovery_check( cy_ecm_object_t *ecm_obj, cy_ecm_recovery_info_t *info )
+{
+    cy_ecm_recovery_stats_t *stats = &ecm_obj->recovery_stats;
+    cy_time_t now = 0;
+    uint32_t elapsed;
+
+    if( cy_eth_rx_timestamp_get( ecm_obj->eth_idx, &now ) == true )
     {
-        if( (phy_callbacks->phy_init == NULL) || (phy_callbacks->phy_configure == NULL) ||
-            (phy_callbacks->phy_discover == NULL) || (phy_callbacks->phy_enable_ext_reg == NULL) ||
-            (phy_callbacks->phy_get_auto_neg_status == NULL) || (phy_callbacks->phy_get_link_partner_cap == NULL) ||
-            (phy_callbacks->phy_get_linkspeed == NULL) || (phy_callbacks->phy_get_linkstatus == NULL) ||
-            (phy_callbacks->phy_reset == NULL) )
+        elapsed = (uint32_t)( now - ecm_obj->link_up_time );
+        ecm_recovery_stop( ecm_obj );
+
+        stats->recovered_count++;
+        stats->last_time_to_traffic_ms = elapsed;
+        if( elapsed > stats->max_time_to_traffic_ms )
         {
-            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid arguments passed \n" );
-            return CY_RSLT_MODULE_ECM_BADARG;
+            stats->max_time_to_traffic_ms = elapsed;
         }
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Traffic resumed %u ms after link up \n", (unsigned int)elapsed );
+
+        info->eth_idx = ecm_obj->eth_idx;
+        info->time_to_traffic_ms = elapsed;
+        return true;
     }
 
-    if( !is_ecm_initialized )
+    (void)cy_rtos_get_time( &now );
+    if( (uint32_t)( now - ecm_obj->link_up_time ) >= CY_ECM_NETWORK_RECOVERY_TIMEOUT_MS )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
-        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_WARNING, "No traffic within %u ms after link up \n", (unsigned int)CY_ECM_NETWORK_RECOVERY_TIMEOUT_MS );
+        ecm_recovery_stop( ecm_obj );
+        stats->timeout_count++;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
-    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
-    if( result != CY_RSLT_SUCCESS )
+    return false;
+}
+
+/* Samples the error counters once per interval; returns true if the score crossed a threshold */
+static bool ecm_link_quality_sample( cy_ecm_object_t *ecm_obj, cy_ecm_link_quality_t *info )
+{
+    ecm_link_quality_t *lq = &ecm_obj->link_quality;
+    cy_eth_mac_counters_t mac;
+    cy_ecm_phy_quality_t phy;
+    cy_time_t now = 0;
+
+    (void)cy_rtos_get_time( &now );
+
+    /* The counters of the previous link are discarded, and the score restarts from 100 */
+    if( lq->is_started == false )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
-        return CY_RSLT_ECM_MUTEX_ERROR;
+        cy_eth_get_mac_counters( ecm_obj->eth_idx, &mac );
+        lq->is_started = true;
+        lq->last_sample_time = now;
+        lq->mac_prev = mac;
+        lq->score_q8 = ( 100 << 8 );
+        lq->info.score = 100;
+        lq->info.is_degraded = false;
+        lq->info.sqi = CY_ECM_SQI_UNKNOWN;
+        return false;
     }
 
-    //Check whether the Ethernet interface is already initialized
-    if( is_ethernet_initiated[eth_idx] == true )
+    if( (uint32_t)( now - lq->last_sample_time ) < CY_ECM_LINK_QUALITY_INTERVAL_MS )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM interface is already initialized for eth_idx: [%d] \n",eth_idx );
-        result = CY_RSLT_ECM_INIT_ERROR;
-        goto exit;
+        return false;
     }
+    lq->last_sample_time = now;
 
-    ecm_obj = ( cy_ecm_object_t * )malloc( sizeof( cy_ecm_object_t ) );
-    if( ecm_obj == NULL )
+    cy_eth_get_mac_counters( ecm_obj->eth_idx, &mac );
+
+    phy.sqi = CY_ECM_SQI_UNKNOWN;
+    phy.rx_errors = 0;
+    if( ecm_obj->eth_phy_cb->phy_get_quality != NULL )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\nMalloc for ECM handle failed..!\n" );
-        result = CY_RSLT_ECM_ERROR_NOMEM;
-        goto exit;
+        if( ecm_obj->eth_phy_cb->phy_get_quality( (uint8_t)ecm_obj->eth_idx, &phy ) != CY_RSLT_SUCCESS )
+        {
+            phy.sqi = CY_ECM_SQI_UNKNOWN;
+            phy.rx_errors = 0;
+        }
+        else if( ( phy.sqi != CY_ECM_SQI_UNKNOWN ) && ( phy.sqi > 100 ) )
+        {
+            phy.sqi = 100;
+        }
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\necm_obj : %p..!\n", ecm_obj );
-    memset( ecm_obj, 0x00, sizeof( cy_ecm_object_t ) );
 
-    result = cy_rtos_init_mutex2( &(ecm_obj->obj_mutex), true );
-    if( result != CY_RSLT_SUCCESS )
+    if( cy_eth_link_quality_update( lq, &mac, &phy ) == false )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Creating new mutex failed with result = 0x%X\n", (unsigned long)result );
-        result = CY_RSLT_ECM_MUTEX_ERROR;
-        goto exit;
+        return false;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nobj_mutex created!\n" );
 
-    eth_index_internal = eth_idx;
+    if( lq->info.is_degraded == true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_WARNING, "Link quality degraded, score %u \n", (unsigned int)lq->info.score );
+    }
+    else
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Link quality restored, score %u \n", (unsigned int)lq->info.score );
+    }
+    *info = lq->info;
+    return true;
+}
 
-    obj_mutex_init_status = true;
-    ecm_obj->isobjinitialized = true;
-    ecm_obj->eth_idx = eth_idx;
-    ecm_obj->eth_base_type = ETH_INTERFACE_TYPE;
-    ecm_obj->network_up = false;
-    ecm_obj->iface_context = NULL;
+/* Makes the MAC follow the duplex negotiated by the PHY */
+static void ecm_duplex_resync_mac( cy_ecm_object_t *ecm_obj )
+{
+    uint32_t duplex = 0, speed = 0;
 
-    /* Callbacks */
-    ecm_obj->eth_phy_cb.phy_init = phy_callbacks->phy_init;
-    ecm_obj->eth_phy_cb.phy_configure = phy_callbacks->phy_configure;
-    ecm_obj->eth_phy_cb.phy_reset = phy_callbacks->phy_reset;
-    ecm_obj->eth_phy_cb.phy_discover = phy_callbacks->phy_discover;
-    ecm_obj->eth_phy_cb.phy_enable_ext_reg = phy_callbacks->phy_enable_ext_reg;
-    ecm_obj->eth_phy_cb.phy_get_auto_neg_status = phy_callbacks->phy_get_auto_neg_status;
-    ecm_obj->eth_phy_cb.phy_get_link_partner_cap = phy_callbacks->phy_get_link_partner_cap;
-    ecm_obj->eth_phy_cb.phy_get_linkspeed = phy_callbacks->phy_get_linkspeed;
-    ecm_obj->eth_phy_cb.phy_get_linkstatus = phy_callbacks->phy_get_linkstatus;
+    if( ecm_obj->eth_phy_cb->phy_get_linkspeed( (uint8_t)ecm_obj->eth_idx, &duplex, &speed ) == CY_RSLT_SUCCESS )
+    {
+        cy_eth_set_mac_full_duplex( ecm_obj->eth_idx, ( duplex == (uint32_t)CY_ECM_DUPLEX_FULL ) );
+    }
+}
+
+static void ecm_duplex_mismatch_act( cy_ecm_object_t *ecm_obj )
+{
+    ecm_duplex_monitor_t *dm = &ecm_obj->duplex_monitor;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t duplex = 0, speed = 0;
+
+    switch( dm->action )
+    {
+        case CY_ECM_DUPLEX_MISMATCH_ACTION_RESTART_AUTONEG:
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Restarting autonegotiation \n" );
+            if( ecm_obj->eth_phy_cb->phy_reset != NULL )
+            {
+                (void)ecm_obj->eth_phy_cb->phy_reset( (uint8_t)ecm_obj->eth_idx, ecm_obj->eth_base_type );
+            }
+            result = ecm_obj->eth_phy_cb->phy_configure( (uint8_t)ecm_obj->eth_idx, (uint32_t)CY_ECM_DUPLEX_AUTO, (uint32_t)CY_ECM_PHY_SPEED_AUTO );
+            dm->is_resync_pending = ( result == CY_RSLT_SUCCESS );
+            break;
+
+        case CY_ECM_DUPLEX_MISMATCH_ACTION_FORCE_DUPLEX:
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Forcing %s duplex \n", ( dm->forced_duplex == CY_ECM_DUPLEX_FULL ) ? "full" : "half" );
+            result = ecm_obj->eth_phy_cb->phy_get_linkspeed( (uint8_t)ecm_obj->eth_idx, &duplex, &speed );
+            if( result == CY_RSLT_SUCCESS )
+            {
+                result = ecm_obj->eth_phy_cb->phy_configure( (uint8_t)ecm_obj->eth_idx, (uint32_t)dm->forced_duplex, speed );
+            }
+            if( result == CY_RSLT_SUCCESS )
+            {
+                cy_eth_set_mac_full_duplex( ecm_obj->eth_idx, ( dm->forced_duplex == CY_ECM_DUPLEX_FULL ) );
+            }
+            break;
+
+        default:
+            return;
+    }
+
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Duplex mismatch action failed with result = 0x%X\n", (unsigned long)result );
+        return;
+    }
+    dm->stats.action_count++;
+    dm->stats.last_action = dm->action;
+}
+
+/* Samples the collision counters once per interval; returns true if a duplex mismatch is newly detected */
+static bool ecm_duplex_check( cy_ecm_object_t *ecm_obj, cy_ecm_duplex_stats_t *info )
+{
+    ecm_duplex_monitor_t *dm = &ecm_obj->duplex_monitor;
+    cy_eth_mac_counters_t mac;
+    cy_time_t now = 0;
+
+    (void)cy_rtos_get_time( &now );
+
+    if( dm->is_started == false )
+    {
+        if( dm->is_resync_pending == true )
+        {
+            dm->is_resync_pending = false;
+            ecm_duplex_resync_mac( ecm_obj );
+        }
+        cy_eth_get_mac_counters( ecm_obj->eth_idx, &mac );
+        dm->is_started = true;
+        dm->is_reported = false;
+        dm->last_sample_time = now;
+        dm->mac_prev = mac;
+        return false;
+    }
+
+    if( (uint32_t)( now - dm->last_sample_time ) < CY_ECM_DUPLEX_MISMATCH_INTERVAL_MS )
+    {
+        return false;
+    }
+    dm->last_sample_time = now;
+
+    cy_eth_get_mac_counters( ecm_obj->eth_idx, &mac );
+    if( cy_eth_duplex_mismatch_update( dm, &mac ) == false )
+    {
+        return false;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_WARNING, "Duplex mismatch suspected: %u late collisions, %u retry limit errors in total \n",
+                    (unsigned int)dm->stats.late_collisions, (unsigned int)dm->stats.excessive_collisions );
+
+    ecm_duplex_mismatch_act( ecm_obj );
+
+    dm->stats.mac_duplex = cy_eth_get_mac_full_duplex( ecm_obj->eth_idx ) ? CY_ECM_DUPLEX_FULL : CY_ECM_DUPLEX_HALF;
+    *info = dm->stats;
+    return true;
+}
+
+/* Falls back to a more conservative Tx DMA setting on repeated underruns */
+static void ecm_tx_underrun_check( cy_ecm_object_t *ecm_obj )
+{
+    ecm_tx_monitor_t *tm = &ecm_obj->tx_monitor;
+    cy_eth_mac_counters_t mac;
+    cy_time_t now = 0;
+    cy_rslt_t result;
+
+    if( tm->is_restore_pending == true )
+    {
+        if( cy_eth_tx_restore_burst( ecm_obj->eth_idx ) != CY_RSLT_ECM_BUSY )
+        {
+            tm->is_restore_pending = false;
+        }
+        return;
+    }
+
+    if( tm->is_fallback_pending == true )
+    {
+        result = cy_eth_tx_fallback( ecm_obj->eth_idx );
+        if( result != CY_RSLT_ECM_BUSY )
+        {
+            tm->is_fallback_pending = false;
+            if( result == CY_RSLT_SUCCESS )
+            {
+                tm->fallback_count++;
+            }
+        }
+        return;
+    }
+
+    (void)cy_rtos_get_time( &now );
+    if( (uint32_t)( now - tm->last_sample_time ) < CY_ECM_TX_UNDERRUN_INTERVAL_MS )
+    {
+        return;
+    }
+    tm->last_sample_time = now;
+
+    cy_eth_get_mac_counters( ecm_obj->eth_idx, &mac );
+    if( ( mac.tx_underruns - tm->underruns_prev ) >= CY_ECM_TX_UNDERRUN_THRESHOLD )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_WARNING, "%u Tx underruns in %u ms \n",
+                        (unsigned int)( mac.tx_underruns - tm->underruns_prev ), (unsigned int)CY_ECM_TX_UNDERRUN_INTERVAL_MS );
+        tm->is_fallback_pending = ( CY_ECM_TX_FALLBACK_ENABLE != 0u );
+    }
+    tm->underruns_prev = mac.tx_underruns;
+}
+
+/* Fills the storm control limits and counters, with the storm state last reported */
+static void ecm_storm_fill_stats( cy_ecm_object_t *ecm_obj, cy_ecm_storm_stats_t *stats )
+{
+    cy_eth_get_storm_stats( ecm_obj->eth_idx, stats );
+    stats->storm_class = CY_ECM_STORM_BROADCAST;
+    for( uint32_t i = 0; i < CY_ECM_STORM_CLASS_COUNT; i++ )
+    {
+        stats->is_storm[i]    = ecm_obj->storm_monitor.is_storm[i];
+        stats->storm_count[i] = ecm_obj->storm_monitor.storm_count[i];
+    }
+}
+
+/* A storm starts at the first frame dropped by the storm control, and ends after an interval without a drop.
+ * Returns true if a class changed state; the other changes are reported on the next polls */
+static bool ecm_storm_check( cy_ecm_object_t *ecm_obj, cy_ecm_storm_stats_t *info )
+{
+    cy_ecm_storm_stats_t stats;
+    cy_ecm_storm_class_t storm_class;
+    cy_time_t now = 0;
+
+    (void)cy_rtos_get_time( &now );
+    cy_eth_get_storm_stats( ecm_obj->eth_idx, &stats );
+
+    if( cy_eth_storm_update( &ecm_obj->storm_monitor, stats.dropped, now, &storm_class ) == false )
+    {
+        return false;
+    }
+
+    if( ecm_obj->storm_monitor.is_storm[storm_class] == true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_WARNING, "Storm of class %u on eth_idx: [%d]; limited to %u frames/s \n",
+                        (unsigned int)storm_class, ecm_obj->eth_idx, (unsigned int)stats.rate[storm_class] );
+    }
+    ecm_storm_fill_stats( ecm_obj, info );
+    info->storm_class = storm_class;
+    return true;
+}
+
+static bool ecm_check_link_status( cy_ecm_interface_t eth_idx, cy_ecm_event_t *event, cy_ecm_event_data_t *event_data, bool *is_recovering,
+                                   bool *is_tx_halting )
+{
+    cy_ecm_object_t *ecm_obj;
+    uint32_t linkstatus = 0;
+    bool is_changed = false;
+
+    /* The poll lock keeps the object alive while it is polled; it is not held while the application callbacks run. The
+     * global lock is not taken, as cy_ecm_connect holds it while it waits for the link and DHCP */
+    ecm_poll_lock();
+
+    ecm_obj = ecm_obj_list[eth_idx];
+    if( ( ecm_obj != NULL ) && ( is_ethernet_initiated[eth_idx] == true ) && ( ecm_obj->is_diag_running == false ) )
+    {
+        cy_eth_mdio_new_cycle( eth_idx );
+        if( ecm_obj->eth_phy_cb->phy_get_linkstatus( (uint8_t)eth_idx, &linkstatus ) == CY_RSLT_SUCCESS )
+        {
+            if( ( linkstatus == 1 ) && ( is_ethernet_link_up[eth_idx] == false ) )
+            {
+                cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "get Link status : UP \n" );
+                is_ethernet_link_up[eth_idx] = true;
+                ecm_obj->link_quality.is_started = false;
+                ecm_obj->duplex_monitor.is_started = false;
+                /* A reduced DMA burst also slows the Rx DMA; it is given back on a new link */
+                ecm_obj->tx_monitor.is_restore_pending = true;
+                ecm_obj->tx_monitor.is_fallback_pending = false;
+                /* A suspended interface is recovered by cy_ecm_resume */
+                if( ( ecm_obj->network_up == true ) && ( ecm_obj->is_suspended == false ) )
+                {
+                    ecm_recovery_start( ecm_obj );
+                }
+                *event = CY_ECM_EVENT_CONNECTED;
+                is_changed = true;
+            }
+            else if( ( linkstatus != 1 ) && ( is_ethernet_link_up[eth_idx] == true ) )
+            {
+                cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "get Link status : DOWN \n" );
+                is_ethernet_link_up[eth_idx] = false;
+                if( ( ecm_obj->network_up == true ) && ( ecm_obj->is_suspended == false ) )
+                {
+                    ecm_recovery_stop( ecm_obj );
+                    ecm_network_link_changed( ecm_obj, false );
+                }
+                *event = CY_ECM_EVENT_DISCONNECTED;
+                is_changed = true;
+            }
+        }
+
+        if( ( is_changed == false ) && ( ecm_obj->recovery_pending == true ) )
+        {
+            if( ecm_recovery_check( ecm_obj, &event_data->recovery ) == true )
+            {
+                *event = CY_ECM_EVENT_NETWORK_RECOVERED;
+                is_changed = true;
+            }
+        }
+
+        if( ( is_changed == false ) && ( is_ethernet_link_up[eth_idx] == true ) )
+        {
+            if( ecm_link_quality_sample( ecm_obj, &event_data->quality ) == true )
+            {
+                *event = ( event_data->quality.is_degraded == true ) ? CY_ECM_EVENT_LINK_DEGRADED : CY_ECM_EVENT_LINK_QUALITY_RESTORED;
+                is_changed = true;
+            }
+        }
+
+        if( ( is_changed == false ) && ( is_ethernet_link_up[eth_idx] == true ) )
+        {
+            if( ecm_duplex_check( ecm_obj, &event_data->duplex ) == true )
+            {
+                *event = CY_ECM_EVENT_DUPLEX_MISMATCH;
+                is_changed = true;
+            }
+        }
+
+        if( is_changed == false )
+        {
+            if( ecm_storm_check( ecm_obj, &event_data->storm ) == true )
+            {
+                *event = ( event_data->storm.is_storm[event_data->storm.storm_class] == true ) ? CY_ECM_EVENT_STORM_START : CY_ECM_EVENT_STORM_END;
+                is_changed = true;
+            }
+        }
+
+        if( is_ethernet_link_up[eth_idx] == true )
+        {
+            ecm_tx_underrun_check( ecm_obj );
+            *is_tx_halting = ( *is_tx_halting || cy_eth_tx_is_halting( eth_idx ) );
+        }
+
+        *is_recovering = ( *is_recovering || ecm_obj->recovery_pending );
+    }
+
+    ecm_poll_unlock();
+
+    return is_changed;
+}
+
+static void ecm_event_thread_func( cy_thread_arg_t arg )
+{
+    cy_ecm_event_t event;
+    cy_ecm_event_data_t event_data;
+    bool is_recovering;
+    bool is_tx_halting;
+    int eth_idx;
+
+    CY_UNUSED_PARAMETER( arg );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    while( true )
+    {
+        is_recovering = false;
+        is_tx_halting = false;
+        for( eth_idx = CY_ECM_INTERFACE_ETH0; eth_idx < CY_ECM_ETH_INTERFACE_MAX; eth_idx++ )
+        {
+            memset( &event_data, 0, sizeof( event_data ) );
+            if( ecm_check_link_status( (cy_ecm_interface_t)eth_idx, &event, &event_data, &is_recovering, &is_tx_halting ) == true )
+            {
+                /*Call the application callback function*/
+                invoke_app_callbacks( event, ( ( event == CY_ECM_EVENT_CONNECTED ) || ( event == CY_ECM_EVENT_DISCONNECTED ) ) ? NULL : &event_data );
+            }
+        }
+        /* Poll faster while a recovery is pending; the time to traffic itself is timestamped on reception. A halted
+         * transmitter holds back the queued frames, so the end of the frame in progress is checked at a short pace */
+        if( is_tx_halting == true )
+        {
+            cy_rtos_delay_milliseconds( CY_ETH_TX_HALT_CHECK_MS );
+        }
+        else
+        {
+            cy_rtos_delay_milliseconds( is_recovering ? WAIT_CHECK_ETHERNET_PHY_STATUS : CY_POLL_ETHERNET_PHY_STATUS_TIME );
+        }
+    }
+}
+
+cy_rslt_t cy_ecm_init( void )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM Library is already initialized \n" );
+        return CY_RSLT_ECM_INIT_ERROR;
+    }
+
+    /** Initialize the network stack **/
+    if( !is_tcp_initialized )
+    {
+        result = cy_network_init();
+        if( result != CY_RSLT_SUCCESS )
+        {
+            return CY_RSLT_ECM_NW_INIT_ERROR;
+        }
+        is_tcp_initialized = true;
+    }
+
+    result = cy_rtos_init_mutex2( &ecm_mutex, false );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Creating new mutex failed with result = 0x%X\n", (unsigned long)result );
+        is_tcp_initialized = false;
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+        goto exit;
+    }
+
+    result = cy_rtos_init_mutex2( &ecm_poll_mutex, false );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Creating new mutex failed with result = 0x%X\n", (unsigned long)result );
+        cy_rtos_deinit_mutex( &ecm_mutex );
+        is_tcp_initialized = false;
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+        goto exit;
+    }
+
+     is_ecm_initialized = true;
+
+#ifdef CY_ECM_STATIC_ALLOCATION
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "ECM static allocation: object pool %u bytes, event thread stack %u bytes, RTOS objects %u bytes per interface\n",
+                    (unsigned int)sizeof( ecm_obj_pool ), (unsigned int)sizeof( ecm_event_thread_stack ), (unsigned int)CY_ECM_RTOS_OBJECTS_SIZE );
+#endif
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+
+exit:
+    if( !is_tcp_initialized )
+    {
+        (void)cy_network_deinit();
+    }
+    return result;
+}
+
+cy_rslt_t cy_ecm_deinit( void )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Ethernet connection manager Library is not initialized (or) already de-initialized\n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+    else
+    {
+        is_ecm_initialized = false;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "De-initialize ethernet connection manager library\n" );
+
+        is_tcp_initialized = false;
+
+        (void)cy_network_deinit(); /* Fall through */
+        cy_rtos_deinit_mutex( &ecm_poll_mutex );
+        cy_rtos_deinit_mutex( &ecm_mutex );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Global Mutex Deinit..!\n" );
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_ethif_init( cy_ecm_interface_t eth_idx,
+                             const cy_ecm_phy_callbacks_t *phy_callbacks,
+                             cy_ecm_t *ecm_handle )
+{
+    cy_rslt_t                     result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t              *ecm_obj       = NULL;
+    bool                          obj_mutex_init_status = false;
+    cy_ecm_phy_config_t           phy_interface_type;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || eth_idx >= CY_ECM_INTERFACE_INVALID )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid arguments passed \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( eth_idx == CY_ECM_INTERFACE_ETH1 )
+    {
+#if !(defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
+        return CY_RSLT_MODULE_ECM_BADARG;
+#else
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\n Ethernet interface 1 is enabled in configurator \n" );
+#endif
+    }
+    else
+    {
+#if !(defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
+        return CY_RSLT_MODULE_ECM_BADARG;
+#else
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\n Ethernet interface 0 is enabled in configurator \n" );
+#endif
+    }
+
+    if( phy_callbacks == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "\n Using the generic PHY driver \n" );
+        phy_callbacks = &cy_ecm_phy_generic_callbacks;
+    }
+
+    /* The remaining callbacks are optional */
+    if( (phy_callbacks->phy_init == NULL) || (phy_callbacks->phy_configure == NULL) ||
+        (phy_callbacks->phy_get_linkspeed == NULL) || (phy_callbacks->phy_get_linkstatus == NULL) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid arguments passed \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    //Check whether the Ethernet interface is already initialized
+    if( is_ethernet_initiated[eth_idx] == true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM interface is already initialized for eth_idx: [%d] \n",eth_idx );
+        result = CY_RSLT_ECM_INIT_ERROR;
+        goto exit;
+    }
+
+    ecm_obj = ecm_object_alloc( eth_idx );
+    if( ecm_obj == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\nAllocation of ECM handle failed..!\n" );
+        result = CY_RSLT_ECM_ERROR_NOMEM;
+        goto exit;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\necm_obj : %p..!\n", ecm_obj );
+    memset( ecm_obj, 0x00, sizeof( cy_ecm_object_t ) );
+
+    result = cy_rtos_init_mutex2( &(ecm_obj->obj_mutex), true );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Creating new mutex failed with result = 0x%X\n", (unsigned long)result );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+        goto exit;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nobj_mutex created!\n" );
+
+    eth_index_internal = eth_idx;
+
+    obj_mutex_init_status = true;
+    ecm_obj->isobjinitialized = true;
+    ecm_obj->eth_idx = eth_idx;
+    ecm_obj->eth_base_type = ETH_INTERFACE_TYPE;
+    ecm_obj->network_up = false;
+    ecm_obj->iface_context = NULL;
+    ecm_obj->link_quality.info.eth_idx = eth_idx;
+    ecm_obj->link_quality.info.score = 100;
+    ecm_obj->link_quality.info.sqi = CY_ECM_SQI_UNKNOWN;
+    ecm_obj->duplex_monitor.stats.eth_idx = eth_idx;
+    ecm_obj->duplex_monitor.forced_duplex = CY_ECM_DUPLEX_FULL;
+
+    /* The callback table is referenced, not copied; it must stay valid until cy_ecm_ethif_deinit */
+    ecm_obj->eth_phy_cb = phy_callbacks;
+
+    *ecm_handle = (cy_ecm_t *)ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Assigning User MAC address...\n" );
+    if(eth_idx == CY_ECM_INTERFACE_ETH1)
+    {
+#if (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
+        ecm_obj->mac_address[0] = (uint8_t)eth_1_MAC_ADDR0;
+        ecm_obj->mac_address[1] = (uint8_t)eth_1_MAC_ADDR1;
+        ecm_obj->mac_address[2] = (uint8_t)eth_1_MAC_ADDR2;
+        ecm_obj->mac_address[3] = (uint8_t)eth_1_MAC_ADDR3;
+        ecm_obj->mac_address[4] = (uint8_t)eth_1_MAC_ADDR4;
+        ecm_obj->mac_address[5] = (uint8_t)eth_1_MAC_ADDR5;
+#endif
+    }
+
+    if(eth_idx == CY_ECM_INTERFACE_ETH0)
+    {
+#if (defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
+        ecm_obj->mac_address[0] = (uint8_t)eth_0_MAC_ADDR0;
+        ecm_obj->mac_address[1] = (uint8_t)eth_0_MAC_ADDR1;
+        ecm_obj->mac_address[2] = (uint8_t)eth_0_MAC_ADDR2;
+        ecm_obj->mac_address[3] = (uint8_t)eth_0_MAC_ADDR3;
+        ecm_obj->mac_address[4] = (uint8_t)eth_0_MAC_ADDR4;
+        ecm_obj->mac_address[5] = (uint8_t)eth_0_MAC_ADDR5;
+#endif
+    }
+
+    if(eth_idx == CY_ECM_INTERFACE_ETH0)
+    {
+#if (defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Initializing ETH0 interface PHY properties...\n" );
+        phy_interface_type.interface_speed_type = (cy_ecm_speed_type_t)eth_0_PHY_INTERFACE;
+        phy_interface_type.phy_speed = (cy_ecm_phy_speed_t)eth_0_PHY_SPEED;
+        phy_interface_type.mode = (cy_ecm_duplex_t)eth_0_PHY_MODE;
+#endif
+    }
+    else
+    {
+#if (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Initializing ETH1 interface PHY properties...\n" );
+        phy_interface_type.interface_speed_type = (cy_ecm_speed_type_t)eth_1_PHY_INTERFACE;
+        phy_interface_type.phy_speed = (cy_ecm_phy_speed_t)eth_1_PHY_SPEED;
+        phy_interface_type.mode = (cy_ecm_duplex_t)eth_1_PHY_MODE;
+#endif
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "PHY interface type  : %d \n", (int)phy_interface_type.interface_speed_type );
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "PHY interface speed : %d \n", (int)phy_interface_type.phy_speed );
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "PHY interface mode  : %d \n", (int)phy_interface_type.mode );
+
+    /* PHY callbacks access the PHY registers through the MDIO layer from the PHY initialization onwards */
+    result = cy_eth_mdio_init( ecm_obj->eth_idx, ecm_obj->eth_base_type );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "MDIO layer initialization failed with result = 0x%X\n", (unsigned long)result );
+        goto exit;
+    }
+
+    /* Prevent system to enter into deep sleep during ethernet initialization */
+    cyhal_syspm_lock_deepsleep();
+
+    result = cy_eth_driver_initialization( ecm_obj->eth_idx, ecm_obj->eth_base_type, &phy_interface_type, ecm_obj->eth_phy_cb );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "ECM driver initialization failed with result = 0x%X\n", (unsigned long)result );
+        /* Unlock to enter into deep sleep */
+        cyhal_syspm_unlock_deepsleep();
+        result = CY_RSLT_ECM_ERROR;
+        goto exit;
+    }
+
+    cy_eth_storm_init( ecm_obj->eth_idx, ecm_obj->mac_address );
+    (void)cy_eth_set_storm_control( ecm_obj->eth_idx, CY_ECM_STORM_BROADCAST, CY_ECM_STORM_BROADCAST_RATE, CY_ECM_STORM_BURST );
+    (void)cy_eth_set_storm_control( ecm_obj->eth_idx, CY_ECM_STORM_MULTICAST, CY_ECM_STORM_MULTICAST_RATE, CY_ECM_STORM_BURST );
+    (void)cy_eth_set_storm_control( ecm_obj->eth_idx, CY_ECM_STORM_UNKNOWN_UNICAST, CY_ECM_STORM_UNKNOWN_UNICAST_RATE, CY_ECM_STORM_BURST );
+    cy_eth_vlan_init( ecm_obj->eth_idx );
+    cy_eth_priority_init( ecm_obj->eth_idx );
+
+    /* Enable/Disable Promiscuous Mode */
+#if (defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
+#if (eth_0_PROMISCUOUS_MODE == true)
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Setting Promiscuous Mode for ETH0 interface...\n" );
+    Cy_ETHIF_SetPromiscuousMode( ecm_obj->eth_base_type, true );
+#endif
+#if (eth_0_ACCEPT_BROADCASR_FRAMES == false)
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Setting No BroadCast for ETH0 interface...\n" );
+    Cy_ETHIF_SetNoBroadCast( ecm_obj->eth_base_type, true );
+#endif
+#endif
+
+#if (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
+#if (eth_1_PROMISCUOUS_MODE == true)
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Setting Promiscuous Mode for ETH1 interface...\n" );
+    Cy_ETHIF_SetPromiscuousMode( ecm_obj->eth_base_type, true );
+#endif
+#if (eth_1_ACCEPT_BROADCASR_FRAMES == false)
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Setting No BroadCast for ETH1 interface...\n" );
+    Cy_ETHIF_SetNoBroadCast( ecm_obj->eth_base_type, true );
+#endif
+#endif
+
+    ecm_poll_lock();
+    is_ethernet_initiated[ecm_obj->eth_idx] = true;
+    ecm_obj_list[ecm_obj->eth_idx] = ecm_obj;
+    ecm_poll_unlock();
+
+    /* Unlock to enter into deep sleep */
+    cyhal_syspm_unlock_deepsleep();
+
+    if(is_ecm_thread_created == 0)
+    {
+        /* Create the thread to handle connect/disconnect events */
+         result = cy_rtos_create_thread( &ecm_event_thread, ecm_event_thread_func, "ECMEventThread", CY_ECM_EVENT_THREAD_STACK,
+                                         CY_ECM_EVENT_THREAD_STACK_SIZE, CY_ECM_EVENT_THREAD_PRIORITY, NULL );
+         if( result != CY_RSLT_SUCCESS )
+         {
+             cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\ncy_rtos_create_thread failed with Error : [0x%X]\n", (unsigned int)result );
+             ecm_poll_lock();
+             is_ethernet_initiated[ecm_obj->eth_idx] = false;
+             ecm_obj_list[ecm_obj->eth_idx] = NULL;
+             ecm_poll_unlock();
+             result = CY_RSLT_ECM_ERROR;
+             goto exit;
+         }
+    }
+
+    is_ecm_thread_created++;
+
+    result = cy_rtos_set_mutex( &ecm_mutex );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed with result = 0x%X\n", (unsigned long)result );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+
+exit:
+    if( ecm_obj != NULL )
+    {
+        if( obj_mutex_init_status == true )
+        {
+            cy_rtos_deinit_mutex( &( ecm_obj->obj_mutex ) );
+            cy_eth_mdio_deinit( ecm_obj->eth_idx );
+        }
+
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\n Free ecm_obj : %p..!\n", ecm_obj );
+        ecm_object_free( ecm_obj );
+    }
+
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed with result = 0x%X\n", (unsigned long)result );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_ethif_deinit( cy_ecm_t *ecm_handle )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || *ecm_handle == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)*ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    if( ecm_obj->is_diag_running == true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Cable diagnostics in progress \n" );
+        (void)cy_rtos_set_mutex( &ecm_mutex );
+        return CY_RSLT_ECM_BUSY;
+    }
+
+    /* The MAC of this interface drives the MDC/MDIO lines of the PHYs of the other interfaces on its bus */
+    if( cy_eth_mdio_is_bus_shared( ecm_obj->eth_idx ) == true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n MDIO bus of eth_idx: [%d] is used by another interface \n", ecm_obj->eth_idx );
+        (void)cy_rtos_set_mutex( &ecm_mutex );
+        return CY_RSLT_ECM_BUSY;
+    }
+
+    /* Stop the polling of the interface before it is torn down */
+    ecm_poll_lock();
+    ecm_obj_list[ecm_obj->eth_idx] = NULL;
+    ecm_poll_unlock();
+
+    is_ecm_thread_created--;
+
+    /* Terminate the connect/disconnect event thread */
+    if( is_ecm_thread_created == 0 )
+    {
+        if( ecm_event_thread != NULL )
+        {
+            /* The thread is not terminated while it holds the poll lock */
+            ecm_poll_lock();
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nTerminating ECM event thread %p..!\n", ecm_event_thread );
+            result = cy_rtos_terminate_thread( &ecm_event_thread );
+            if( result != CY_RSLT_SUCCESS )
+            {
+                cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\nTerminate ECM event thread failed with Error : [0x%X] ", (unsigned int)result );
+                /* Fall-through. It's intentional. */
+            }
+
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nJoining ECM event thread %p..!\n", ecm_event_thread );
+            result = cy_rtos_join_thread( &ecm_event_thread );
+            if( result != CY_RSLT_SUCCESS )
+            {
+                cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\nJoin ECM event thread failed with Error : [0x%X] ", (unsigned int)result );
+                /* Fall-through. It's intentional. */
+            }
+            ecm_poll_unlock();
+            ecm_event_thread = NULL;
+        }
+    }
+
+    if( cy_rtos_deinit_mutex( &( ecm_obj->obj_mutex ) ) != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Mutex deinit failed with result = 0x%X\n", (unsigned long)result );
+        /* Intentional fallthrough */
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Deinit object mutex : %p..!\n", ecm_obj->obj_mutex );
+
+    /* The next cy_ecm_ethif_init starts in interrupt mode */
+    if( cy_eth_is_polled_mode( ecm_obj->eth_idx ) == true )
+    {
+        cy_eth_set_polled_mode( ecm_obj->eth_idx, false );
+    }
+    deregister_cb(ecm_obj->eth_base_type);
+    cy_eth_raw_unregister_all( ecm_obj->eth_idx );
+    cy_eth_capture_stop( ecm_obj->eth_idx );
+    cy_eth_mirror_detach( ecm_obj->eth_idx );
+    ecm_recovery_stop( ecm_obj );
+    cy_eth_mdio_deinit( ecm_obj->eth_idx );
+
+    is_ethernet_initiated[ecm_obj->eth_idx] = false;
+    ecm_obj->iface_context = NULL;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "ecm_obj : %p..!\n", ecm_obj );
+
+    ecm_object_free( ecm_obj );
+
+    *ecm_handle = NULL;
+
+    result = cy_rtos_set_mutex( &ecm_mutex );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed with result = 0x%X\n", (unsigned long)result );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_set_promiscuous_mode(cy_ecm_t ecm_handle, bool is_promiscuous_mode)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    /* Check if ethernet is up */
+    if( is_ethernet_initiated[ecm_obj->eth_idx] == false )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM is not initiated for eth_idx: [%d] \n",ecm_obj->eth_idx );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "ecm_obj->eth_base_type:[%p]\n",ecm_obj->eth_base_type );
+
+    /* Disable/Enable copy all frames. If 1 enables copy all frames mode, if 0 then this is disabled */
+    Cy_ETHIF_SetPromiscuousMode( ecm_obj->eth_base_type, is_promiscuous_mode );
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_broadcast_disable(cy_ecm_t ecm_handle, bool is_broadcast_disable)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    //Check whether Ethernet is up
+    if( is_ethernet_initiated[ecm_obj->eth_idx] == false )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM is not initiated for eth_idx: [%d] \n",ecm_obj->eth_idx );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "ecm_obj->eth_base_type:[%p]\n",ecm_obj->eth_base_type );
+
+    /* Reject/Accept Broad cast frames. If 0 broadcasts are accepted, if 1 they are rejected */
+    Cy_ETHIF_SetNoBroadCast( ecm_obj->eth_base_type, is_broadcast_disable );
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_set_filter_address(cy_ecm_t ecm_handle, cy_ecm_filter_address_t *filter_address, uint8_t filter_address_count)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+    cy_en_ethif_status_t ethStatus;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || filter_address == NULL || filter_address_count == 0
+            || ( filter_address_count > CY_ECM_MAX_FILTER_ADDRESS ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    /* Check if ethernet is up */
+    if( is_ethernet_initiated[ecm_obj->eth_idx] == false )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM is not initiated for eth_idx: [%d] \n",ecm_obj->eth_idx );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "ecm_obj->eth_base_type:[%p]\n",ecm_obj->eth_base_type );
+
+    for( int i = 0; i < filter_address_count; i++ )
+    {
+        cy_stc_ethif_filter_config_t filter_config;
+        filter_config.typeFilter = ( cy_en_ethif_filter_type_t )filter_address[i].filter_type;
+        memcpy( (void*)&(filter_config.filterAddr.byte[0]), (void*)&(filter_address[i].filter_addr[0]), CY_ECM_MAC_ADDR_LEN );
+        filter_config.ignoreBytes = filter_address->ignoreBytes;
+
+        /* Filter settings */
+        ethStatus = Cy_ETHIF_SetFilterAddress( ecm_obj->eth_base_type, (cy_en_ethif_filter_num_t)(i+1), &filter_config );
+        if( CY_ETHIF_SUCCESS != ethStatus )
+        {
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n setting filter address failed \n" );
+            result = CY_RSLT_ECM_ERROR;
+            goto exit;
+        }
+    }
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_connect( cy_ecm_t ecm_handle, cy_ecm_ip_setting_t *ecm_static_ip_addr, cy_ecm_ip_address_t *ip_addr )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+    cy_network_static_ip_addr_t nw_static_ipaddr, *static_ipaddr = NULL;
+    cy_nw_ip_address_t ipv4_addr;
+    uint32_t total_wait_time = 0, linkstatus = 0;
+    cy_time_t start_time = 0, end_time = 0;
+#ifdef ENABLE_ECM_LOGS
+    char ip_str[15];
+#endif
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid handle Arguments \n" );
+        return  CY_RSLT_MODULE_ECM_BADARG;
+     }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    (void)cy_rtos_get_time( &start_time );
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    /* Check whether the connection is already established */
+    if( ecm_obj->network_up == true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library already connected \n" );
+        result = CY_RSLT_MODULE_ECM_ALREADY_CONNECTED;
+        goto exit;
+    }
+
+    /* The Tx path of a mirror destination is owned by the mirror */
+    if( cy_eth_is_mirror_destination( ecm_obj->eth_idx ) == true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Interface is a port mirror destination \n" );
+        result = CY_RSLT_ECM_BUSY;
+        goto exit;
+    }
+
+    if( ecm_static_ip_addr != NULL )
+    {
+        if( ecm_static_ip_addr->gateway.version == CY_ECM_IP_VER_V4 )
+        {
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\n Static IP address not NULL\n" );
+            nw_static_ipaddr.gateway.ip.v4 = ecm_static_ip_addr->gateway.ip.v4;
+            nw_static_ipaddr.addr.ip.v4    = ecm_static_ip_addr->ip_address.ip.v4;
+            nw_static_ipaddr.netmask.ip.v4 = ecm_static_ip_addr->netmask.ip.v4;
+            static_ipaddr = &nw_static_ipaddr;
+        }
+        else
+        {
+            /* TO DO : Copy the IPv6 address */
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Static IP address not supported\n" );
+            result = CY_RSLT_ECM_STATIC_IP_NOT_SUPPORTED;
+            goto exit;
+        }
+    }
+
+    //Add the Ethernet interface
+    result = cy_network_add_nw_interface( CY_NETWORK_ETH_INTERFACE, ecm_obj->eth_idx, (void *)ecm_obj->eth_base_type, ecm_obj->mac_address, static_ipaddr, &ecm_obj->iface_context );
+    if(result != CY_RSLT_SUCCESS)
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "failed to add the network interface \n" );
+        result = CY_RSLT_ECM_INTERFACE_ERROR;
+        goto exit;
+    }
+
+    ecm_obj->is_static_ip = ( static_ipaddr != NULL );
+
+    /* Register to IP address change callback from the lwIP stack. All other internal callbacks are in ECM */
+    cy_network_register_ip_change_cb( ecm_obj->iface_context, ip_change_callback, NULL );
+
+    //Check whether the Ethernet link status is up; call interface network_up()
+    if( is_ethernet_link_up[ecm_obj->eth_idx] != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Waiting for Link up... \n" );
+        while( total_wait_time < MAX_WAIT_ETHERNET_PHY_STATUS )
+        {
+            cy_eth_mdio_new_cycle( ecm_obj->eth_idx );
+            result = ecm_obj->eth_phy_cb->phy_get_linkstatus((uint8_t)ecm_obj->eth_idx, &linkstatus);
+            if(result == CY_RSLT_SUCCESS)
+            {
+                if(linkstatus == 1)
+                {
+                    break;
+                }
+            }
+            cy_rtos_delay_milliseconds(WAIT_CHECK_ETHERNET_PHY_STATUS);
+            total_wait_time += WAIT_CHECK_ETHERNET_PHY_STATUS;
+            continue;
+        }
+
+        if( total_wait_time >= MAX_WAIT_ETHERNET_PHY_STATUS )
+        {
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Ethernet link is not up :[%d] \n", total_wait_time );
+            result = CY_RSLT_ECM_ERROR;
+            goto exit;
+        }
+
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Ethernet Link is up \n" );
+        is_ethernet_link_up[ecm_obj->eth_idx] = true;
+    }
+
+    result = cy_network_ip_up( ecm_obj->iface_context );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "failed to bring up the network stack :[%d] \n",result );
+        if( (cy_network_remove_nw_interface( ecm_obj->iface_context )) != CY_RSLT_SUCCESS )
+        {
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "failed to remove the network interface \n" );
+        }
+        if(result == CY_RSLT_NETWORK_ERROR_STARTING_DHCP)
+        {
+            result = CY_RSLT_MODULE_ECM_ERROR_STARTING_DHCP;
+        }
+        else if(result == CY_RSLT_NETWORK_DHCP_WAIT_TIMEOUT)
+        {
+            result = CY_RSLT_ECM_DHCP_TIMEOUT;
+        }
+        goto exit;
+    }
+
+    total_wait_time = 0;
+    /** Wait in a busy loop until DHCP starts and IP address is assigned **/
+    while ( true )
+    {
+        result = cy_network_get_ip_address( ecm_obj->iface_context, &ipv4_addr );
+        if( result == CY_RSLT_SUCCESS )
+        {
+#ifdef ENABLE_ECM_LOGS
+            cy_nw_ntoa( &ipv4_addr, ip_str );
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "IPV4 Address %s assigned \n", ip_str );
+#endif
+            if( ip_addr != NULL )
+            {
+                ip_addr->version = CY_ECM_IP_VER_V4;
+                ip_addr->ip.v4 = ipv4_addr.ip.v4;
+            }
+            break;
+        }
+        /* TO DO : get ipv6 address */
+        /* Delay of 10 ms */
+        cy_rtos_delay_milliseconds( RETRY_WAIT_TIME_GET_IP_ADDR );
+        /* Increment the count for every 10 ms */
+        total_wait_time += RETRY_WAIT_TIME_GET_IP_ADDR;
+        /* Return DHCP timeout error when it exceeds 6000 * 10 ms = 60 seconds */
+    }
+    if( total_wait_time > DHCP_TIMEOUT_COUNT )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "DHCP Timeout \n" );
+
+        // Bring network down and remove network interface as DHCP failed
+        cy_network_ip_down(ecm_obj->iface_context);
+        cy_network_remove_nw_interface(ecm_obj->iface_context);
+
+        /* Return DHCP timeout error when DHCP discovery failed and disconnect is done properly */
+        result = CY_RSLT_ECM_DHCP_TIMEOUT;
+        goto exit;
+    }
+
+    ecm_poll_lock();
+    ecm_obj->network_up = true;
+    ecm_poll_unlock();
+#ifdef ECM_IP_ALIAS_SUPPORTED
+    ecm_ip_alias_connect( ecm_obj );
+#endif
+
+    (void)cy_rtos_get_time( &end_time );
+    ecm_obj->recovery_stats.connect_count++;
+    ecm_obj->recovery_stats.last_connect_time_ms = (uint32_t)( end_time - start_time );
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_disconnect( cy_ecm_t ecm_handle )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    /* Check connection established for disconnection */
+    if( ecm_obj->network_up == false )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not connected \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
+        goto exit;
+    }
+
+    /* Register to ip change callback from LwIP, all other internal callbacks are in ECM */
+    cy_network_register_ip_change_cb( ecm_obj->iface_context, NULL, NULL );
+
+    ecm_poll_lock();
+    ecm_recovery_stop( ecm_obj );
+    ecm_obj->is_suspended = false;
+    ecm_obj->network_up = false;
+    ecm_poll_unlock();
+
+#ifdef ECM_IP_ALIAS_SUPPORTED
+    ecm_ip_alias_disconnect( ecm_obj );
+#endif
+
+    //Bring down the Ethernet interface
+    cy_network_ip_down( ecm_obj->iface_context );
+    cy_network_remove_nw_interface( ecm_obj->iface_context );
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_suspend( cy_ecm_t ecm_handle )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    if( ecm_obj->network_up == false )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not connected \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
+        goto exit;
+    }
+
+    if( ecm_obj->is_suspended == true )
+    {
+        goto exit;
+    }
+
+    /* The network interface, its addresses, and the DHCP state stay registered; only the link is reported down to the stack */
+    ecm_poll_lock();
+    ecm_recovery_stop( ecm_obj );
+    ecm_network_link_changed( ecm_obj, false );
+    ecm_obj->is_suspended = true;
+    ecm_poll_unlock();
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_resume( cy_ecm_t ecm_handle )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+    uint32_t linkstatus = 0;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    if( ( ecm_obj->network_up == false ) || ( ecm_obj->is_suspended == false ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Interface not suspended \n" );
+        result = CY_RSLT_ECM_NOT_SUSPENDED;
+        goto exit;
+    }
+
+    /* Read the PHY instead of waiting for the event thread to notice the link up */
+    ecm_poll_lock();
+    cy_eth_mdio_new_cycle( ecm_obj->eth_idx );
+    if( ( ecm_obj->eth_phy_cb->phy_get_linkstatus( (uint8_t)ecm_obj->eth_idx, &linkstatus ) != CY_RSLT_SUCCESS ) || ( linkstatus != 1 ) )
+    {
+        ecm_poll_unlock();
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet link is down \n" );
+        result = CY_RSLT_ECM_LINK_DOWN;
+        goto exit;
+    }
+
+    /* Keep the event thread from reporting this link up as a new one */
+    is_ethernet_link_up[ecm_obj->eth_idx] = true;
+    ecm_obj->is_suspended = false;
+    ecm_obj->recovery_stats.resume_count++;
+    ecm_recovery_start( ecm_obj );
+    ecm_poll_unlock();
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_register_event_callback( cy_ecm_t ecm_handle, cy_ecm_event_callback_t event_callback )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || event_callback == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    for ( int i = 0; i < CY_ECM_MAXIMUM_CALLBACKS_COUNT; i++ )
+    {
+        if( ecm_event_handler[i] == NULL )
+        {
+            ecm_event_handler[i] = event_callback;
+            break;
+        }
+    }
+
+exit:
+    result = cy_rtos_set_mutex( &ecm_mutex );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed with result = 0x%X\n", (unsigned long)result );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+
+}
+
+cy_rslt_t cy_ecm_deregister_event_callback( cy_ecm_t ecm_handle, cy_ecm_event_callback_t event_callback )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || event_callback == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    for ( int i = 0; i < CY_ECM_MAXIMUM_CALLBACKS_COUNT; i++ )
+    {
+        if( ecm_event_handler[i] == event_callback )
+        {
+            memset( &ecm_event_handler[i], 0, sizeof( cy_ecm_event_callback_t ) );
+            result = CY_RSLT_SUCCESS;;
+            goto exit;
+        }
+    }
+
+exit:
+    result = cy_rtos_set_mutex( &ecm_mutex );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed with result = 0x%X\n", (unsigned long)result );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_link_status( cy_ecm_t ecm_handle, bool *status )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+    uint32_t total_wait_time = 0, linkstatus = 0;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || status == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\n before reading link status = %d \n",*status );
+
+    while( total_wait_time < (uint32_t )MAX_WAIT_ETHERNET_PHY_STATUS )
+    {
+        cy_eth_mdio_new_cycle( ecm_obj->eth_idx );
+        result = ecm_obj->eth_phy_cb->phy_get_linkstatus((uint8_t)ecm_obj->eth_idx, &linkstatus);
+        if(result == CY_RSLT_SUCCESS)
+        {
+            if(linkstatus == 1)
+            {
+                *status = true;
+                break;
+            }
+        }
+        cy_rtos_delay_milliseconds( WAIT_CHECK_ETHERNET_PHY_STATUS );
+        total_wait_time += WAIT_CHECK_ETHERNET_PHY_STATUS;
+        continue;
+    }
+
+    if( total_wait_time >= MAX_WAIT_ETHERNET_PHY_STATUS )
+    {
+        result = CY_RSLT_SUCCESS;
+        *status = false;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\n After reading link status = %d \n",*status );
+
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed \n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_ip_address( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *ip_addr )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+    cy_nw_ip_address_t ipv4_addr;
+#ifdef ENABLE_ECM_LOGS
+    char ip_str[15];
+#endif
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || ip_addr == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    /* Check whether the network is up */
+    if( ecm_obj->network_up == false )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Network is not up, call cy_ecm_connect API to bring network up \r\n" );
+        /** Network is not up and therefore, mem setting the IP address to zero**/
+        memset( ip_addr, 0, sizeof( cy_ecm_ip_address_t ) );
+        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
+        goto exit;
+    }
+
+    result = cy_network_get_ip_address( ecm_obj->iface_context, &ipv4_addr );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to get the IP address\n" );
+        result = CY_RSLT_ECM_IP_ADDR_ERROR;
+        goto exit;
+    }
+    ip_addr->version = CY_ECM_IP_VER_V4;
+    ip_addr->ip.v4 = ipv4_addr.ip.v4;
+#ifdef ENABLE_ECM_LOGS
+    cy_nw_ntoa( &ipv4_addr, ip_str );
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "IP Address %s assigned \n", ip_str );
+#endif
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed with result = 0x%X\n", (unsigned long)result );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_ipv6_address( cy_ecm_t ecm_handle, cy_ecm_ipv6_type_t ipv6_addr_type, cy_ecm_ip_address_t *ip_addr )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+    cy_nw_ip_address_t ipv6_addr;
+    cy_network_ipv6_type_t type;
+#ifdef ENABLE_ECM_LOGS
+    char ip_str[39];
+#endif
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+     if( ecm_handle == NULL || ip_addr == NULL )
+     {
+         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+         return CY_RSLT_MODULE_ECM_BADARG;
+     }
+
+     if( !is_ecm_initialized )
+     {
+         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+     }
+
+     if( ipv6_addr_type != CY_ECM_IPV6_LINK_LOCAL )
+     {
+         /*TODO : Need to add support for Global IPV6 address */
+         return CY_RSLT_ECM_IPV6_GLOBAL_ADDRESS_NOT_SUPPORTED;
+     }
+     type = CY_NETWORK_IPV6_LINK_LOCAL;
+
+     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    /* Check whether the network is up */
+    if( ecm_obj->network_up == false )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Network is not up, call cy_ecm_connect API to bring network up \r\n" );
+        /** Network is not up and therefore, mem setting the IP address to zero**/
+        memset( ip_addr, 0, sizeof( cy_ecm_ip_address_t ) );
+        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
+        goto exit;
+    }
+
+    result = cy_network_get_ipv6_address( ecm_obj->iface_context, type, &ipv6_addr );
+    if( result == CY_RSLT_SUCCESS )
+    {
+        ip_addr->version = CY_ECM_IP_VER_V6;
+        ip_addr->ip.v6[0] = ipv6_addr.ip.v6[0];
+        ip_addr->ip.v6[1] = ipv6_addr.ip.v6[1];
+        ip_addr->ip.v6[2] = ipv6_addr.ip.v6[2];
+        ip_addr->ip.v6[3] = ipv6_addr.ip.v6[3];
+
+#ifdef ENABLE_ECM_LOGS
+        cy_nw_ntoa_ipv6( &ipv6_addr, ip_str );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "IPV6 Address %s assigned \n", ip_str );
+#endif
+    }
+    else
+    {
+        memset( ip_addr, 0, sizeof( cy_ecm_ip_address_t ) );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "IPV6 network not ready \n" );
+        result = CY_RSLT_ECM_IPV6_INTERFACE_NOT_READY;
+        goto exit;
+    }
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed with result = 0x%X\n", (unsigned long)result );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_gateway_address( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *gateway_addr )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+    cy_nw_ip_address_t ipv4_addr;
+#ifdef ENABLE_ECM_LOGS
+    char ip_str[15];
+#endif
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || gateway_addr == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    /* Check whether the network is up */
+    if( ecm_obj->network_up == false )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Network is not up, call connect API to bring network up \r\n" );
+        /** Network is not up and therefore, mem setting the IP address to zero**/
+        memset( gateway_addr, 0, sizeof( cy_ecm_ip_address_t ) );
+        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
+        goto exit;
+    }
+
+    result = cy_network_get_gateway_ip_address( ecm_obj->iface_context, &ipv4_addr );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to get the gateway address\n" );
+        result = CY_RSLT_ECM_GATEWAY_ADDR_ERROR;
+        goto exit;
+    }
+    gateway_addr->version = CY_ECM_IP_VER_V4;
+    gateway_addr->ip.v4 = ipv4_addr.ip.v4;
+#ifdef ENABLE_ECM_LOGS
+    cy_nw_ntoa( &ipv4_addr, ip_str );
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Gateway IP Address %s assigned \n", ip_str );
+#endif
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to release the mutex \n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_netmask_address( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *net_mask_addr )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+    cy_nw_ip_address_t ipv4_addr;
+#ifdef ENABLE_ECM_LOGS
+    char ip_str[15];
+#endif
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || net_mask_addr == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    /* Check whether the network is up */
+    if( ecm_obj->network_up == false )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Network is not up, call connect API to bring network up \r\n" );
+        /** Network is not up and therefore, mem setting the IP address to zero**/
+        memset( net_mask_addr, 0, sizeof( cy_ecm_ip_address_t ) );
+        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
+        goto exit;
+    }
+
+    result = cy_network_get_netmask_address( ecm_obj->iface_context, &ipv4_addr );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to get the gateway address\n" );
+        result = CY_RSLT_ECM_GATEWAY_ADDR_ERROR;
+        goto exit;
+    }
+    net_mask_addr->version = CY_ECM_IP_VER_V4;
+    net_mask_addr->ip.v4 = ipv4_addr.ip.v4;
+#ifdef ENABLE_ECM_LOGS
+    cy_nw_ntoa( &ipv4_addr, ip_str );
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Gateway IP Address %s assigned \n", ip_str );
+#endif
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to release the mutex \n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_mac_address( cy_ecm_t ecm_handle, cy_ecm_mac_t *mac_addr )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+    cy_nw_ip_mac_t nw_mac_addr;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || mac_addr == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+        goto exit;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    /* check for network up */
+    if( ecm_obj->network_up == false )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Network is not up, call connect API to bring network up \r\n" );
+        /** Network is not up and hence mem setting the gateway MAC address to zero**/
+        memset( mac_addr , 0, sizeof( cy_ecm_mac_t ) );
+        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
+        goto exit;
+    }
+
+    result = cy_network_get_gateway_mac_address( ecm_obj->iface_context, &nw_mac_addr );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to get the gateway mac address address\n" );
+        result = CY_RSLT_ECM_GATEWAY_ADDR_ERROR;
+        goto exit;
+    }
+
+    (*mac_addr)[0] = nw_mac_addr.mac[0];
+    (*mac_addr)[1] = nw_mac_addr.mac[1];
+    (*mac_addr)[2] = nw_mac_addr.mac[2];
+    (*mac_addr)[3] = nw_mac_addr.mac[3];
+    (*mac_addr)[4] = nw_mac_addr.mac[4];
+    (*mac_addr)[5] = nw_mac_addr.mac[5];
+
+exit: 
+    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg(CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to release the mutex \n");
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_ping( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *address, uint32_t timeout_ms, uint32_t* elapsed_time_ms )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || address == NULL || elapsed_time_ms == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    /* check for network up */
+    if( ecm_obj->network_up == false )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Network is not up, call connect API to bring network up \r\n" );
+        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
+        goto exit;
+    }
+
+    result = cy_network_ping( (void *)ecm_obj->iface_context, (cy_nw_ip_address_t *) address, timeout_ms, elapsed_time_ms );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Ping failure with result = 0x%X\n", (unsigned long)result );
+        result = CY_RSLT_ECM_PING_FAILURE;
+        goto exit;
+    }
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg(CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to release the mutex \n");
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_link_speed( cy_ecm_t ecm_handle, cy_ecm_duplex_t *duplex, cy_ecm_phy_speed_t *speed )
+{
+    cy_rslt_t        result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+    uint32_t         total_wait_time = 0;
+    uint32_t         mode = 0, phy_speed = 0, link_status = 0;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || duplex == NULL || speed == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    /* Check whether the link is up*/
+    while( total_wait_time < (uint32_t )MAX_WAIT_ETHERNET_PHY_STATUS )
+    {
+        cy_eth_mdio_new_cycle( ecm_obj->eth_idx );
+        result = ecm_obj->eth_phy_cb->phy_get_linkstatus((uint8_t)ecm_obj->eth_idx, &link_status);
+        if(result == CY_RSLT_SUCCESS)
+        {
+            if(link_status == true)
+            {
+                result = ecm_obj->eth_phy_cb->phy_get_linkspeed((uint8_t)ecm_obj->eth_idx, &mode, &phy_speed);
+                if(result == CY_RSLT_SUCCESS)
+                {
+                    *duplex = (cy_ecm_duplex_t)mode;
+                    *speed = (cy_ecm_phy_speed_t)phy_speed;
+                    goto exit;
+                }
+            }
+        }
+
+        cy_rtos_delay_milliseconds( WAIT_CHECK_ETHERNET_PHY_STATUS );
+        total_wait_time += WAIT_CHECK_ETHERNET_PHY_STATUS;
+    }
+
+    result = CY_RSLT_ECM_ERROR;
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg(CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to release the mutex \n");
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_memory_usage( cy_ecm_t ecm_handle, cy_ecm_memory_usage_t *usage )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || usage == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    cy_eth_get_memory_usage( ecm_obj->eth_idx, usage );
+    usage->object = (uint32_t)sizeof( cy_ecm_object_t );
+    usage->stack  = (uint32_t)CY_ECM_EVENT_THREAD_STACK_SIZE;
+    usage->rtos_objects = (uint32_t)CY_ECM_RTOS_OBJECTS_SIZE;
+    usage->total  = usage->rx_descriptors + usage->tx_descriptors + usage->rx_buffers + usage->tx_buffers + usage->object + usage->stack +
+                    usage->rtos_objects;
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_recovery_stats( cy_ecm_t ecm_handle, cy_ecm_recovery_stats_t *stats )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || stats == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    ecm_poll_lock();
+    *stats = ecm_obj->recovery_stats;
+    ecm_poll_unlock();
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_run_cable_diagnostics( cy_ecm_t ecm_handle, cy_ecm_cable_report_t *report )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+    cy_ecm_event_data_t event_data;
+    cy_time_t start_time = 0, end_time = 0;
+    bool is_locked;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || report == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+    else if( ecm_obj->eth_phy_cb->phy_cable_diag == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n PHY driver has no cable diagnostics \n" );
+        result = CY_RSLT_ECM_NOT_SUPPORTED;
+    }
+    else if( ecm_obj->is_diag_running == true )
+    {
+        result = CY_RSLT_ECM_BUSY;
+    }
+    else
+    {
+        /* Stops the link monitoring of this interface and keeps the object from being deinitialized */
+        ecm_poll_lock();
+        ecm_obj->is_diag_running = true;
+        ecm_poll_unlock();
+    }
+
+    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        if( result == CY_RSLT_SUCCESS )
+        {
+            ecm_obj->is_diag_running = false;
+        }
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    if( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    /* The test runs without the global lock, so the other interface keeps being served; MDIO accesses are serialized per bus */
+    memset( report, 0x00, sizeof( cy_ecm_cable_report_t ) );
+    report->eth_idx = ecm_obj->eth_idx;
+
+    (void)cy_rtos_get_time( &start_time );
+    result = ecm_obj->eth_phy_cb->phy_cable_diag( (uint8_t)ecm_obj->eth_idx, report );
+    (void)cy_rtos_get_time( &end_time );
+    report->duration_ms = (uint32_t)( end_time - start_time );
+    if( report->pair_count > CY_ECM_CABLE_PAIR_COUNT )
+    {
+        report->pair_count = CY_ECM_CABLE_PAIR_COUNT;
+    }
+
+    /* The status registers read during the test are stale */
+    cy_eth_mdio_new_cycle( ecm_obj->eth_idx );
+
+    /* The flag is cleared even if the lock cannot be taken, so the interface is not left unmonitored */
+    is_locked = ( cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT ) == CY_RSLT_SUCCESS );
+    ecm_obj->is_diag_running = false;
+    if( is_locked )
+    {
+        (void)cy_rtos_set_mutex( &ecm_mutex );
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Cable diagnostics of eth_idx: [%d] completed with result = 0x%X in %lu ms \n",
+                    ecm_obj->eth_idx, (unsigned int)result, (unsigned long)report->duration_ms );
+
+    if( result == CY_RSLT_SUCCESS )
+    {
+        memset( &event_data, 0x00, sizeof( event_data ) );
+        event_data.cable = *report;
+        invoke_app_callbacks( CY_ECM_EVENT_CABLE_DIAGNOSTICS, &event_data );
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_link_quality( cy_ecm_t ecm_handle, cy_ecm_link_quality_t *quality )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || quality == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    ecm_poll_lock();
+    *quality = ecm_obj->link_quality.info;
+    ecm_poll_unlock();
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_set_duplex_mismatch_action( cy_ecm_t ecm_handle, cy_ecm_duplex_mismatch_action_t action, cy_ecm_duplex_t forced_duplex )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || (uint32_t)action > (uint32_t)CY_ECM_DUPLEX_MISMATCH_ACTION_FORCE_DUPLEX ||
+        ( action == CY_ECM_DUPLEX_MISMATCH_ACTION_FORCE_DUPLEX && forced_duplex != CY_ECM_DUPLEX_HALF && forced_duplex != CY_ECM_DUPLEX_FULL ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    ecm_poll_lock();
+    ecm_obj->duplex_monitor.action = action;
+    if( action == CY_ECM_DUPLEX_MISMATCH_ACTION_FORCE_DUPLEX )
+    {
+        ecm_obj->duplex_monitor.forced_duplex = forced_duplex;
+    }
+    ecm_poll_unlock();
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_duplex_stats( cy_ecm_t ecm_handle, cy_ecm_duplex_stats_t *stats )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || stats == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    ecm_poll_lock();
+    *stats = ecm_obj->duplex_monitor.stats;
+    ecm_poll_unlock();
+    if( is_ethernet_initiated[ecm_obj->eth_idx] == true )
+    {
+        stats->mac_duplex = cy_eth_get_mac_full_duplex( ecm_obj->eth_idx ) ? CY_ECM_DUPLEX_FULL : CY_ECM_DUPLEX_HALF;
+    }
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_tx_error_stats( cy_ecm_t ecm_handle, cy_ecm_tx_error_stats_t *stats )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+    cy_eth_mac_counters_t mac;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || stats == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    if( is_ethernet_initiated[ecm_obj->eth_idx] == false )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM is not initiated for eth_idx: [%d] \n",ecm_obj->eth_idx );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    cy_eth_get_mac_counters( ecm_obj->eth_idx, &mac );
+    memset( stats, 0, sizeof( cy_ecm_tx_error_stats_t ) );
+    stats->eth_idx              = ecm_obj->eth_idx;
+    stats->frames_tx            = mac.frames_tx;
+    memcpy( stats->queue_errors, mac.tx_queue_errors, sizeof( stats->queue_errors ) );
+    stats->underruns            = mac.tx_underruns;
+    stats->late_collisions      = mac.late_collisions;
+    stats->excessive_collisions = mac.excessive_collisions;
+    stats->fallback_count       = ecm_obj->tx_monitor.fallback_count;
+    cy_eth_get_tx_dma_config( ecm_obj->eth_idx, &stats->dma_burst_len, &stats->is_store_and_forward );
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_int_moderation_stats( cy_ecm_t ecm_handle, cy_ecm_int_moderation_stats_t *stats )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || stats == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
 
-    *ecm_handle = (cy_ecm_t *)ecm_obj;
+    cy_eth_get_int_moderation_stats( ecm_obj->eth_idx, stats );
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Assigning User MAC address...\n" );
-    if(eth_idx == CY_ECM_INTERFACE_ETH1)
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
     {
-#if (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
-        ecm_obj->mac_address[0] = (uint8_t)eth_1_MAC_ADDR0;
-        ecm_obj->mac_address[1] = (uint8_t)eth_1_MAC_ADDR1;
-        ecm_obj->mac_address[2] = (uint8_t)eth_1_MAC_ADDR2;
-        ecm_obj->mac_address[3] = (uint8_t)eth_1_MAC_ADDR3;
-        ecm_obj->mac_address[4] = (uint8_t)eth_1_MAC_ADDR4;
-        ecm_obj->mac_address[5] = (uint8_t)eth_1_MAC_ADDR5;
-#endif
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
     }
 
-    if(eth_idx == CY_ECM_INTERFACE_ETH0)
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_set_polled_mode( cy_ecm_t ecm_handle, bool enable )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL )
     {
-#if (defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
-        ecm_obj->mac_address[0] = (uint8_t)eth_0_MAC_ADDR0;
-        ecm_obj->mac_address[1] = (uint8_t)eth_0_MAC_ADDR1;
-        ecm_obj->mac_address[2] = (uint8_t)eth_0_MAC_ADDR2;
-        ecm_obj->mac_address[3] = (uint8_t)eth_0_MAC_ADDR3;
-        ecm_obj->mac_address[4] = (uint8_t)eth_0_MAC_ADDR4;
-        ecm_obj->mac_address[5] = (uint8_t)eth_0_MAC_ADDR5;
-#endif
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
     }
 
-    if(eth_idx == CY_ECM_INTERFACE_ETH0)
+    if( !is_ecm_initialized )
     {
-#if (defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Initializing ETH0 interface PHY properties...\n" );
-        phy_interface_type.interface_speed_type = (cy_ecm_speed_type_t)eth_0_PHY_INTERFACE;
-        phy_interface_type.phy_speed = (cy_ecm_phy_speed_t)eth_0_PHY_SPEED;
-        phy_interface_type.mode = (cy_ecm_duplex_t)eth_0_PHY_MODE;
-#endif
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
-    else
+
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
     {
-#if (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Initializing ETH1 interface PHY properties...\n" );
-        phy_interface_type.interface_speed_type = (cy_ecm_speed_type_t)eth_1_PHY_INTERFACE;
-        phy_interface_type.phy_speed = (cy_ecm_phy_speed_t)eth_1_PHY_SPEED;
-        phy_interface_type.mode = (cy_ecm_duplex_t)eth_1_PHY_MODE;
-#endif
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "PHY interface type  : %d \n", (int)phy_interface_type.interface_speed_type );
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "PHY interface speed : %d \n", (int)phy_interface_type.phy_speed );
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "PHY interface mode  : %d \n", (int)phy_interface_type.mode );
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
 
-    /* Prevent system to enter into deep sleep during ethernet initialization */
-    cyhal_syspm_lock_deepsleep();
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    if( is_ethernet_initiated[ecm_obj->eth_idx] == false )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM is not initiated for eth_idx: [%d] \n",ecm_obj->eth_idx );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    if( cy_eth_is_mirror_destination( ecm_obj->eth_idx ) == true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Interface is a port mirror destination \n" );
+        result = CY_RSLT_ECM_BUSY;
+        goto exit;
+    }
+
+    if( cy_eth_is_polled_mode( ecm_obj->eth_idx ) != enable )
+    {
+        cy_eth_set_polled_mode( ecm_obj->eth_idx, enable );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Interface %d switched to %s mode \n", ecm_obj->eth_idx, enable ? "polled" : "interrupt" );
+    }
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_poll( cy_ecm_t ecm_handle, uint32_t budget )
+{
+    cy_ecm_object_t *ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    /* Called from the time slot of the application: no lock, no logging */
+    if( ecm_obj == NULL || budget == 0 )
+    {
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized || ( ecm_obj->isobjinitialized != true ) || ( is_ethernet_initiated[ecm_obj->eth_idx] == false ) )
+    {
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    if( cy_eth_is_polled_mode( ecm_obj->eth_idx ) == false )
+    {
+        return CY_RSLT_ECM_NOT_POLLED_MODE;
+    }
+
+    cy_eth_poll( ecm_obj->eth_idx, budget );
+
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_ecm_get_poll_stats( cy_ecm_t ecm_handle, cy_ecm_poll_stats_t *stats )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || stats == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
 
-    result = cy_eth_driver_initialization( ecm_obj->eth_idx, ecm_obj->eth_base_type, &phy_interface_type, &(ecm_obj->eth_phy_cb) );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "ECM driver initialization failed with result = 0x%X\n", (unsigned long)result );
-        /* Unlock to enter into deep sleep */
-        cyhal_syspm_unlock_deepsleep();
-        result = CY_RSLT_ECM_ERROR;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
         goto exit;
     }
 
-    /* Enable/Disable Promiscuous Mode */
-#if (defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
-#if (eth_0_PROMISCUOUS_MODE == true)
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Setting Promiscuous Mode for ETH0 interface...\n" );
-    Cy_ETHIF_SetPromiscuousMode( ecm_obj->eth_base_type, true );
-#endif
-#if (eth_0_ACCEPT_BROADCASR_FRAMES == false)
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Setting No BroadCast for ETH0 interface...\n" );
-    Cy_ETHIF_SetNoBroadCast( ecm_obj->eth_base_type, true );
-#endif
-#endif
+    cy_eth_get_poll_stats( ecm_obj->eth_idx, stats );
 
-#if (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
-#if (eth_1_PROMISCUOUS_MODE == true)
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Setting Promiscuous Mode for ETH1 interface...\n" );
-    Cy_ETHIF_SetPromiscuousMode( ecm_obj->eth_base_type, true );
-#endif
-#if (eth_1_ACCEPT_BROADCASR_FRAMES == false)
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Setting No BroadCast for ETH1 interface...\n" );
-    Cy_ETHIF_SetNoBroadCast( ecm_obj->eth_base_type, true );
-#endif
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_raw_register( cy_ecm_t ecm_handle, uint16_t ethertype, cy_ecm_raw_rx_cb_t callback, void *ctx )
+{
+    return cy_ecm_raw_register_vlan( ecm_handle, ethertype, CY_ECM_VLAN_ID_ANY, callback, ctx );
+}
+
+cy_rslt_t cy_ecm_raw_register_vlan( cy_ecm_t ecm_handle, uint16_t ethertype, uint16_t vlan_id, cy_ecm_raw_rx_cb_t callback, void *ctx )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if( ecm_handle == NULL || ethertype < 0x0600u || ethertype == 0x8100u ||
+        ( vlan_id > CY_ECM_VLAN_ID_MAX && vlan_id != CY_ECM_VLAN_ID_ANY ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    result = cy_eth_raw_register( ecm_obj->eth_idx, ethertype, vlan_id, callback, ctx, ecm_handle );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n No free dispatch table slot for EtherType 0x%04X \n", ethertype );
+    }
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_raw_send( cy_ecm_t ecm_handle, const uint8_t *frame, uint32_t length, uint8_t queue )
+{
+    cy_ecm_object_t *ecm_obj = (cy_ecm_object_t *)ecm_handle;
+    cy_rslt_t result;
+
+    if( ecm_obj == NULL || frame == NULL || length < CY_ECM_RAW_FRAME_MIN_LEN || length > CY_ECM_RAW_FRAME_MAX_LEN ||
+        queue >= CY_ECM_TX_QUEUE_COUNT )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized || ( ecm_obj->isobjinitialized != true ) || ( is_ethernet_initiated[ecm_obj->eth_idx] == false ) )
+    {
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+#if defined(COMPONENT_LWIP) && LWIP_TCPIP_CORE_LOCKING
+    /* The network stack transmits with its core lock held; the same lock keeps the PDL Tx path single-threaded */
+    LOCK_TCPIP_CORE();
+    result = cy_eth_raw_send( ecm_obj->eth_idx, frame, length, queue, CY_ETH_PCP_KEEP );
+    UNLOCK_TCPIP_CORE();
+#else
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    result = cy_eth_raw_send( ecm_obj->eth_idx, frame, length, queue, CY_ETH_PCP_KEEP );
+    (void)cy_rtos_set_mutex( &ecm_mutex );
 #endif
 
-    is_ethernet_initiated[ecm_obj->eth_idx] = true;
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_raw_stats( cy_ecm_t ecm_handle, cy_ecm_raw_stats_t *stats )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
 
-    /* Unlock to enter into deep sleep */
-    cyhal_syspm_unlock_deepsleep();
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if(is_ecm_thread_created == 0)
+    if( ecm_handle == NULL || stats == NULL )
     {
-        /* Create the thread to handle connect/disconnect events */
-         result = cy_rtos_create_thread( &ecm_event_thread, ecm_event_thread_func, "ECMEventThread", NULL,
-                                         CY_ECM_EVENT_THREAD_STACK_SIZE, CY_ECM_EVENT_THREAD_PRIORITY, (cy_thread_arg_t)(&(ecm_obj->eth_phy_cb)) );
-         if( result != CY_RSLT_SUCCESS )
-         {
-             cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\ncy_rtos_create_thread failed with Error : [0x%X]\n", (unsigned int)result );
-             result = CY_RSLT_ECM_ERROR;
-             goto exit;
-         }
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
     }
 
-    is_ecm_thread_created++;
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
 
-    result = cy_rtos_set_mutex( &ecm_mutex );
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed with result = 0x%X\n", (unsigned long)result );
-        result = CY_RSLT_ECM_MUTEX_ERROR;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
-
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
-    return result;
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
 
-exit:
-    if( ecm_obj != NULL )
+    if( ecm_obj->isobjinitialized != true )
     {
-        if( obj_mutex_init_status == true )
-        {
-            cy_rtos_deinit_mutex( &( ecm_obj->obj_mutex ) );
-        }
-
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\n Free ecm_obj : %p..!\n", ecm_obj );
-        free( ecm_obj );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
     }
 
+    cy_eth_get_raw_stats( ecm_obj->eth_idx, stats );
+
+exit:
     if( cy_rtos_set_mutex( &ecm_mutex ) )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed with result = 0x%X\n", (unsigned long)result );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_ethif_deinit( cy_ecm_t *ecm_handle )
+cy_rslt_t cy_ecm_set_storm_control( cy_ecm_t ecm_handle, cy_ecm_storm_class_t storm_class, uint32_t rate, uint32_t burst )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL || *ecm_handle == NULL )
+    if( ecm_handle == NULL || (uint32_t)storm_class >= CY_ECM_STORM_CLASS_COUNT || ( rate != 0u && burst == 0u ) )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
         return CY_RSLT_MODULE_ECM_BADARG;
     }
 
-    ecm_obj = (cy_ecm_object_t *)*ecm_handle;
-
-    if( ecm_obj->isobjinitialized != true )
+    if( !is_ecm_initialized )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -594,71 +3536,41 @@ cy_rslt_t cy_ecm_ethif_deinit( cy_ecm_t *ecm_handle )
         return CY_RSLT_ECM_MUTEX_ERROR;
     }
 
-    is_ecm_thread_created--;
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
 
-    /* Terminate the connect/disconnect event thread */
-    if( is_ecm_thread_created == 0 )
+    if( ecm_obj->isobjinitialized != true )
     {
-        if( ecm_event_thread != NULL )
-        {
-            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nTerminating ECM event thread %p..!\n", ecm_event_thread );
-            result = cy_rtos_terminate_thread( &ecm_event_thread );
-            if( result != CY_RSLT_SUCCESS )
-            {
-                cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\nTerminate ECM event thread failed with Error : [0x%X] ", (unsigned int)result );
-                /* Fall-through. It's intentional. */
-            }
-
-            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nJoining ECM event thread %p..!\n", ecm_event_thread );
-            result = cy_rtos_join_thread( &ecm_event_thread );
-            if( result != CY_RSLT_SUCCESS )
-            {
-                cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\nJoin ECM event thread failed with Error : [0x%X] ", (unsigned int)result );
-                /* Fall-through. It's intentional. */
-            }
-            ecm_event_thread = NULL;
-        }
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
     }
 
-    if( cy_rtos_deinit_mutex( &( ecm_obj->obj_mutex ) ) != CY_RSLT_SUCCESS )
+    result = cy_eth_set_storm_control( ecm_obj->eth_idx, storm_class, rate, burst );
+    if( result != CY_RSLT_SUCCESS )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Mutex deinit failed with result = 0x%X\n", (unsigned long)result );
-        /* Intentional fallthrough */
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid storm control burst: %u \n", (unsigned int)burst );
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Deinit object mutex : %p..!\n", ecm_obj->obj_mutex );
-
-    deregister_cb(ecm_obj->eth_base_type);
-
-    is_ethernet_initiated[ecm_obj->eth_idx] = false;
-    ecm_obj->iface_context = NULL;
-
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "ecm_obj : %p..!\n", ecm_obj );
 
-    free( ecm_obj );
-
-    *ecm_handle = NULL;
-
-    result = cy_rtos_set_mutex( &ecm_mutex );
-    if( result != CY_RSLT_SUCCESS )
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed with result = 0x%X\n", (unsigned long)result );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_set_promiscuous_mode(cy_ecm_t ecm_handle, bool is_promiscuous_mode)
+cy_rslt_t cy_ecm_get_storm_stats( cy_ecm_t ecm_handle, cy_ecm_storm_stats_t *stats )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL )
+    if( ecm_handle == NULL || stats == NULL )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
         return CY_RSLT_MODULE_ECM_BADARG;
@@ -670,7 +3582,6 @@ cy_rslt_t cy_ecm_set_promiscuous_mode(cy_ecm_t ecm_handle, bool is_promiscuous_m
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -687,18 +3598,9 @@ cy_rslt_t cy_ecm_set_promiscuous_mode(cy_ecm_t ecm_handle, bool is_promiscuous_m
         goto exit;
     }
 
-    /* Check if ethernet is up */
-    if( is_ethernet_initiated[ecm_obj->eth_idx] == false )
-    {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM is not initiated for eth_idx: [%d] \n",ecm_obj->eth_idx );
-        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
-        goto exit;
-    }
-
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "ecm_obj->eth_base_type:[%p]\n",ecm_obj->eth_base_type );
-
-    /* Disable/Enable copy all frames. If 1 enables copy all frames mode, if 0 then this is disabled */
-    Cy_ETHIF_SetPromiscuousMode( ecm_obj->eth_base_type, is_promiscuous_mode );
+    ecm_poll_lock();
+    ecm_storm_fill_stats( ecm_obj, stats );
+    ecm_poll_unlock();
 
 exit:
     if( cy_rtos_set_mutex( &ecm_mutex ) )
@@ -706,21 +3608,20 @@ exit:
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_broadcast_disable(cy_ecm_t ecm_handle, bool is_broadcast_disable)
+cy_rslt_t cy_ecm_capture_start( cy_ecm_t ecm_handle, const cy_ecm_capture_config_t *config )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL )
+    if( ecm_handle == NULL || config == NULL )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
         return CY_RSLT_MODULE_ECM_BADARG;
@@ -732,7 +3633,6 @@ cy_rslt_t cy_ecm_broadcast_disable(cy_ecm_t ecm_handle, bool is_broadcast_disabl
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -749,7 +3649,7 @@ cy_rslt_t cy_ecm_broadcast_disable(cy_ecm_t ecm_handle, bool is_broadcast_disabl
         goto exit;
     }
 
-    //Check whether Ethernet is up
+    /* Check if ethernet is up */
     if( is_ethernet_initiated[ecm_obj->eth_idx] == false )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM is not initiated for eth_idx: [%d] \n",ecm_obj->eth_idx );
@@ -757,10 +3657,11 @@ cy_rslt_t cy_ecm_broadcast_disable(cy_ecm_t ecm_handle, bool is_broadcast_disabl
         goto exit;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "ecm_obj->eth_base_type:[%p]\n",ecm_obj->eth_base_type );
-
-    /* Reject/Accept Broad cast frames. If 0 broadcasts are accepted, if 1 they are rejected */
-    Cy_ETHIF_SetNoBroadCast( ecm_obj->eth_base_type, is_broadcast_disable );
+    result = cy_eth_capture_start( ecm_obj->eth_idx, config );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Capture start failed with result = 0x%X\n", (unsigned long)result );
+    }
 
 exit:
     if( cy_rtos_set_mutex( &ecm_mutex ) )
@@ -768,23 +3669,20 @@ exit:
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_set_filter_address(cy_ecm_t ecm_handle, cy_ecm_filter_address_t *filter_address, uint8_t filter_address_count)
+cy_rslt_t cy_ecm_capture_stop( cy_ecm_t ecm_handle )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
-    cy_en_ethif_status_t ethStatus;
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL || filter_address == NULL || filter_address_count == 0
-            || ( filter_address_count > CY_ECM_MAX_FILTER_ADDRESS ) )
+    if( ecm_handle == NULL )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
         return CY_RSLT_MODULE_ECM_BADARG;
@@ -796,7 +3694,6 @@ cy_rslt_t cy_ecm_set_filter_address(cy_ecm_t ecm_handle, cy_ecm_filter_address_t
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -813,32 +3710,7 @@ cy_rslt_t cy_ecm_set_filter_address(cy_ecm_t ecm_handle, cy_ecm_filter_address_t
         goto exit;
     }
 
-    /* Check if ethernet is up */
-    if( is_ethernet_initiated[ecm_obj->eth_idx] == false )
-    {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM is not initiated for eth_idx: [%d] \n",ecm_obj->eth_idx );
-        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
-        goto exit;
-    }
-
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "ecm_obj->eth_base_type:[%p]\n",ecm_obj->eth_base_type );
-
-    for( int i = 0; i < filter_address_count; i++ )
-    {
-        cy_stc_ethif_filter_config_t filter_config;
-        filter_config.typeFilter = ( cy_en_ethif_filter_type_t )filter_address[i].filter_type;
-        memcpy( (void*)&(filter_config.filterAddr.byte[0]), (void*)&(filter_address[i].filter_addr[0]), CY_ECM_MAC_ADDR_LEN );
-        filter_config.ignoreBytes = filter_address->ignoreBytes;
-
-        /* Filter settings */
-        ethStatus = Cy_ETHIF_SetFilterAddress( ecm_obj->eth_base_type, (cy_en_ethif_filter_num_t)(i+1), &filter_config );
-        if( CY_ETHIF_SUCCESS != ethStatus )
-        {
-            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n setting filter address failed \n" );
-            result = CY_RSLT_ECM_ERROR;
-            goto exit;
-        }
-    }
+    cy_eth_capture_stop( ecm_obj->eth_idx );
 
 exit:
     if( cy_rtos_set_mutex( &ecm_mutex ) )
@@ -846,31 +3718,24 @@ exit:
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_connect( cy_ecm_t ecm_handle, cy_ecm_ip_setting_t *ecm_static_ip_addr, cy_ecm_ip_address_t *ip_addr )
+cy_rslt_t cy_ecm_capture_read( cy_ecm_t ecm_handle, uint8_t *buffer, uint32_t size, uint32_t *length )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
-    cy_network_static_ip_addr_t nw_static_ipaddr, *static_ipaddr = NULL;
-    cy_nw_ip_address_t ipv4_addr;
-    uint32_t total_wait_time = 0, linkstatus = 0;
-#ifdef ENABLE_ECM_LOGS
-    char ip_str[15];
-#endif
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL )
+    if( ecm_handle == NULL || buffer == NULL || length == NULL )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid handle Arguments \n" );
-        return  CY_RSLT_MODULE_ECM_BADARG;
-     }
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
 
     if( !is_ecm_initialized )
     {
@@ -878,7 +3743,6 @@ cy_rslt_t cy_ecm_connect( cy_ecm_t ecm_handle, cy_ecm_ip_setting_t *ecm_static_i
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -895,133 +3759,56 @@ cy_rslt_t cy_ecm_connect( cy_ecm_t ecm_handle, cy_ecm_ip_setting_t *ecm_static_i
         goto exit;
     }
 
-    /* Check whether the connection is already established */
-    if( ecm_obj->network_up == true )
-    {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library already connected \n" );
-        result = CY_RSLT_MODULE_ECM_ALREADY_CONNECTED;
-        goto exit;
-    }
+    *length = cy_eth_capture_read( ecm_obj->eth_idx, buffer, size );
 
-    if( ecm_static_ip_addr != NULL )
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
     {
-        if( ecm_static_ip_addr->gateway.version == CY_ECM_IP_VER_V4 )
-        {
-            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\n Static IP address not NULL\n" );
-            nw_static_ipaddr.gateway.ip.v4 = ecm_static_ip_addr->gateway.ip.v4;
-            nw_static_ipaddr.addr.ip.v4    = ecm_static_ip_addr->ip_address.ip.v4;
-            nw_static_ipaddr.netmask.ip.v4 = ecm_static_ip_addr->netmask.ip.v4;
-            static_ipaddr = &nw_static_ipaddr;
-        }
-        else
-        {
-            /* TO DO : Copy the IPv6 address */
-            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Static IP address not supported\n" );
-            result = CY_RSLT_ECM_STATIC_IP_NOT_SUPPORTED;
-            goto exit;
-        }
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
+        result = CY_RSLT_ECM_MUTEX_ERROR;
     }
 
-    //Add the Ethernet interface
-    result = cy_network_add_nw_interface( CY_NETWORK_ETH_INTERFACE, ecm_obj->eth_idx, (void *)ecm_obj->eth_base_type, ecm_obj->mac_address, static_ipaddr, &ecm_obj->iface_context );
-    if(result != CY_RSLT_SUCCESS)
-    {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "failed to add the network interface \n" );
-        result = CY_RSLT_ECM_INTERFACE_ERROR;
-        goto exit;
-    }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
-    /* Register to IP address change callback from the lwIP stack. All other internal callbacks are in ECM */
-    cy_network_register_ip_change_cb( ecm_obj->iface_context, ip_change_callback, NULL );
+    return result;
+}
 
-    //Check whether the Ethernet link status is up; call interface network_up()
-    if( is_ethernet_link_up[ecm_obj->eth_idx] != true )
-    {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Waiting for Link up... \n" );
-        while( total_wait_time < MAX_WAIT_ETHERNET_PHY_STATUS )
-        {
-            result = ecm_obj->eth_phy_cb.phy_get_linkstatus((uint8_t)ecm_obj->eth_idx, &linkstatus);
-            if(result == CY_RSLT_SUCCESS)
-            {
-                if(linkstatus == 1)
-                {
-                    break;
-                }
-            }
-            cy_rtos_delay_milliseconds(WAIT_CHECK_ETHERNET_PHY_STATUS);
-            total_wait_time += WAIT_CHECK_ETHERNET_PHY_STATUS;
-            continue;
-        }
+cy_rslt_t cy_ecm_get_capture_stats( cy_ecm_t ecm_handle, cy_ecm_capture_stats_t *stats )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_ecm_object_t *ecm_obj;
 
-        if( total_wait_time >= MAX_WAIT_ETHERNET_PHY_STATUS )
-        {
-            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Ethernet link is not up :[%d] \n", total_wait_time );
-            result = CY_RSLT_ECM_ERROR;
-            goto exit;
-        }
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Ethernet Link is up \n" );
-        is_ethernet_link_up[ecm_obj->eth_idx] = true;
+    if( ecm_handle == NULL || stats == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
     }
 
-    result = cy_network_ip_up( ecm_obj->iface_context );
-    if( result != CY_RSLT_SUCCESS )
+    if( !is_ecm_initialized )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "failed to bring up the network stack :[%d] \n",result );
-        if( (cy_network_remove_nw_interface( ecm_obj->iface_context )) != CY_RSLT_SUCCESS )
-        {
-            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "failed to remove the network interface \n" );
-        }
-        if(result == CY_RSLT_NETWORK_ERROR_STARTING_DHCP)
-        {
-            result = CY_RSLT_MODULE_ECM_ERROR_STARTING_DHCP;
-        }
-        else if(result == CY_RSLT_NETWORK_DHCP_WAIT_TIMEOUT)
-        {
-            result = CY_RSLT_ECM_DHCP_TIMEOUT;
-        }
-        goto exit;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    total_wait_time = 0;
-    /** Wait in a busy loop until DHCP starts and IP address is assigned **/
-    while ( true )
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
     {
-        result = cy_network_get_ip_address( ecm_obj->iface_context, &ipv4_addr );
-        if( result == CY_RSLT_SUCCESS )
-        {
-#ifdef ENABLE_ECM_LOGS
-            cy_nw_ntoa( &ipv4_addr, ip_str );
-            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "IPV4 Address %s assigned \n", ip_str );
-#endif
-            if( ip_addr != NULL )
-            {
-                ip_addr->version = CY_ECM_IP_VER_V4;
-                ip_addr->ip.v4 = ipv4_addr.ip.v4;
-            }
-            break;
-        }
-        /* TO DO : get ipv6 address */
-        /* Delay of 10 ms */
-        cy_rtos_delay_milliseconds( RETRY_WAIT_TIME_GET_IP_ADDR );
-        /* Increment the count for every 10 ms */
-        total_wait_time += RETRY_WAIT_TIME_GET_IP_ADDR;
-        /* Return DHCP timeout error when it exceeds 6000 * 10 ms = 60 seconds */
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
     }
-    if( total_wait_time > DHCP_TIMEOUT_COUNT )
-    {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "DHCP Timeout \n" );
 
-        // Bring network down and remove network interface as DHCP failed
-        cy_network_ip_down(ecm_obj->iface_context);
-        cy_network_remove_nw_interface(ecm_obj->iface_context);
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
 
-        /* Return DHCP timeout error when DHCP discovery failed and disconnect is done properly */
-        result = CY_RSLT_ECM_DHCP_TIMEOUT;
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
         goto exit;
     }
 
-    ecm_obj->network_up = true;
+    cy_eth_capture_get_stats( ecm_obj->eth_idx, stats );
 
 exit:
     if( cy_rtos_set_mutex( &ecm_mutex ) )
@@ -1029,21 +3816,22 @@ exit:
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_disconnect( cy_ecm_t ecm_handle )
+cy_rslt_t cy_ecm_mirror_start( cy_ecm_t ecm_handle, const cy_ecm_mirror_config_t *config )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
-    cy_ecm_object_t *ecm_obj;
+    cy_ecm_object_t *ecm_obj, *dest_obj;
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL )
+    if( ecm_handle == NULL || config == NULL || config->destination == NULL || config->destination == ecm_handle ||
+        config->rate == 0u || config->burst == 0u || config->queue >= CY_ECM_TX_QUEUE_COUNT ||
+        ( config->mirror_rx == false && config->mirror_tx == false ) )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
         return CY_RSLT_MODULE_ECM_BADARG;
@@ -1055,7 +3843,6 @@ cy_rslt_t cy_ecm_disconnect( cy_ecm_t ecm_handle )
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -1072,22 +3859,35 @@ cy_rslt_t cy_ecm_disconnect( cy_ecm_t ecm_handle )
         goto exit;
     }
 
-    /* Check connection established for disconnection */
-    if( ecm_obj->network_up == false )
+    /* Check if ethernet is up */
+    if( is_ethernet_initiated[ecm_obj->eth_idx] == false )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not connected \n" );
-        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM is not initiated for eth_idx: [%d] \n",ecm_obj->eth_idx );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
         goto exit;
     }
 
-    /* Register to ip change callback from LwIP, all other internal callbacks are in ECM */
-    cy_network_register_ip_change_cb( ecm_obj->iface_context, NULL, NULL );
+    dest_obj = (cy_ecm_object_t *)config->destination;
+    if( dest_obj->isobjinitialized != true || is_ethernet_initiated[dest_obj->eth_idx] == false )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Mirror destination not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
 
-    //Bring down the Ethernet interface
-    cy_network_ip_down( ecm_obj->iface_context );
-    cy_network_remove_nw_interface( ecm_obj->iface_context );
+    /* The destination transmits the mirrored frames only */
+    if( dest_obj->network_up == true || cy_eth_is_polled_mode( dest_obj->eth_idx ) == true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Mirror destination eth_idx: [%d] is connected or polled \n", dest_obj->eth_idx );
+        result = CY_RSLT_ECM_BUSY;
+        goto exit;
+    }
 
-    ecm_obj->network_up = false;
+    result = cy_eth_mirror_start( ecm_obj->eth_idx, dest_obj->eth_idx, config );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Mirror start failed with result = 0x%X\n", (unsigned long)result );
+    }
 
 exit:
     if( cy_rtos_set_mutex( &ecm_mutex ) )
@@ -1095,21 +3895,20 @@ exit:
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_register_event_callback( cy_ecm_t ecm_handle, cy_ecm_event_callback_t event_callback )
+cy_rslt_t cy_ecm_mirror_stop( cy_ecm_t ecm_handle )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL || event_callback == NULL )
+    if( ecm_handle == NULL )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
         return CY_RSLT_MODULE_ECM_BADARG;
@@ -1121,7 +3920,6 @@ cy_rslt_t cy_ecm_register_event_callback( cy_ecm_t ecm_handle, cy_ecm_event_call
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -1138,38 +3936,28 @@ cy_rslt_t cy_ecm_register_event_callback( cy_ecm_t ecm_handle, cy_ecm_event_call
         goto exit;
     }
 
-    for ( int i = 0; i < CY_ECM_MAXIMUM_CALLBACKS_COUNT; i++ )
-    {
-        if( ecm_event_handler[i] == NULL )
-        {
-            ecm_event_handler[i] = event_callback;
-            break;
-        }
-    }
+    cy_eth_mirror_stop( ecm_obj->eth_idx );
 
 exit:
-    result = cy_rtos_set_mutex( &ecm_mutex );
-    if( result != CY_RSLT_SUCCESS )
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed with result = 0x%X\n", (unsigned long)result );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
-
 }
 
-cy_rslt_t cy_ecm_deregister_event_callback( cy_ecm_t ecm_handle, cy_ecm_event_callback_t event_callback )
+cy_rslt_t cy_ecm_get_mirror_stats( cy_ecm_t ecm_handle, cy_ecm_mirror_stats_t *stats )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL || event_callback == NULL )
+    if( ecm_handle == NULL || stats == NULL )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
         return CY_RSLT_MODULE_ECM_BADARG;
@@ -1181,7 +3969,6 @@ cy_rslt_t cy_ecm_deregister_event_callback( cy_ecm_t ecm_handle, cy_ecm_event_ca
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -1198,39 +3985,29 @@ cy_rslt_t cy_ecm_deregister_event_callback( cy_ecm_t ecm_handle, cy_ecm_event_ca
         goto exit;
     }
 
-    for ( int i = 0; i < CY_ECM_MAXIMUM_CALLBACKS_COUNT; i++ )
-    {
-        if( ecm_event_handler[i] == event_callback )
-        {
-            memset( &ecm_event_handler[i], 0, sizeof( cy_ecm_event_callback_t ) );
-            result = CY_RSLT_SUCCESS;;
-            goto exit;
-        }
-    }
+    cy_eth_get_mirror_stats( ecm_obj->eth_idx, stats );
 
 exit:
-    result = cy_rtos_set_mutex( &ecm_mutex );
-    if( result != CY_RSLT_SUCCESS )
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed with result = 0x%X\n", (unsigned long)result );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_get_link_status( cy_ecm_t ecm_handle, bool *status )
+cy_rslt_t cy_ecm_set_vlan_config( cy_ecm_t ecm_handle, const cy_ecm_vlan_config_t *config )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
-    uint32_t total_wait_time = 0, linkstatus = 0;
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL || status == NULL )
+    if( ecm_handle == NULL || config == NULL || config->pvid > CY_ECM_VLAN_ID_MAX ||
+        ( config->tag_tx && config->pvid == CY_ECM_VLAN_ID_NONE ) )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
         return CY_RSLT_MODULE_ECM_BADARG;
@@ -1242,7 +4019,6 @@ cy_rslt_t cy_ecm_get_link_status( cy_ecm_t ecm_handle, bool *status )
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -1251,55 +4027,46 @@ cy_rslt_t cy_ecm_get_link_status( cy_ecm_t ecm_handle, bool *status )
     }
 
     ecm_obj = (cy_ecm_object_t *)ecm_handle;
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\n before reading link status = %d \n",*status );
 
-    while( total_wait_time < (uint32_t )MAX_WAIT_ETHERNET_PHY_STATUS )
+    if( ecm_obj->isobjinitialized != true )
     {
-        result = ecm_obj->eth_phy_cb.phy_get_linkstatus((uint8_t)ecm_obj->eth_idx, &linkstatus);
-        if(result == CY_RSLT_SUCCESS)
-        {
-            if(linkstatus == 1)
-            {
-                *status = true;
-                break;
-            }
-        }
-        cy_rtos_delay_milliseconds( WAIT_CHECK_ETHERNET_PHY_STATUS );
-        total_wait_time += WAIT_CHECK_ETHERNET_PHY_STATUS;
-        continue;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
     }
 
-    if( total_wait_time >= MAX_WAIT_ETHERNET_PHY_STATUS )
+    /* Check if ethernet is up */
+    if( is_ethernet_initiated[ecm_obj->eth_idx] == false )
     {
-        result = CY_RSLT_SUCCESS;
-        *status = false;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM is not initiated for eth_idx: [%d] \n",ecm_obj->eth_idx );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\n After reading link status = %d \n",*status );
 
+    cy_eth_set_vlan_config( ecm_obj->eth_idx, config );
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "VLAN configuration: PVID %u, filter %d, strip %d, tag %d \n", (unsigned int)config->pvid,
+                    (int)config->filter, (int)config->strip_rx, (int)config->tag_tx );
+
+exit:
     if( cy_rtos_set_mutex( &ecm_mutex ) )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed \n" );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_get_ip_address( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *ip_addr )
+cy_rslt_t cy_ecm_set_vlan_member( cy_ecm_t ecm_handle, uint16_t vlan_id, bool is_member )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
-    cy_nw_ip_address_t ipv4_addr;
-#ifdef ENABLE_ECM_LOGS
-    char ip_str[15];
-#endif
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL || ip_addr == NULL )
+    if( ecm_handle == NULL || vlan_id == CY_ECM_VLAN_ID_NONE || vlan_id > CY_ECM_VLAN_ID_MAX )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
         return CY_RSLT_MODULE_ECM_BADARG;
@@ -1311,7 +4078,6 @@ cy_rslt_t cy_ecm_get_ip_address( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *ip_ad
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -1321,75 +4087,54 @@ cy_rslt_t cy_ecm_get_ip_address( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *ip_ad
 
     ecm_obj = (cy_ecm_object_t *)ecm_handle;
 
-    /* Check whether the network is up */
-    if( ecm_obj->network_up == false )
+    if( ecm_obj->isobjinitialized != true )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Network is not up, call cy_ecm_connect API to bring network up \r\n" );
-        /** Network is not up and therefore, mem setting the IP address to zero**/
-        memset( ip_addr, 0, sizeof( cy_ecm_ip_address_t ) );
-        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
         goto exit;
     }
 
-    result = cy_network_get_ip_address( ecm_obj->iface_context, &ipv4_addr );
-    if( result != CY_RSLT_SUCCESS )
+    /* Check if ethernet is up */
+    if( is_ethernet_initiated[ecm_obj->eth_idx] == false )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to get the IP address\n" );
-        result = CY_RSLT_ECM_IP_ADDR_ERROR;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM is not initiated for eth_idx: [%d] \n",ecm_obj->eth_idx );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
         goto exit;
     }
-    ip_addr->version = CY_ECM_IP_VER_V4;
-    ip_addr->ip.v4 = ipv4_addr.ip.v4;
-#ifdef ENABLE_ECM_LOGS
-    cy_nw_ntoa( &ipv4_addr, ip_str );
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "IP Address %s assigned \n", ip_str );
-#endif
+
+    cy_eth_set_vlan_member( ecm_obj->eth_idx, vlan_id, is_member );
 
 exit:
-    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed with result = 0x%X\n", (unsigned long)result );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_get_ipv6_address( cy_ecm_t ecm_handle, cy_ecm_ipv6_type_t ipv6_addr_type, cy_ecm_ip_address_t *ip_addr )
+cy_rslt_t cy_ecm_get_vlan_stats( cy_ecm_t ecm_handle, cy_ecm_vlan_stats_t *stats )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
-    cy_nw_ip_address_t ipv6_addr;
-    cy_network_ipv6_type_t type;
-#ifdef ENABLE_ECM_LOGS
-    char ip_str[39];
-#endif
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-     if( ecm_handle == NULL || ip_addr == NULL )
-     {
-         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
-         return CY_RSLT_MODULE_ECM_BADARG;
-     }
-
-     if( !is_ecm_initialized )
-     {
-         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
-         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
-     }
+    if( ecm_handle == NULL || stats == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
 
-     if( ipv6_addr_type != CY_ECM_IPV6_LINK_LOCAL )
-     {
-         /*TODO : Need to add support for Global IPV6 address */
-         return CY_RSLT_ECM_IPV6_GLOBAL_ADDRESS_NOT_SUPPORTED;
-     }
-     type = CY_NETWORK_IPV6_LINK_LOCAL;
+    if( !is_ecm_initialized )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Ethernet connection manager library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
 
-     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -1399,63 +4144,43 @@ cy_rslt_t cy_ecm_get_ipv6_address( cy_ecm_t ecm_handle, cy_ecm_ipv6_type_t ipv6_
 
     ecm_obj = (cy_ecm_object_t *)ecm_handle;
 
-    /* Check whether the network is up */
-    if( ecm_obj->network_up == false )
-    {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Network is not up, call cy_ecm_connect API to bring network up \r\n" );
-        /** Network is not up and therefore, mem setting the IP address to zero**/
-        memset( ip_addr, 0, sizeof( cy_ecm_ip_address_t ) );
-        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
-        goto exit;
-    }
-
-    result = cy_network_get_ipv6_address( ecm_obj->iface_context, type, &ipv6_addr );
-    if( result == CY_RSLT_SUCCESS )
+    if( ecm_obj->isobjinitialized != true )
     {
-        ip_addr->version = CY_ECM_IP_VER_V6;
-        ip_addr->ip.v6[0] = ipv6_addr.ip.v6[0];
-        ip_addr->ip.v6[1] = ipv6_addr.ip.v6[1];
-        ip_addr->ip.v6[2] = ipv6_addr.ip.v6[2];
-        ip_addr->ip.v6[3] = ipv6_addr.ip.v6[3];
-
-#ifdef ENABLE_ECM_LOGS
-        cy_nw_ntoa_ipv6( &ipv6_addr, ip_str );
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "IPV6 Address %s assigned \n", ip_str );
-#endif
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
     }
-    else
+
+    /* Check if ethernet is up */
+    if( is_ethernet_initiated[ecm_obj->eth_idx] == false )
     {
-        memset( ip_addr, 0, sizeof( cy_ecm_ip_address_t ) );
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "IPV6 network not ready \n" );
-        result = CY_RSLT_ECM_IPV6_INTERFACE_NOT_READY;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM is not initiated for eth_idx: [%d] \n",ecm_obj->eth_idx );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
         goto exit;
     }
 
+    cy_eth_get_vlan_stats( ecm_obj->eth_idx, stats );
+
 exit:
-    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed with result = 0x%X\n", (unsigned long)result );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_get_gateway_address( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *gateway_addr )
+cy_rslt_t cy_ecm_set_priority_map( cy_ecm_t ecm_handle, const cy_ecm_priority_map_t *map )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
-    cy_nw_ip_address_t ipv4_addr;
-#ifdef ENABLE_ECM_LOGS
-    char ip_str[15];
-#endif
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL || gateway_addr == NULL )
+    if( ecm_handle == NULL || map == NULL )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
         return CY_RSLT_MODULE_ECM_BADARG;
@@ -1467,7 +4192,6 @@ cy_rslt_t cy_ecm_get_gateway_address( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -1477,56 +4201,47 @@ cy_rslt_t cy_ecm_get_gateway_address( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *
 
     ecm_obj = (cy_ecm_object_t *)ecm_handle;
 
-    /* Check whether the network is up */
-    if( ecm_obj->network_up == false )
+    if( ecm_obj->isobjinitialized != true )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Network is not up, call connect API to bring network up \r\n" );
-        /** Network is not up and therefore, mem setting the IP address to zero**/
-        memset( gateway_addr, 0, sizeof( cy_ecm_ip_address_t ) );
-        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
         goto exit;
     }
 
-    result = cy_network_get_gateway_ip_address( ecm_obj->iface_context, &ipv4_addr );
-    if( result != CY_RSLT_SUCCESS )
+    /* Check if ethernet is up */
+    if( is_ethernet_initiated[ecm_obj->eth_idx] == false )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to get the gateway address\n" );
-        result = CY_RSLT_ECM_GATEWAY_ADDR_ERROR;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM is not initiated for eth_idx: [%d] \n",ecm_obj->eth_idx );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
         goto exit;
     }
-    gateway_addr->version = CY_ECM_IP_VER_V4;
-    gateway_addr->ip.v4 = ipv4_addr.ip.v4;
-#ifdef ENABLE_ECM_LOGS
-    cy_nw_ntoa( &ipv4_addr, ip_str );
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Gateway IP Address %s assigned \n", ip_str );
-#endif
+
+    result = cy_eth_set_priority_map( ecm_obj->eth_idx, map );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Priority map uses a disabled queue or an invalid priority code point \n" );
+    }
 
 exit:
-    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to release the mutex \n" );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
-
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_get_netmask_address( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *net_mask_addr )
+cy_rslt_t cy_ecm_get_priority_map( cy_ecm_t ecm_handle, cy_ecm_priority_map_t *map )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
-    cy_nw_ip_address_t ipv4_addr;
-#ifdef ENABLE_ECM_LOGS
-    char ip_str[15];
-#endif
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL || net_mask_addr == NULL )
+    if( ecm_handle == NULL || map == NULL )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
         return CY_RSLT_MODULE_ECM_BADARG;
@@ -1538,7 +4253,6 @@ cy_rslt_t cy_ecm_get_netmask_address( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -1548,53 +4262,80 @@ cy_rslt_t cy_ecm_get_netmask_address( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *
 
     ecm_obj = (cy_ecm_object_t *)ecm_handle;
 
-    /* Check whether the network is up */
-    if( ecm_obj->network_up == false )
+    if( ecm_obj->isobjinitialized != true )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Network is not up, call connect API to bring network up \r\n" );
-        /** Network is not up and therefore, mem setting the IP address to zero**/
-        memset( net_mask_addr, 0, sizeof( cy_ecm_ip_address_t ) );
-        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
         goto exit;
     }
 
-    result = cy_network_get_netmask_address( ecm_obj->iface_context, &ipv4_addr );
-    if( result != CY_RSLT_SUCCESS )
+    /* Check if ethernet is up */
+    if( is_ethernet_initiated[ecm_obj->eth_idx] == false )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to get the gateway address\n" );
-        result = CY_RSLT_ECM_GATEWAY_ADDR_ERROR;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "\nECM is not initiated for eth_idx: [%d] \n",ecm_obj->eth_idx );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
         goto exit;
     }
-    net_mask_addr->version = CY_ECM_IP_VER_V4;
-    net_mask_addr->ip.v4 = ipv4_addr.ip.v4;
-#ifdef ENABLE_ECM_LOGS
-    cy_nw_ntoa( &ipv4_addr, ip_str );
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Gateway IP Address %s assigned \n", ip_str );
-#endif
+
+    cy_eth_get_priority_map( ecm_obj->eth_idx, map );
 
 exit:
-    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to release the mutex \n" );
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
-
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_get_mac_address( cy_ecm_t ecm_handle, cy_ecm_mac_t *mac_addr )
+cy_rslt_t cy_ecm_raw_send_priority( cy_ecm_t ecm_handle, const uint8_t *frame, uint32_t length, uint8_t priority )
+{
+    cy_ecm_object_t *ecm_obj = (cy_ecm_object_t *)ecm_handle;
+    cy_rslt_t result;
+
+    if( ecm_obj == NULL || frame == NULL || length < CY_ECM_RAW_FRAME_MIN_LEN || length > CY_ECM_RAW_FRAME_MAX_LEN ||
+        ( priority >= CY_ECM_PRIORITY_COUNT && priority != CY_ECM_PRIORITY_DSCP ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    if( !is_ecm_initialized || ( ecm_obj->isobjinitialized != true ) || ( is_ethernet_initiated[ecm_obj->eth_idx] == false ) )
+    {
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+#if defined(COMPONENT_LWIP) && LWIP_TCPIP_CORE_LOCKING
+    /* The network stack transmits with its core lock held; the same lock keeps the PDL Tx path single-threaded */
+    LOCK_TCPIP_CORE();
+    result = cy_eth_raw_send_priority( ecm_obj->eth_idx, frame, length, priority );
+    UNLOCK_TCPIP_CORE();
+#else
+    result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
+        return CY_RSLT_ECM_MUTEX_ERROR;
+    }
+    result = cy_eth_raw_send_priority( ecm_obj->eth_idx, frame, length, priority );
+    (void)cy_rtos_set_mutex( &ecm_mutex );
+#endif
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_add_ip_alias( cy_ecm_t ecm_handle, const cy_ecm_ip_address_t *ip_addr, const cy_ecm_ip_address_t *netmask )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
-    cy_nw_ip_mac_t nw_mac_addr;
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL || mac_addr == NULL )
+    if( ecm_handle == NULL || ip_addr == NULL || netmask == NULL || ip_addr->version != CY_ECM_IP_VER_V4 ||
+        netmask->version != CY_ECM_IP_VER_V4 || ip_addr->ip.v4 == 0u )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
         return CY_RSLT_MODULE_ECM_BADARG;
@@ -1606,64 +4347,115 @@ cy_rslt_t cy_ecm_get_mac_address( cy_ecm_t ecm_handle, cy_ecm_mac_t *mac_addr )
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Acquire lock failed with result = 0x%X\n", (unsigned long)result );
-        result = CY_RSLT_ECM_MUTEX_ERROR;
-        goto exit;
+        return CY_RSLT_ECM_MUTEX_ERROR;
     }
 
     ecm_obj = (cy_ecm_object_t *)ecm_handle;
 
-    /* check for network up */
-    if( ecm_obj->network_up == false )
+    if( ecm_obj->isobjinitialized != true )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Network is not up, call connect API to bring network up \r\n" );
-        /** Network is not up and hence mem setting the gateway MAC address to zero**/
-        memset( mac_addr , 0, sizeof( cy_ecm_mac_t ) );
-        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
         goto exit;
     }
 
-    result = cy_network_get_gateway_mac_address( ecm_obj->iface_context, &nw_mac_addr );
-    if( result != CY_RSLT_SUCCESS )
+#ifdef ECM_IP_ALIAS_SUPPORTED
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to get the gateway mac address address\n" );
-        result = CY_RSLT_ECM_GATEWAY_ADDR_ERROR;
-        goto exit;
-    }
+        ecm_ip_alias_netifs_t *aliases = &ecm_ip_alias_netifs[ecm_obj->eth_idx];
+        uint32_t index = CY_ECM_IP_ALIAS_MAX;
+        bool is_duplicate = false;
 
-    (*mac_addr)[0] = nw_mac_addr.mac[0];
-    (*mac_addr)[1] = nw_mac_addr.mac[1];
-    (*mac_addr)[2] = nw_mac_addr.mac[2];
-    (*mac_addr)[3] = nw_mac_addr.mac[3];
-    (*mac_addr)[4] = nw_mac_addr.mac[4];
-    (*mac_addr)[5] = nw_mac_addr.mac[5];
+        /* The address must not be in use on the link already, as the address or an alias of either interface */
+        LOCK_TCPIP_CORE();
+        for( uint32_t j = 0; j < CY_ECM_ETH_INTERFACE_MAX; j++ )
+        {
+            if( ( ecm_ip_alias_netifs[j].primary != NULL ) &&
+                ( netif_ip4_addr( ecm_ip_alias_netifs[j].primary )->addr == ip_addr->ip.v4 ) )
+            {
+                is_duplicate = true;
+            }
+            for( uint32_t i = 0; ( ecm_obj_list[j] != NULL ) && ( i < CY_ECM_IP_ALIAS_MAX ); i++ )
+            {
+                if( ecm_obj_list[j]->ip_alias[i].is_used && ( ecm_obj_list[j]->ip_alias[i].address == ip_addr->ip.v4 ) )
+                {
+                    is_duplicate = true;
+                }
+            }
+        }
+        UNLOCK_TCPIP_CORE();
+        if( is_duplicate )
+        {
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n IP alias is the address of an interface or already added \n" );
+            result = CY_RSLT_MODULE_ECM_BADARG;
+            goto exit;
+        }
 
-exit: 
-    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+        for( uint32_t i = 0; i < CY_ECM_IP_ALIAS_MAX; i++ )
+        {
+            if( !ecm_obj->ip_alias[i].is_used )
+            {
+                index = i;
+                break;
+            }
+        }
+
+        if( index == CY_ECM_IP_ALIAS_MAX )
+        {
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n No free IP alias entry \n" );
+            result = CY_RSLT_ECM_ERROR_NOMEM;
+            goto exit;
+        }
+
+        ecm_obj->ip_alias[index].address = ip_addr->ip.v4;
+        ecm_obj->ip_alias[index].netmask = netmask->ip.v4;
+
+        /* Not connected; the alias is attached by cy_ecm_connect */
+        if( aliases->primary != NULL )
+        {
+            bool is_attached;
+
+            LOCK_TCPIP_CORE();
+            is_attached = ecm_ip_alias_attach( aliases, index, &ecm_obj->ip_alias[index] );
+            UNLOCK_TCPIP_CORE();
+            if( !is_attached )
+            {
+                cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Failed to add the network interface of the IP alias \n" );
+                result = CY_RSLT_ECM_INTERFACE_ERROR;
+                goto exit;
+            }
+        }
+        ecm_obj->ip_alias[index].is_used = true;
+    }
+#else
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n IP aliases require lwIP with LWIP_TCPIP_CORE_LOCKING \n" );
+    result = CY_RSLT_ECM_NOT_SUPPORTED;
+    goto exit;
+#endif
+
+exit:
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
     {
-        cy_ecm_log_msg(CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to release the mutex \n");
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
-
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_ping( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *address, uint32_t timeout_ms, uint32_t* elapsed_time_ms )
+cy_rslt_t cy_ecm_remove_ip_alias( cy_ecm_t ecm_handle, const cy_ecm_ip_address_t *ip_addr )
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL || address == NULL || elapsed_time_ms == NULL )
+    if( ecm_handle == NULL || ip_addr == NULL || ip_addr->version != CY_ECM_IP_VER_V4 )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
         return CY_RSLT_MODULE_ECM_BADARG;
@@ -1675,7 +4467,6 @@ cy_rslt_t cy_ecm_ping( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *address, uint32
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -1685,46 +4476,67 @@ cy_rslt_t cy_ecm_ping( cy_ecm_t ecm_handle, cy_ecm_ip_address_t *address, uint32
 
     ecm_obj = (cy_ecm_object_t *)ecm_handle;
 
-    /* check for network up */
-    if( ecm_obj->network_up == false )
+    if( ecm_obj->isobjinitialized != true )
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Network is not up, call connect API to bring network up \r\n" );
-        result = CY_RSLT_MODULE_ECM_NOT_CONNECTED;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
         goto exit;
     }
 
-    result = cy_network_ping( (void *)ecm_obj->iface_context, (cy_nw_ip_address_t *) address, timeout_ms, elapsed_time_ms );
-    if( result != CY_RSLT_SUCCESS )
+#ifdef ECM_IP_ALIAS_SUPPORTED
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Ping failure with result = 0x%X\n", (unsigned long)result );
-        result = CY_RSLT_ECM_PING_FAILURE;
-        goto exit;
+        ecm_ip_alias_netifs_t *aliases = &ecm_ip_alias_netifs[ecm_obj->eth_idx];
+        uint32_t index;
+
+        for( index = 0; index < CY_ECM_IP_ALIAS_MAX; index++ )
+        {
+            if( ecm_obj->ip_alias[index].is_used && ( ecm_obj->ip_alias[index].address == ip_addr->ip.v4 ) )
+            {
+                break;
+            }
+        }
+
+        if( index == CY_ECM_IP_ALIAS_MAX )
+        {
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n IP alias not found \n" );
+            result = CY_RSLT_MODULE_ECM_BADARG;
+            goto exit;
+        }
+
+        if( aliases->is_attached[index] )
+        {
+            LOCK_TCPIP_CORE();
+            ecm_ip_alias_detach( aliases, index );
+            UNLOCK_TCPIP_CORE();
+        }
+        ecm_obj->ip_alias[index].is_used = false;
     }
+#else
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n IP aliases require lwIP with LWIP_TCPIP_CORE_LOCKING \n" );
+    result = CY_RSLT_ECM_NOT_SUPPORTED;
+    goto exit;
+#endif
 
 exit:
-    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
     {
-        cy_ecm_log_msg(CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to release the mutex \n");
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
-
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
 }
 
-cy_rslt_t cy_ecm_get_link_speed( cy_ecm_t ecm_handle, cy_ecm_duplex_t *duplex, cy_ecm_phy_speed_t *speed )
+cy_rslt_t cy_ecm_get_ip_aliases( cy_ecm_t ecm_handle, cy_ecm_ip_address_t ip_addr[CY_ECM_IP_ALIAS_MAX], uint32_t *count )
 {
-    cy_rslt_t        result = CY_RSLT_SUCCESS;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_ecm_object_t *ecm_obj;
-    uint32_t         total_wait_time = 0;
-    uint32_t         mode = 0, phy_speed = 0, link_status = 0;
 
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
 
-    if( ecm_handle == NULL || duplex == NULL || speed == NULL )
+    if( ecm_handle == NULL || ip_addr == NULL || count == NULL )
     {
         cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
         return CY_RSLT_MODULE_ECM_BADARG;
@@ -1736,7 +4548,6 @@ cy_rslt_t cy_ecm_get_link_speed( cy_ecm_t ecm_handle, cy_ecm_duplex_t *duplex, c
         return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Acquire global mutex : %p..!\n", ecm_mutex );
     result = cy_rtos_get_mutex( &ecm_mutex, CY_RTOS_NEVER_TIMEOUT );
     if( result != CY_RSLT_SUCCESS )
     {
@@ -1746,39 +4557,31 @@ cy_rslt_t cy_ecm_get_link_speed( cy_ecm_t ecm_handle, cy_ecm_duplex_t *duplex, c
 
     ecm_obj = (cy_ecm_object_t *)ecm_handle;
 
-    /* Check whether the link is up*/
-    while( total_wait_time < (uint32_t )MAX_WAIT_ETHERNET_PHY_STATUS )
+    if( ecm_obj->isobjinitialized != true )
     {
-        result = ecm_obj->eth_phy_cb.phy_get_linkstatus((uint8_t)ecm_obj->eth_idx, &link_status);
-        if(result == CY_RSLT_SUCCESS)
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        result = CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+        goto exit;
+    }
+
+    *count = 0;
+    for( uint32_t i = 0; i < CY_ECM_IP_ALIAS_MAX; i++ )
+    {
+        if( ecm_obj->ip_alias[i].is_used )
         {
-            if(link_status == true)
-            {
-                result = ecm_obj->eth_phy_cb.phy_get_linkspeed((uint8_t)ecm_obj->eth_idx, &mode, &phy_speed);
-                if(result == CY_RSLT_SUCCESS)
-                {
-                    *duplex = (cy_ecm_duplex_t)mode;
-                    *speed = (cy_ecm_phy_speed_t)phy_speed;
-                    goto exit;
-                }
-            }
+            ip_addr[*count].version = CY_ECM_IP_VER_V4;
+            ip_addr[*count].ip.v4   = ecm_obj->ip_alias[i].address;
+            (*count)++;
         }
-
-        cy_rtos_delay_milliseconds( WAIT_CHECK_ETHERNET_PHY_STATUS );
-        total_wait_time += WAIT_CHECK_ETHERNET_PHY_STATUS;
     }
 
-    result = CY_RSLT_ECM_ERROR;
-
 exit:
-    if( cy_rtos_set_mutex( &ecm_mutex ) != CY_RSLT_SUCCESS )
+    if( cy_rtos_set_mutex( &ecm_mutex ) )
     {
-        cy_ecm_log_msg(CYLF_MIDDLEWARE, CY_LOG_ERR, "Failed to release the mutex \n");
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Release global lock failed\n" );
         result = CY_RSLT_ECM_MUTEX_ERROR;
     }
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Release global mutex : %p..!\n", ecm_mutex );
-
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): END \n", __FUNCTION__ );
 
     return result;
@@ -0,0 +1,675 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file cy_ecm_capture.c
+* @brief Packet capture of the Ethernet Connection Manager. Frames of one interface are selected by a filter program
+* in the classic BPF encoding and copied, up to a snap length, into a ring of pcap records that the application drains
+* in pcap format.
+*
+* The filter runs in the receive path, so it is validated when the capture starts: only forward jumps within the
+* program are accepted and the program ends with a return, so every frame is decided in at most as many instructions
+* as the program has. A frame the filter rejects costs the filter run only; nothing is copied or timestamped. The
+* port mirroring selects its frames with the same filters.
+*
+* The interrupts are disabled only to reserve the space of a record; the frame is copied after, and the records are
+* handed to the reader once no record in front of them is still being written.
+*/
+
+#include <string.h>
+#include <stdbool.h>
+
+#include "cy_ecm.h"
+#include "cy_ecm_error.h"
+#include "cyabs_rtos.h"
+#include "eth_internal.h"
+#include "cy_sysint.h"
+
+#include "cy_log.h"
+
+/******************************************************
+ *                      Macros
+ ******************************************************/
+#ifdef ENABLE_ECM_LOGS
+#define cy_ecm_log_msg cy_log_msg
+#else
+#define cy_ecm_log_msg(a,b,c,...)
+#endif
+
+#if (CY_ECM_CAPTURE_RING_SIZE < 256u) || ((CY_ECM_CAPTURE_RING_SIZE % 4u) != 0u)
+#error "cy_eth_user_config.h: CY_ECM_CAPTURE_RING_SIZE must be a multiple of 4, of at least 256 bytes"
+#endif
+
+/* Classic BPF encoding */
+#define BPF_CLASS(code)             ((code) & 0x07u)
+#define BPF_LD                      (0x00u)
+#define BPF_LDX                     (0x01u)
+#define BPF_ST                      (0x02u)
+#define BPF_STX                     (0x03u)
+#define BPF_ALU                     (0x04u)
+#define BPF_JMP                     (0x05u)
+#define BPF_RET                     (0x06u)
+#define BPF_MISC                    (0x07u)
+
+#define BPF_W                       (0x00u)
+#define BPF_H                       (0x08u)
+#define BPF_B                       (0x10u)
+#define BPF_IMM                     (0x00u)
+#define BPF_ABS                     (0x20u)
+#define BPF_IND                     (0x40u)
+#define BPF_MEM                     (0x60u)
+#define BPF_LEN                     (0x80u)
+#define BPF_MSH                     (0xA0u)
+
+#define BPF_ADD                     (0x00u)
+#define BPF_SUB                     (0x10u)
+#define BPF_MUL                     (0x20u)
+#define BPF_DIV                     (0x30u)
+#define BPF_OR                      (0x40u)
+#define BPF_AND                     (0x50u)
+#define BPF_LSH                     (0x60u)
+#define BPF_RSH                     (0x70u)
+#define BPF_NEG                     (0x80u)
+#define BPF_MOD                     (0x90u)
+#define BPF_XOR                     (0xA0u)
+
+#define BPF_JA                      (0x00u)
+#define BPF_JEQ                     (0x10u)
+#define BPF_JGT                     (0x20u)
+#define BPF_JGE                     (0x30u)
+#define BPF_JSET                    (0x40u)
+
+#define BPF_K                       (0x00u)
+#define BPF_X                       (0x08u)
+#define BPF_A                       (0x10u)
+
+#define BPF_TAX                     (0x00u)
+#define BPF_TXA                     (0x80u)
+
+#define BPF_MEMWORDS                (16u)
+
+/* pcap file format, microsecond timestamps, Ethernet link type */
+#define PCAP_MAGIC                  (0xA1B2C3D4UL)
+#define PCAP_VERSION_MAJOR          (2u)
+#define PCAP_VERSION_MINOR          (4u)
+#define PCAP_LINKTYPE_ETHERNET      (1u)
+#define PCAP_SNAPLEN_MAX            (65535u)
+
+/* Marks the end of the records before the ring wraps around */
+#define CAPTURE_WRAP_MARKER         (0xFFFFFFFFUL)
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+typedef struct
+{
+    uint32_t ts_sec;
+    uint32_t ts_usec;
+    uint32_t incl_len;
+    uint32_t orig_len;
+} capture_record_hdr_t;
+
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    int32_t  thiszone;
+    uint32_t sigfigs;
+    uint32_t snaplen;
+    uint32_t linktype;
+} capture_file_hdr_t;
+
+typedef struct
+{
+    uint32_t              snap_len;
+    uint32_t              filter_len;
+    cy_ecm_capture_insn_t filter[CY_ECM_CAPTURE_FILTER_MAX_LEN];
+} capture_program_t;
+
+typedef struct
+{
+    cy_ecm_interface_t    eth_idx;
+    capture_program_t     program[2];           /* A new program is written to the one not in use and then switched to */
+    uint32_t              active;               /* Index of the program run on the frames */
+    uint32_t              program_users[2];     /* Frames being filtered with each program */
+    uint32_t              writers;              /* Records reserved but not written yet */
+    bool                  is_header_pending;    /* pcap file header not read yet */
+    uint32_t              head;                 /* Offset of the oldest record */
+    uint32_t              tail;                 /* Offset of the next record */
+    uint32_t              reserved;             /* Bytes from head to tail, including the skipped end of the ring */
+    uint32_t              used;                 /* Bytes from head that the reader can take; all reserved once no record is being written */
+    uint32_t              matched;
+    uint32_t              rejected;
+    uint32_t              dropped;
+} capture_state_t;
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+volatile uint8_t cy_eth_capture_flags[CY_ECM_ETH_INTERFACE_MAX];
+
+static capture_state_t capture;
+static uint32_t capture_ring[CY_ECM_CAPTURE_RING_SIZE / sizeof(uint32_t)];
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+/* Checks a filter program before it is run; see cy_eth_filter_run() */
+bool cy_eth_filter_validate(const cy_ecm_capture_insn_t *filter, uint32_t filter_len)
+{
+    for(uint32_t pc = 0; pc < filter_len; pc++)
+    {
+        const cy_ecm_capture_insn_t *insn = &filter[pc];
+        uint32_t remaining = filter_len - pc - 1u;
+
+        switch(BPF_CLASS(insn->code))
+        {
+            case BPF_LD:
+                if((insn->code == (BPF_LD | BPF_MEM)) && (insn->k >= BPF_MEMWORDS))
+                {
+                    return false;
+                }
+                if((insn->code != (BPF_LD | BPF_W | BPF_ABS)) && (insn->code != (BPF_LD | BPF_H | BPF_ABS)) &&
+                   (insn->code != (BPF_LD | BPF_B | BPF_ABS)) && (insn->code != (BPF_LD | BPF_W | BPF_IND)) &&
+                   (insn->code != (BPF_LD | BPF_H | BPF_IND)) && (insn->code != (BPF_LD | BPF_B | BPF_IND)) &&
+                   (insn->code != (BPF_LD | BPF_W | BPF_LEN)) && (insn->code != (BPF_LD | BPF_IMM)) &&
+                   (insn->code != (BPF_LD | BPF_MEM)))
+                {
+                    return false;
+                }
+                break;
+
+            case BPF_LDX:
+                if((insn->code == (BPF_LDX | BPF_MEM)) && (insn->k >= BPF_MEMWORDS))
+                {
+                    return false;
+                }
+                if((insn->code != (BPF_LDX | BPF_W | BPF_IMM)) && (insn->code != (BPF_LDX | BPF_W | BPF_LEN)) &&
+                   (insn->code != (BPF_LDX | BPF_B | BPF_MSH)) && (insn->code != (BPF_LDX | BPF_MEM)))
+                {
+                    return false;
+                }
+                break;
+
+            case BPF_ST:
+            case BPF_STX:
+                if((insn->code != BPF_ST) && (insn->code != BPF_STX))
+                {
+                    return false;
+                }
+                if(insn->k >= BPF_MEMWORDS)
+                {
+                    return false;
+                }
+                break;
+
+            case BPF_ALU:
+                if((insn->code & 0xF0u) > BPF_XOR)
+                {
+                    return false;
+                }
+                if((((insn->code & 0xF0u) == BPF_DIV) || ((insn->code & 0xF0u) == BPF_MOD)) &&
+                   ((insn->code & BPF_X) == 0u) && (insn->k == 0u))
+                {
+                    return false;
+                }
+                break;
+
+            case BPF_JMP:
+                if((insn->code & 0xF0u) == BPF_JA)
+                {
+                    if(insn->k >= remaining)
+                    {
+                        return false;
+                    }
+                }
+                else if(((insn->code & 0xF0u) > BPF_JSET) || (insn->jt >= remaining) || (insn->jf >= remaining))
+                {
+                    return false;
+                }
+                break;
+
+            case BPF_RET:
+                if((insn->code != (BPF_RET | BPF_K)) && (insn->code != (BPF_RET | BPF_A)))
+                {
+                    return false;
+                }
+                break;
+
+            default: /* BPF_MISC */
+                if((insn->code != (BPF_MISC | BPF_TAX)) && (insn->code != (BPF_MISC | BPF_TXA)))
+                {
+                    return false;
+                }
+                break;
+        }
+    }
+
+    /* The program cannot run past its end */
+    return (filter_len > 0u) && (BPF_CLASS(filter[filter_len - 1u].code) == BPF_RET);
+}
+
+static inline bool capture_load(const uint8_t *frame, uint32_t length, uint32_t offset, uint32_t size, uint32_t *value)
+{
+    if((offset >= length) || (size > (length - offset)))
+    {
+        return false;
+    }
+    frame += offset;
+    *value = (size == 4u) ? (((uint32_t)frame[0] << 24) | ((uint32_t)frame[1] << 16) | ((uint32_t)frame[2] << 8) | frame[3]) :
+             (size == 2u) ? (((uint32_t)frame[0] << 8) | frame[1]) : frame[0];
+    return true;
+}
+
+/* Runs a validated filter; returns the number of bytes to capture, 0 to reject the frame */
+uint32_t cy_eth_filter_run(const cy_ecm_capture_insn_t *insn, const uint8_t *frame, uint32_t length)
+{
+    uint32_t a = 0, x = 0, mem[BPF_MEMWORDS] = { 0 };
+    uint32_t size;
+
+    for(;; insn++)
+    {
+        switch(insn->code)
+        {
+            case BPF_LD | BPF_W | BPF_ABS:
+            case BPF_LD | BPF_H | BPF_ABS:
+            case BPF_LD | BPF_B | BPF_ABS:
+                size = ((insn->code & 0x18u) == BPF_W) ? 4u : (((insn->code & 0x18u) == BPF_H) ? 2u : 1u);
+                if(!capture_load(frame, length, insn->k, size, &a))
+                {
+                    return 0;
+                }
+                break;
+            case BPF_LD | BPF_W | BPF_IND:
+            case BPF_LD | BPF_H | BPF_IND:
+            case BPF_LD | BPF_B | BPF_IND:
+                size = ((insn->code & 0x18u) == BPF_W) ? 4u : (((insn->code & 0x18u) == BPF_H) ? 2u : 1u);
+                if((x + insn->k < x) || !capture_load(frame, length, x + insn->k, size, &a))
+                {
+                    return 0;
+                }
+                break;
+            case BPF_LD | BPF_W | BPF_LEN:   a = length; break;
+            case BPF_LD | BPF_IMM:           a = insn->k; break;
+            case BPF_LD | BPF_MEM:           a = mem[insn->k]; break;
+            case BPF_LDX | BPF_W | BPF_IMM:  x = insn->k; break;
+            case BPF_LDX | BPF_W | BPF_LEN:  x = length; break;
+            case BPF_LDX | BPF_MEM:          x = mem[insn->k]; break;
+            case BPF_LDX | BPF_B | BPF_MSH:
+                if(insn->k >= length)
+                {
+                    return 0;
+                }
+                x = (uint32_t)(frame[insn->k] & 0x0Fu) << 2;
+                break;
+            case BPF_ST:                     mem[insn->k] = a; break;
+            case BPF_STX:                    mem[insn->k] = x; break;
+
+            case BPF_ALU | BPF_ADD | BPF_K:  a += insn->k; break;
+            case BPF_ALU | BPF_SUB | BPF_K:  a -= insn->k; break;
+            case BPF_ALU | BPF_MUL | BPF_K:  a *= insn->k; break;
+            case BPF_ALU | BPF_DIV | BPF_K:  a /= insn->k; break;
+            case BPF_ALU | BPF_MOD | BPF_K:  a %= insn->k; break;
+            case BPF_ALU | BPF_OR  | BPF_K:  a |= insn->k; break;
+            case BPF_ALU | BPF_AND | BPF_K:  a &= insn->k; break;
+            case BPF_ALU | BPF_XOR | BPF_K:  a ^= insn->k; break;
+            case BPF_ALU | BPF_LSH | BPF_K:  a = (insn->k < 32u) ? (a << insn->k) : 0u; break;
+            case BPF_ALU | BPF_RSH | BPF_K:  a = (insn->k < 32u) ? (a >> insn->k) : 0u; break;
+            case BPF_ALU | BPF_ADD | BPF_X:  a += x; break;
+            case BPF_ALU | BPF_SUB | BPF_X:  a -= x; break;
+            case BPF_ALU | BPF_MUL | BPF_X:  a *= x; break;
+            case BPF_ALU | BPF_OR  | BPF_X:  a |= x; break;
+            case BPF_ALU | BPF_AND | BPF_X:  a &= x; break;
+            case BPF_ALU | BPF_XOR | BPF_X:  a ^= x; break;
+            case BPF_ALU | BPF_LSH | BPF_X:  a = (x < 32u) ? (a << x) : 0u; break;
+            case BPF_ALU | BPF_RSH | BPF_X:  a = (x < 32u) ? (a >> x) : 0u; break;
+            case BPF_ALU | BPF_DIV | BPF_X:
+                if(x == 0u)
+                {
+                    return 0;
+                }
+                a /= x;
+                break;
+            case BPF_ALU | BPF_MOD | BPF_X:
+                if(x == 0u)
+                {
+                    return 0;
+                }
+                a %= x;
+                break;
+            case BPF_ALU | BPF_NEG:
+            case BPF_ALU | BPF_NEG | BPF_X:
+                a = (uint32_t)(-(int32_t)a);
+                break;
+
+            case BPF_JMP | BPF_JA:           insn += insn->k; break;
+            case BPF_JMP | BPF_JEQ | BPF_K:  insn += (a == insn->k) ? insn->jt : insn->jf; break;
+            case BPF_JMP | BPF_JGT | BPF_K:  insn += (a > insn->k) ? insn->jt : insn->jf; break;
+            case BPF_JMP | BPF_JGE | BPF_K:  insn += (a >= insn->k) ? insn->jt : insn->jf; break;
+            case BPF_JMP | BPF_JSET | BPF_K: insn += ((a & insn->k) != 0u) ? insn->jt : insn->jf; break;
+            case BPF_JMP | BPF_JEQ | BPF_X:  insn += (a == x) ? insn->jt : insn->jf; break;
+            case BPF_JMP | BPF_JGT | BPF_X:  insn += (a > x) ? insn->jt : insn->jf; break;
+            case BPF_JMP | BPF_JGE | BPF_X:  insn += (a >= x) ? insn->jt : insn->jf; break;
+            case BPF_JMP | BPF_JSET | BPF_X: insn += ((a & x) != 0u) ? insn->jt : insn->jf; break;
+
+            case BPF_RET | BPF_K:            return insn->k;
+            case BPF_RET | BPF_A:            return a;
+
+            case BPF_MISC | BPF_TAX:         x = a; break;
+            case BPF_MISC | BPF_TXA:         a = x; break;
+
+            default:
+                return 0;
+        }
+    }
+}
+
+/* Reserves a contiguous record in the ring; called with the interrupts disabled */
+static bool capture_reserve(uint32_t need, uint32_t *offset)
+{
+    uint32_t free_end;
+
+    if(capture.reserved == 0u)
+    {
+        capture.head = 0;
+        capture.tail = 0;
+    }
+
+    if((capture.tail > capture.head) || (capture.reserved == 0u))
+    {
+        free_end = CY_ECM_CAPTURE_RING_SIZE - capture.tail;
+        if(need <= free_end)
+        {
+            *offset = capture.tail;
+            return true;
+        }
+        if(need > capture.head)
+        {
+            return false;
+        }
+        /* Skip the end of the ring */
+        capture_ring[capture.tail / sizeof(uint32_t)] = CAPTURE_WRAP_MARKER;
+        capture.reserved += free_end;
+        capture.tail = 0;
+        *offset = 0;
+        return true;
+    }
+
+    if(need > (capture.head - capture.tail))
+    {
+        return false;
+    }
+    *offset = capture.tail;
+    return true;
+}
+
+void cy_eth_capture_frame(const uint8_t *frame, uint32_t length)
+{
+    const capture_program_t *program;
+    capture_record_hdr_t *hdr;
+    cy_time_t now = 0;
+    uint32_t incl_len, need, offset, state, program_idx;
+
+    /* Frames are captured from the receive path and from the raw frame send of the application threads. The program
+     * in use is pinned so that a capture start does not rewrite it under the filter run. */
+    state = Cy_SysLib_EnterCriticalSection();
+    program_idx = capture.active;
+    capture.program_users[program_idx]++;
+    Cy_SysLib_ExitCriticalSection(state);
+
+    program = &capture.program[program_idx];
+    incl_len = (program->filter_len == 0u) ? length : cy_eth_filter_run(program->filter, frame, length);
+    if(incl_len > length)
+    {
+        incl_len = length;
+    }
+    if((program->snap_len != 0u) && (incl_len > program->snap_len))
+    {
+        incl_len = program->snap_len;
+    }
+    need = (sizeof(capture_record_hdr_t) + incl_len + 3u) & ~3u;
+
+    if(incl_len != 0u)
+    {
+        (void)cy_rtos_get_time(&now);
+    }
+
+    /* Only the space is reserved with the interrupts disabled; the record is written after */
+    state = Cy_SysLib_EnterCriticalSection();
+    capture.program_users[program_idx]--;
+    if(incl_len == 0u)
+    {
+        capture.rejected++;
+        Cy_SysLib_ExitCriticalSection(state);
+        return;
+    }
+    capture.matched++;
+    if((need > CY_ECM_CAPTURE_RING_SIZE) || !capture_reserve(need, &offset))
+    {
+        capture.dropped++;
+        Cy_SysLib_ExitCriticalSection(state);
+        return;
+    }
+    capture.tail = ((offset + need) == CY_ECM_CAPTURE_RING_SIZE) ? 0u : (offset + need);
+    capture.reserved += need;
+    capture.writers++;
+    Cy_SysLib_ExitCriticalSection(state);
+
+    hdr = (capture_record_hdr_t *)&capture_ring[offset / sizeof(uint32_t)];
+    hdr->ts_sec   = (uint32_t)now / 1000u;
+    hdr->ts_usec  = ((uint32_t)now % 1000u) * 1000u;
+    hdr->incl_len = incl_len;
+    hdr->orig_len = length;
+    memcpy(hdr + 1, frame, incl_len);
+
+    /* A record interrupted by the receive path is published with the one that interrupted it; the records are read
+     * in ring order, so none is handed out before the ones in front of it are written */
+    __DMB();
+    state = Cy_SysLib_EnterCriticalSection();
+    capture.writers--;
+    if(capture.writers == 0u)
+    {
+        capture.used = capture.reserved;
+    }
+    Cy_SysLib_ExitCriticalSection(state);
+}
+
+cy_rslt_t cy_eth_capture_start(cy_ecm_interface_t eth_idx, const cy_ecm_capture_config_t *config)
+{
+    capture_program_t *program;
+    uint32_t state, program_idx;
+    bool is_reset = false;
+
+    if((config->filter_len > CY_ECM_CAPTURE_FILTER_MAX_LEN) || ((config->filter_len != 0u) && (config->filter == NULL)) ||
+       ((config->filter_len != 0u) && !cy_eth_filter_validate(config->filter, config->filter_len)))
+    {
+        return CY_RSLT_ECM_INVALID_FILTER;
+    }
+
+    for(uint32_t i = 0; i < CY_ECM_ETH_INTERFACE_MAX; i++)
+    {
+        if((i != (uint32_t)eth_idx) && (cy_eth_capture_flags[i] != 0u))
+        {
+            return CY_RSLT_ECM_BUSY;
+        }
+    }
+
+    state = Cy_SysLib_EnterCriticalSection();
+    cy_eth_capture_flags[eth_idx] = 0;
+    Cy_SysLib_ExitCriticalSection(state);
+
+    /* A Tx thread that saw the capture running may still be filtering with the program in use. The new program is
+     * written to the other one, which no frame can pick up, once the frames filtered with it are done. */
+    program_idx = capture.active ^ 1u;
+    while(capture.program_users[program_idx] != 0u)
+    {
+        cy_rtos_delay_milliseconds(1);
+    }
+    program = &capture.program[program_idx];
+    program->snap_len = config->snap_len;
+    program->filter_len = config->filter_len;
+    if(config->filter_len != 0u)
+    {
+        memcpy(program->filter, config->filter, config->filter_len * sizeof(cy_ecm_capture_insn_t));
+    }
+    __DMB();
+
+    /* The ring is emptied once no record is being written */
+    while(!is_reset)
+    {
+        state = Cy_SysLib_EnterCriticalSection();
+        if(capture.writers == 0u)
+        {
+            capture.active = program_idx;
+            capture.eth_idx = eth_idx;
+            capture.is_header_pending = true;
+            capture.head = 0;
+            capture.tail = 0;
+            capture.reserved = 0;
+            capture.used = 0;
+            capture.matched = 0;
+            capture.rejected = 0;
+            capture.dropped = 0;
+            is_reset = true;
+        }
+        Cy_SysLib_ExitCriticalSection(state);
+        if(!is_reset)
+        {
+            cy_rtos_delay_milliseconds(1);
+        }
+    }
+
+    __DMB();
+    cy_eth_capture_flags[eth_idx] = (uint8_t)(CY_ETH_CAPTURE_RX | (config->capture_tx ? CY_ETH_CAPTURE_TX : 0u));
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cy_eth_capture_stop(cy_ecm_interface_t eth_idx)
+{
+    /* The records already captured can still be read */
+    cy_eth_capture_flags[eth_idx] = 0;
+}
+
+uint32_t cy_eth_capture_read(cy_ecm_interface_t eth_idx, uint8_t *buffer, uint32_t size)
+{
+    const capture_record_hdr_t *hdr;
+    uint32_t used, pos, consumed = 0, out = 0, record, state;
+
+    if(capture.eth_idx != eth_idx)
+    {
+        return 0;
+    }
+
+    if(capture.is_header_pending)
+    {
+        const capture_program_t *program = &capture.program[capture.active];
+        capture_file_hdr_t file_hdr =
+        {
+            .magic         = PCAP_MAGIC,
+            .version_major = PCAP_VERSION_MAJOR,
+            .version_minor = PCAP_VERSION_MINOR,
+            .thiszone      = 0,
+            .sigfigs       = 0,
+            .snaplen       = ((program->snap_len != 0u) && (program->snap_len < PCAP_SNAPLEN_MAX)) ? program->snap_len : PCAP_SNAPLEN_MAX,
+            .linktype      = PCAP_LINKTYPE_ETHERNET
+        };
+
+        if(size < sizeof(file_hdr))
+        {
+            return 0;
+        }
+        memcpy(buffer, &file_hdr, sizeof(file_hdr));
+        out = sizeof(file_hdr);
+        capture.is_header_pending = false;
+    }
+
+    /* The published bytes hold complete records; new records are only written to the free part of the ring */
+    state = Cy_SysLib_EnterCriticalSection();
+    used = capture.used;
+    pos = capture.head;
+    Cy_SysLib_ExitCriticalSection(state);
+
+    if(used == 0u)
+    {
+        return out;
+    }
+
+    while(consumed < used)
+    {
+        if(capture_ring[pos / sizeof(uint32_t)] == CAPTURE_WRAP_MARKER)
+        {
+            consumed += CY_ECM_CAPTURE_RING_SIZE - pos;
+            pos = 0;
+            continue;
+        }
+        hdr = (const capture_record_hdr_t *)&capture_ring[pos / sizeof(uint32_t)];
+        record = sizeof(capture_record_hdr_t) + hdr->incl_len;
+        if(record > (size - out))
+        {
+            break;
+        }
+        memcpy(&buffer[out], hdr, record);
+        out += record;
+        record = (record + 3u) & ~3u;
+        consumed += record;
+        pos = ((pos + record) == CY_ECM_CAPTURE_RING_SIZE) ? 0u : (pos + record);
+    }
+
+    state = Cy_SysLib_EnterCriticalSection();
+    capture.head = pos;
+    capture.reserved -= consumed;
+    capture.used -= consumed;
+    Cy_SysLib_ExitCriticalSection(state);
+
+    return out;
+}
+
+void cy_eth_capture_get_stats(cy_ecm_interface_t eth_idx, cy_ecm_capture_stats_t *stats)
+{
+    uint32_t state = Cy_SysLib_EnterCriticalSection();
+
+    memset(stats, 0, sizeof(*stats));
+    stats->eth_idx = eth_idx;
+    stats->is_running = (cy_eth_capture_flags[eth_idx] != 0u);
+    stats->is_tx_captured = ((cy_eth_capture_flags[eth_idx] & CY_ETH_CAPTURE_TX) != 0u);
+    if(capture.eth_idx == eth_idx)
+    {
+        stats->frames_matched  = capture.matched;
+        stats->frames_rejected = capture.rejected;
+        stats->frames_dropped  = capture.dropped;
+        stats->bytes_pending   = capture.reserved;
+    }
+    Cy_SysLib_ExitCriticalSection(state);
+}
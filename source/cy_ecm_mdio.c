@@ -0,0 +1,1079 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file cy_ecm_mdio.c
+* @brief MDIO access layer of the Ethernet Connection Manager. PHY callbacks read and write the PHY registers through
+* this layer, which caches the registers that are safe to cache, coalesces reads within one PHY poll cycle, and
+* collects MDIO transaction statistics. Once the MAC interrupts are enabled, MDIO frames are queued and completed by
+* the management frame interrupt, so callers block instead of busy-waiting on the bus.
+*
+* An MDIO bus is driven by the management port of one Ethernet MAC and may be shared by the PHYs of several
+* interfaces. Each bus has its own lock, transaction engine, and PHY address scan; each interface has its own
+* register cache.
+*/
+
+#include <string.h>
+#include <stdbool.h>
+
+#include "cy_ecm.h"
+#include "cy_ecm_error.h"
+#include "cyabs_rtos.h"
+#include "eth_internal.h"
+#include "cy_sysint.h"
+
+#include "cy_log.h"
+
+/******************************************************
+ *                      Macros
+ ******************************************************/
+#ifdef ENABLE_ECM_LOGS
+#define cy_ecm_log_msg cy_log_msg
+#else
+#define cy_ecm_log_msg(a,b,c,...)
+#endif
+
+#define MDIO_C22_REG_COUNT          (32u)     /* Clause 22 register space */
+#define MDIO_PHY_ADDR_MAX           (31u)
+#define MDIO_PHY_COUNT              (MDIO_PHY_ADDR_MAX + 1u)
+
+/* PHY management register; clause 22 frame */
+#define MDIO_FRAME_C22_START        (0x40000000UL)    /* Start of frame, bits [31:30] = 01 */
+#define MDIO_FRAME_OP_WRITE         (0x10000000UL)    /* Operation, bits [29:28] = 01 */
+#define MDIO_FRAME_OP_READ          (0x20000000UL)    /* Operation, bits [29:28] = 10 */
+#define MDIO_FRAME_PHY_ADDR_POS     (23u)
+#define MDIO_FRAME_REG_ADDR_POS     (18u)
+#define MDIO_FRAME_TURNAROUND       (0x00020000UL)    /* Bits [17:16] = 10 */
+#define MDIO_FRAME_DATA_MSK         (0x0000FFFFUL)
+
+#define MDIO_NETWORK_STATUS_MAN_DONE (0x00000004UL)   /* PHY management logic idle */
+
+#define MDIO_REG_BMCR               (0x00u)
+#define MDIO_BMCR_RESET             (0x8000u)
+#define MDIO_BMCR_RESTART_AN        (0x0200u)
+
+/* MMD access through clause 22, IEEE 802.3 annex 22D */
+#define MDIO_REG_MMDCTRL            (0x0Du)
+#define MDIO_REG_MMDDATA            (0x0Eu)
+#define MDIO_MMDCTRL_DATA           (0x4000u)   /* Function: data, no post increment */
+#define MDIO_MMD_DEVAD_MAX          (31u)
+
+#define MDIO_REG_PHYID1             (0x02u)
+#define MDIO_REG_PHYID2             (0x03u)
+#define MDIO_ADDR_NONE              (0xFFu)
+
+/* Cache policy of a clause 22 register */
+#define MDIO_NO_CACHE               (0u)      /* Latched, clear-on-read, indirect, or vendor specific; always read from the bus */
+#define MDIO_CACHE_CYCLE            (1u)      /* Status; valid until the next PHY poll cycle */
+#define MDIO_CACHE_STATIC           (2u)      /* Identification and configuration; changes only when written, valid until PHY reset */
+
+/******************************************************
+ *             Structures
+ ******************************************************/
+typedef struct
+{
+    bool                 initialized;
+    uint32_t             users;                          /* Interfaces using the bus */
+    cy_mutex_t           mutex;                          /* Serializes the blocking accesses and the register caches of the bus */
+    ETH_Type            *base;                           /* MAC driving the bus */
+    cy_ecm_mdio_stats_t  stats;                          /* Bus counters; the access counters are kept per interface */
+
+    /* PHY address scan, done once on the first access */
+    bool                 scanned;
+    uint32_t             phy_mask;                       /* Addresses that responded */
+    uint32_t             claimed_mask;                   /* Addresses claimed by an interface */
+    uint32_t             phy_id[MDIO_PHY_COUNT];
+    uint32_t             scan_time_us;
+
+    /* Lock contention */
+    uint32_t             lock_count;
+    uint32_t             contended_count;
+    uint32_t             total_wait_us;
+    uint32_t             max_wait_us;
+
+    /* Interrupt-driven transaction engine; the fields below are shared with the Ethernet interrupt */
+    volatile bool        async_enabled;
+    cy_semaphore_t       done_sem;                       /* Completion of the blocking access in flight */
+    cy_ecm_mdio_transaction_t *queue_head[MDIO_PHY_COUNT];  /* One FIFO per PHY address */
+    cy_ecm_mdio_transaction_t *queue_tail[MDIO_PHY_COUNT];
+    uint32_t             queue_mask;                     /* PHY addresses with queued transactions */
+    uint8_t              next_phy;                       /* Round-robin position among the PHY addresses */
+    cy_ecm_mdio_transaction_t *current;                  /* Transaction on the bus; NULL when idle or abandoned */
+    bool                 bus_busy;
+    uint32_t             start_cycles;
+} mdio_bus_t;
+
+typedef struct
+{
+    bool                 initialized;
+    mdio_bus_t          *bus;
+    uint8_t              phy_addr;                       /* PHY address the cached values belong to */
+    uint8_t              claimed_addr;                   /* PHY address claimed through cy_ecm_mdio_find_phy, or MDIO_ADDR_NONE */
+    uint32_t             valid;                          /* One bit per register */
+    uint16_t             value[MDIO_C22_REG_COUNT];
+    uint32_t             reads;
+    uint32_t             cache_hits;
+    uint32_t             poll_cycles;
+} mdio_iface_t;
+
+/******************************************************
+ *                 Static variables
+ ******************************************************/
+static const uint8_t mdio_reg_policy[MDIO_C22_REG_COUNT] =
+{
+    MDIO_CACHE_CYCLE,       /* 0x00 BMCR; the reset and restart bits clear themselves */
+    MDIO_CACHE_CYCLE,       /* 0x01 BMSR; link status latches low and is consumed once per cycle */
+    MDIO_CACHE_STATIC,      /* 0x02 PHY identifier 1 */
+    MDIO_CACHE_STATIC,      /* 0x03 PHY identifier 2 */
+    MDIO_CACHE_STATIC,      /* 0x04 Autonegotiation advertisement */
+    MDIO_CACHE_CYCLE,       /* 0x05 Link partner ability */
+    MDIO_NO_CACHE,          /* 0x06 Autonegotiation expansion; page received clears on read */
+    MDIO_NO_CACHE,          /* 0x07 Next page transmit */
+    MDIO_NO_CACHE,          /* 0x08 Link partner next page */
+    MDIO_CACHE_STATIC,      /* 0x09 1000BASE-T control */
+    MDIO_CACHE_CYCLE,       /* 0x0A 1000BASE-T status */
+    MDIO_NO_CACHE,          /* 0x0B Reserved */
+    MDIO_NO_CACHE,          /* 0x0C Reserved */
+    MDIO_NO_CACHE,          /* 0x0D MMD access control */
+    MDIO_NO_CACHE,          /* 0x0E MMD access address and data */
+    MDIO_CACHE_STATIC,      /* 0x0F Extended status */
+    MDIO_NO_CACHE, MDIO_NO_CACHE, MDIO_NO_CACHE, MDIO_NO_CACHE,     /* 0x10 - 0x1F vendor specific */
+    MDIO_NO_CACHE, MDIO_NO_CACHE, MDIO_NO_CACHE, MDIO_NO_CACHE,
+    MDIO_NO_CACHE, MDIO_NO_CACHE, MDIO_NO_CACHE, MDIO_NO_CACHE,
+    MDIO_NO_CACHE, MDIO_NO_CACHE, MDIO_NO_CACHE, MDIO_NO_CACHE
+};
+
+/* MDIO bus of each interface, indexed by interface; a bus is identified by the interface of the MAC driving it */
+static const uint8_t mdio_bus_of_iface[CY_ECM_ETH_INTERFACE_MAX] =
+{
+    CY_ECM_ETH0_MDIO_BUS,
+    CY_ECM_ETH1_MDIO_BUS
+};
+
+static mdio_bus_t   mdio_bus[CY_ECM_ETH_INTERFACE_MAX];
+static mdio_iface_t mdio_iface[CY_ECM_ETH_INTERFACE_MAX];
+
+/******************************************************
+ *                 Static functions
+ ******************************************************/
+static uint32_t mdio_cycle_mask( void )
+{
+    uint32_t mask = 0;
+    uint32_t reg;
+
+    for( reg = 0; reg < MDIO_C22_REG_COUNT; reg++ )
+    {
+        if( mdio_reg_policy[reg] == MDIO_CACHE_CYCLE )
+        {
+            mask |= ( 1UL << reg );
+        }
+    }
+    return mask;
+}
+
+static uint32_t mdio_cycles_to_us( uint32_t cycles )
+{
+    uint32_t cycles_per_us = SystemCoreClock / 1000000UL;
+
+    return ( cycles_per_us != 0 ) ? ( cycles / cycles_per_us ) : 0;
+}
+
+/* Accounts one MDIO frame; the time is taken from the DWT cycle counter */
+static void mdio_account( mdio_bus_t *bus, uint32_t cycles )
+{
+    uint32_t time_us = mdio_cycles_to_us( cycles );
+
+    bus->stats.bus_time_us += time_us;
+    if( time_us > bus->stats.max_transaction_us )
+    {
+        bus->stats.max_transaction_us = time_us;
+    }
+}
+
+/* Starts the next queued frame, serving the PHY addresses round-robin; called with interrupts disabled */
+static void mdio_start_next( mdio_bus_t *bus )
+{
+    cy_ecm_mdio_transaction_t *txn;
+    uint32_t frame;
+    uint8_t phy = 0;
+    uint32_t i;
+
+    if( ( bus->bus_busy == true ) || ( bus->queue_mask == 0u ) )
+    {
+        return;
+    }
+
+    for( i = 0; i < MDIO_PHY_COUNT; i++ )
+    {
+        phy = (uint8_t)( ( bus->next_phy + i ) % MDIO_PHY_COUNT );
+        if( ( bus->queue_mask & ( 1UL << phy ) ) != 0u )
+        {
+            break;
+        }
+    }
+    bus->next_phy = (uint8_t)( ( phy + 1u ) % MDIO_PHY_COUNT );
+
+    txn = bus->queue_head[phy];
+    bus->queue_head[phy] = txn->next;
+    if( bus->queue_head[phy] == NULL )
+    {
+        bus->queue_tail[phy] = NULL;
+        bus->queue_mask &= ~( 1UL << phy );
+    }
+    txn->next = NULL;
+
+    frame = MDIO_FRAME_C22_START | MDIO_FRAME_TURNAROUND |
+            ( (uint32_t)txn->phy_addr << MDIO_FRAME_PHY_ADDR_POS ) | ( (uint32_t)txn->reg_addr << MDIO_FRAME_REG_ADDR_POS );
+    frame |= ( txn->is_write == true ) ? ( MDIO_FRAME_OP_WRITE | txn->data ) : MDIO_FRAME_OP_READ;
+
+    bus->current = txn;
+    bus->bus_busy = true;
+    bus->start_cycles = DWT->CYCCNT;
+    bus->base->PHY_MANAGEMENT = frame;
+}
+
+/* Completes the frame on the bus; called with interrupts disabled */
+static void mdio_complete( mdio_bus_t *bus )
+{
+    cy_ecm_mdio_transaction_t *txn = bus->current;
+
+    mdio_account( bus, DWT->CYCCNT - bus->start_cycles );
+    bus->bus_busy = false;
+    bus->current = NULL;
+
+    if( txn == NULL )
+    {
+        /* Abandoned by a caller that timed out */
+        return;
+    }
+
+    if( txn->is_write == true )
+    {
+        bus->stats.bus_writes++;
+    }
+    else
+    {
+        bus->stats.bus_reads++;
+        txn->data = (uint16_t)( bus->base->PHY_MANAGEMENT & MDIO_FRAME_DATA_MSK );
+    }
+
+    if( txn->callback != NULL )
+    {
+        txn->callback( txn );
+    }
+}
+
+static void mdio_enqueue( mdio_bus_t *bus, cy_ecm_mdio_transaction_t *txn )
+{
+    uint32_t state;
+
+    txn->next = NULL;
+
+    state = Cy_SysLib_EnterCriticalSection();
+    if( bus->queue_tail[txn->phy_addr] != NULL )
+    {
+        bus->queue_tail[txn->phy_addr]->next = txn;
+    }
+    else
+    {
+        bus->queue_head[txn->phy_addr] = txn;
+    }
+    bus->queue_tail[txn->phy_addr] = txn;
+    bus->queue_mask |= ( 1UL << txn->phy_addr );
+    mdio_start_next( bus );
+    Cy_SysLib_ExitCriticalSection( state );
+}
+
+/* Withdraws a transaction; returns false if it already completed */
+static bool mdio_cancel( mdio_bus_t *bus, cy_ecm_mdio_transaction_t *txn )
+{
+    cy_ecm_mdio_transaction_t **link;
+    cy_ecm_mdio_transaction_t *prev = NULL;
+    bool is_pending = false;
+    uint32_t state;
+
+    state = Cy_SysLib_EnterCriticalSection();
+    if( bus->current == txn )
+    {
+        /* The frame finishes on the bus; its completion is discarded */
+        bus->current = NULL;
+        is_pending = true;
+    }
+    else
+    {
+        for( link = &bus->queue_head[txn->phy_addr]; *link != NULL; link = &( *link )->next )
+        {
+            if( *link == txn )
+            {
+                *link = txn->next;
+                if( bus->queue_tail[txn->phy_addr] == txn )
+                {
+                    bus->queue_tail[txn->phy_addr] = prev;
+                }
+                if( bus->queue_head[txn->phy_addr] == NULL )
+                {
+                    bus->queue_mask &= ~( 1UL << txn->phy_addr );
+                }
+                is_pending = true;
+                break;
+            }
+            prev = *link;
+        }
+    }
+
+    /* Recover the bus if the completion interrupt was lost */
+    if( ( bus->bus_busy == true ) && ( ( bus->base->NETWORK_STATUS & MDIO_NETWORK_STATUS_MAN_DONE ) != 0u ) )
+    {
+        mdio_complete( bus );
+        mdio_start_next( bus );
+    }
+    Cy_SysLib_ExitCriticalSection( state );
+
+    return is_pending;
+}
+
+static void mdio_blocking_done( cy_ecm_mdio_transaction_t *txn )
+{
+    mdio_bus_t *bus = (mdio_bus_t *)txn->arg;
+
+    (void)cy_rtos_set_semaphore( &bus->done_sem, true );
+}
+
+/* Runs one frame and waits for it; called with the bus lock held */
+static cy_rslt_t mdio_bus_transfer( mdio_bus_t *bus, cy_ecm_mdio_transaction_t *txn )
+{
+    uint32_t start;
+
+    if( bus->async_enabled == false )
+    {
+        /* Before the MAC interrupts are enabled, the PDL driver polls the bus */
+        start = DWT->CYCCNT;
+        if( txn->is_write == true )
+        {
+            Cy_ETHIF_PhyRegWrite( bus->base, txn->reg_addr, txn->data, txn->phy_addr );
+            bus->stats.bus_writes++;
+        }
+        else
+        {
+            txn->data = (uint16_t)Cy_ETHIF_PhyRegRead( bus->base, txn->reg_addr, txn->phy_addr );
+            bus->stats.bus_reads++;
+        }
+        mdio_account( bus, DWT->CYCCNT - start );
+        return CY_RSLT_SUCCESS;
+    }
+
+    txn->callback = mdio_blocking_done;
+    txn->arg = bus;
+    mdio_enqueue( bus, txn );
+
+    if( cy_rtos_get_semaphore( &bus->done_sem, CY_ECM_MDIO_TIMEOUT_MS, false ) != CY_RSLT_SUCCESS )
+    {
+        if( mdio_cancel( bus, txn ) == true )
+        {
+            bus->stats.timeouts++;
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "MDIO frame to PHY %u register %u timed out \n", txn->phy_addr, txn->reg_addr );
+            return CY_RSLT_ECM_MDIO_TIMEOUT;
+        }
+        /* Completed while timing out; consume the completion */
+        (void)cy_rtos_get_semaphore( &bus->done_sem, 0, false );
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+static cy_rslt_t mdio_bus_read( mdio_bus_t *bus, uint8_t phy_addr, uint8_t reg_addr, uint16_t *value )
+{
+    cy_ecm_mdio_transaction_t txn;
+    cy_rslt_t result;
+
+    memset( &txn, 0x00, sizeof( txn ) );
+    txn.phy_addr = phy_addr;
+    txn.reg_addr = reg_addr;
+    txn.is_write = false;
+
+    result = mdio_bus_transfer( bus, &txn );
+    *value = txn.data;
+
+    return result;
+}
+
+static cy_rslt_t mdio_bus_write( mdio_bus_t *bus, uint8_t phy_addr, uint8_t reg_addr, uint16_t value )
+{
+    cy_ecm_mdio_transaction_t txn;
+
+    memset( &txn, 0x00, sizeof( txn ) );
+    txn.phy_addr = phy_addr;
+    txn.reg_addr = reg_addr;
+    txn.is_write = true;
+    txn.data     = value;
+
+    return mdio_bus_transfer( bus, &txn );
+}
+
+/* Points the MMD data register of the PHY at a register; called with the bus lock held */
+static cy_rslt_t mdio_mmd_select( mdio_bus_t *bus, uint8_t phy_addr, uint8_t devad, uint16_t reg_addr )
+{
+    cy_rslt_t result;
+
+    result = mdio_bus_write( bus, phy_addr, MDIO_REG_MMDCTRL, devad );
+    if( result == CY_RSLT_SUCCESS )
+    {
+        result = mdio_bus_write( bus, phy_addr, MDIO_REG_MMDDATA, reg_addr );
+    }
+    if( result == CY_RSLT_SUCCESS )
+    {
+        result = mdio_bus_write( bus, phy_addr, MDIO_REG_MMDCTRL, (uint16_t)( MDIO_MMDCTRL_DATA | devad ) );
+    }
+    return result;
+}
+
+
+/* Scans the PHY addresses of the bus; called once, with the bus lock held, on the first access */
+static void mdio_bus_scan( mdio_bus_t *bus )
+{
+    uint32_t start = DWT->CYCCNT;
+    uint16_t id1 = 0, id2 = 0;
+    uint8_t addr;
+
+    bus->scanned = true;
+    for( addr = 0; addr <= MDIO_PHY_ADDR_MAX; addr++ )
+    {
+        /* An address without a PHY reads as all ones; PHYID2 is read only if something drives the bus */
+        if( ( mdio_bus_read( bus, addr, MDIO_REG_PHYID1, &id1 ) != CY_RSLT_SUCCESS ) || ( id1 == 0xFFFFu ) )
+        {
+            continue;
+        }
+        if( ( mdio_bus_read( bus, addr, MDIO_REG_PHYID2, &id2 ) != CY_RSLT_SUCCESS ) || ( ( id1 == 0x0000u ) && ( id2 == 0x0000u ) ) )
+        {
+            continue;
+        }
+        bus->phy_mask |= ( 1UL << addr );
+        bus->phy_id[addr] = ( (uint32_t)id1 << 16 ) | id2;
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "PHY 0x%08lX at MDIO address %u \n", (unsigned long)bus->phy_id[addr], addr );
+    }
+    bus->scan_time_us = mdio_cycles_to_us( DWT->CYCCNT - start );
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "MDIO bus scan: PHY address mask 0x%08lX in %lu us \n",
+                    (unsigned long)bus->phy_mask, (unsigned long)bus->scan_time_us );
+}
+
+/* Returns an initialized interface with the lock of its bus held, or NULL; accounts the time spent waiting for the lock */
+static mdio_iface_t *mdio_acquire( cy_ecm_interface_t eth_idx )
+{
+    mdio_iface_t *iface;
+    mdio_bus_t *bus;
+    uint32_t start;
+    uint32_t wait_us;
+
+    if( (uint32_t)eth_idx >= CY_ECM_ETH_INTERFACE_MAX )
+    {
+        return NULL;
+    }
+
+    iface = &mdio_iface[eth_idx];
+    if( iface->initialized == false )
+    {
+        return NULL;
+    }
+    bus = iface->bus;
+
+    if( cy_rtos_get_mutex( &bus->mutex, 0 ) != CY_RSLT_SUCCESS )
+    {
+        /* Held by the other interface on the bus, or by another task of this one */
+        start = DWT->CYCCNT;
+        if( cy_rtos_get_mutex( &bus->mutex, CY_RTOS_NEVER_TIMEOUT ) != CY_RSLT_SUCCESS )
+        {
+            return NULL;
+        }
+        wait_us = mdio_cycles_to_us( DWT->CYCCNT - start );
+        bus->contended_count++;
+        bus->total_wait_us += wait_us;
+        if( wait_us > bus->max_wait_us )
+        {
+            bus->max_wait_us = wait_us;
+        }
+    }
+    bus->lock_count++;
+
+    return iface;
+}
+
+static void mdio_release( mdio_iface_t *iface )
+{
+    (void)cy_rtos_set_mutex( &iface->bus->mutex );
+}
+
+/* Returns an initialized interface with its bus lock held and the bus scanned, or NULL */
+static mdio_iface_t *mdio_acquire_scanned( cy_ecm_interface_t eth_idx )
+{
+    mdio_iface_t *iface = mdio_acquire( eth_idx );
+
+    if( ( iface != NULL ) && ( iface->bus->scanned == false ) )
+    {
+        mdio_bus_scan( iface->bus );
+    }
+    return iface;
+}
+
+/* Selects the PHY whose registers the cache of the interface holds */
+static void mdio_cache_select( mdio_iface_t *iface, uint8_t phy_addr )
+{
+    if( phy_addr != iface->phy_addr )
+    {
+        iface->phy_addr = phy_addr;
+        iface->valid = 0;
+    }
+}
+
+/******************************************************
+ *               Internal functions
+ ******************************************************/
+cy_rslt_t cy_eth_mdio_init( cy_ecm_interface_t eth_idx, ETH_Type *base )
+{
+    mdio_iface_t *iface = &mdio_iface[eth_idx];
+    uint8_t bus_idx = mdio_bus_of_iface[eth_idx];
+    mdio_bus_t *bus;
+
+    if( bus_idx >= CY_ECM_ETH_INTERFACE_MAX )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Invalid MDIO bus %u for eth_idx: [%d] \n", bus_idx, eth_idx );
+        return CY_RSLT_ECM_INIT_ERROR;
+    }
+    bus = &mdio_bus[bus_idx];
+
+    if( bus->initialized == false )
+    {
+        if( bus_idx != (uint8_t)eth_idx )
+        {
+            /* The bus is driven by the MAC of another interface, which must be initialized first */
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "MDIO bus of eth_idx: [%d] is not initialized \n", eth_idx );
+            return CY_RSLT_ECM_INIT_ERROR;
+        }
+
+        memset( bus, 0x00, sizeof( mdio_bus_t ) );
+        if( cy_rtos_init_mutex2( &bus->mutex, true ) != CY_RSLT_SUCCESS )
+        {
+            return CY_RSLT_ECM_MUTEX_ERROR;
+        }
+        if( cy_rtos_init_semaphore( &bus->done_sem, 1, 0 ) != CY_RSLT_SUCCESS )
+        {
+            (void)cy_rtos_deinit_mutex( &bus->mutex );
+            return CY_RSLT_ECM_ERROR;
+        }
+        bus->base = base;
+        bus->initialized = true;
+
+        /* The cycle counter times the MDIO frames */
+        if( ( DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk ) == 0u )
+        {
+            CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+            DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        }
+    }
+    bus->users++;
+
+    memset( iface, 0x00, sizeof( mdio_iface_t ) );
+    iface->bus = bus;
+    iface->claimed_addr = MDIO_ADDR_NONE;
+    iface->initialized = true;
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cy_eth_mdio_deinit( cy_ecm_interface_t eth_idx )
+{
+    mdio_iface_t *iface = mdio_acquire( eth_idx );
+    mdio_bus_t *bus;
+
+    if( iface == NULL )
+    {
+        return;
+    }
+
+    bus = iface->bus;
+    if( iface->claimed_addr != MDIO_ADDR_NONE )
+    {
+        bus->claimed_mask &= ~( 1UL << iface->claimed_addr );
+    }
+    iface->initialized = false;
+    bus->users--;
+    mdio_release( iface );
+
+    if( bus->users == 0u )
+    {
+        bus->async_enabled = false;
+        bus->initialized = false;
+        (void)cy_rtos_deinit_semaphore( &bus->done_sem );
+        (void)cy_rtos_deinit_mutex( &bus->mutex );
+    }
+}
+
+/* True while the MAC of the interface drives an MDIO bus that another interface still uses */
+bool cy_eth_mdio_is_bus_shared( cy_ecm_interface_t eth_idx )
+{
+    mdio_bus_t *bus = &mdio_bus[eth_idx];
+    bool is_shared;
+
+    if( bus->initialized == false )
+    {
+        return false;
+    }
+
+    (void)cy_rtos_get_mutex( &bus->mutex, CY_RTOS_NEVER_TIMEOUT );
+    is_shared = ( bus->users > 1u );
+    (void)cy_rtos_set_mutex( &bus->mutex );
+
+    return is_shared;
+}
+
+void cy_eth_mdio_set_mdc_frequency( cy_ecm_interface_t eth_idx, uint32_t mdc_hz )
+{
+    /* Recorded on the bus driven by the MAC of the interface */
+    mdio_bus[eth_idx].stats.mdc_frequency_hz = mdc_hz;
+}
+
+/* Completes the frames queued on the bus by polling it; used while the interrupt of the MAC driving the bus is disabled.
+ * The waiters of the completed frames are signaled as from the interrupt. */
+static void mdio_drain( mdio_bus_t *bus )
+{
+    uint32_t state;
+    bool is_idle = false;
+
+    while( is_idle == false )
+    {
+        state = Cy_SysLib_EnterCriticalSection();
+        if( ( bus->bus_busy == true ) && ( ( bus->base->NETWORK_STATUS & MDIO_NETWORK_STATUS_MAN_DONE ) != 0u ) )
+        {
+            mdio_complete( bus );
+        }
+        mdio_start_next( bus );
+        is_idle = ( bus->bus_busy == false ) && ( bus->queue_mask == 0u );
+        Cy_SysLib_ExitCriticalSection( state );
+    }
+}
+
+/* Switches the bus driven by the MAC of the interface between completion by the management frame interrupt and
+ * synchronous completion. Disable only with the interrupt of the MAC disabled: the frames in flight are then drained
+ * by polling, first without the bus lock so that a blocked reader releases it, then under the lock for the frames
+ * submitted meanwhile. */
+void cy_eth_mdio_set_async( cy_ecm_interface_t eth_idx, bool enable )
+{
+    mdio_bus_t *bus = &mdio_bus[eth_idx];
+
+    if( bus->initialized == false )
+    {
+        return;
+    }
+
+    if( enable == false )
+    {
+        mdio_drain( bus );
+    }
+
+    (void)cy_rtos_get_mutex( &bus->mutex, CY_RTOS_NEVER_TIMEOUT );
+    if( enable == false )
+    {
+        mdio_drain( bus );
+    }
+    bus->async_enabled = enable;
+    (void)cy_rtos_set_mutex( &bus->mutex );
+}
+
+/* Called from the Ethernet interrupt handler; the management frame interrupt is raised by the MAC driving the bus */
+void cy_eth_mdio_isr( cy_ecm_interface_t eth_idx )
+{
+    mdio_bus_t *bus = &mdio_bus[eth_idx];
+
+    if( bus->async_enabled == false )
+    {
+        return;
+    }
+
+    if( ( bus->bus_busy == true ) && ( ( bus->base->NETWORK_STATUS & MDIO_NETWORK_STATUS_MAN_DONE ) != 0u ) )
+    {
+        mdio_complete( bus );
+    }
+    mdio_start_next( bus );
+}
+
+void cy_eth_mdio_new_cycle( cy_ecm_interface_t eth_idx )
+{
+    mdio_iface_t *iface = mdio_acquire( eth_idx );
+
+    if( iface != NULL )
+    {
+        iface->valid &= ~mdio_cycle_mask();
+        iface->poll_cycles++;
+        mdio_release( iface );
+    }
+}
+
+void cy_eth_mdio_get_stats( cy_ecm_interface_t eth_idx, cy_ecm_mdio_stats_t *stats )
+{
+    mdio_iface_t *iface = mdio_acquire( eth_idx );
+
+    if( iface != NULL )
+    {
+        *stats = iface->bus->stats;
+        stats->reads       = iface->reads;
+        stats->cache_hits  = iface->cache_hits;
+        stats->poll_cycles = iface->poll_cycles;
+        mdio_release( iface );
+    }
+    else
+    {
+        memset( stats, 0x00, sizeof( cy_ecm_mdio_stats_t ) );
+    }
+}
+
+/******************************************************
+ *               Function definitions
+ ******************************************************/
+cy_rslt_t cy_ecm_mdio_read( cy_ecm_interface_t eth_idx, uint8_t phy_addr, uint8_t reg_addr, uint16_t *value )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    mdio_iface_t *iface;
+    mdio_bus_t *bus;
+
+    if( ( value == NULL ) || ( phy_addr > MDIO_PHY_ADDR_MAX ) || ( reg_addr >= MDIO_C22_REG_COUNT ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    iface = mdio_acquire_scanned( eth_idx );
+    if( iface == NULL )
+    {
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+    bus = iface->bus;
+
+    /* The cache holds one PHY; an access to another address starts over */
+    mdio_cache_select( iface, phy_addr );
+
+    iface->reads++;
+    if( ( iface->valid & ( 1UL << reg_addr ) ) != 0u )
+    {
+        iface->cache_hits++;
+        *value = iface->value[reg_addr];
+    }
+    else if( ( ( reg_addr == MDIO_REG_PHYID1 ) || ( reg_addr == MDIO_REG_PHYID2 ) ) && ( ( bus->phy_mask & ( 1UL << phy_addr ) ) != 0u ) )
+    {
+        /* Identifiers found by the bus scan */
+        iface->cache_hits++;
+        *value = (uint16_t)( ( reg_addr == MDIO_REG_PHYID1 ) ? ( bus->phy_id[phy_addr] >> 16 ) : ( bus->phy_id[phy_addr] & 0xFFFFu ) );
+    }
+    else
+    {
+        result = mdio_bus_read( bus, phy_addr, reg_addr, value );
+        if( ( result == CY_RSLT_SUCCESS ) && ( mdio_reg_policy[reg_addr] != MDIO_NO_CACHE ) &&
+            !( ( reg_addr == MDIO_REG_BMCR ) && ( ( *value & ( MDIO_BMCR_RESET | MDIO_BMCR_RESTART_AN ) ) != 0u ) ) )
+        {
+            /* A BMCR with a self-clearing bit still set is polled until the bit clears, so it is not cached */
+            iface->value[reg_addr] = *value;
+            iface->valid |= ( 1UL << reg_addr );
+        }
+    }
+
+    mdio_release( iface );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_mdio_write( cy_ecm_interface_t eth_idx, uint8_t phy_addr, uint8_t reg_addr, uint16_t value )
+{
+    cy_rslt_t result;
+    mdio_iface_t *iface;
+
+    if( ( phy_addr > MDIO_PHY_ADDR_MAX ) || ( reg_addr >= MDIO_C22_REG_COUNT ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    iface = mdio_acquire_scanned( eth_idx );
+    if( iface == NULL )
+    {
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    result = mdio_bus_write( iface->bus, phy_addr, reg_addr, value );
+
+    mdio_cache_select( iface, phy_addr );
+
+    if( ( reg_addr == MDIO_REG_BMCR ) && ( ( value & MDIO_BMCR_RESET ) != 0u ) )
+    {
+        /* A PHY reset restores the defaults of every register */
+        iface->valid = 0;
+    }
+    else if( mdio_reg_policy[reg_addr] == MDIO_CACHE_STATIC )
+    {
+        iface->value[reg_addr] = value;
+        iface->valid |= ( 1UL << reg_addr );
+    }
+    else
+    {
+        /* Write-only and self-clearing bits make the written value differ from the value read back */
+        iface->valid &= ~( 1UL << reg_addr );
+    }
+
+    if( result != CY_RSLT_SUCCESS )
+    {
+        /* The PHY may or may not have taken the write */
+        iface->valid &= ~( 1UL << reg_addr );
+    }
+
+    mdio_release( iface );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_mdio_submit( cy_ecm_interface_t eth_idx, cy_ecm_mdio_transaction_t *txn )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    mdio_iface_t *iface;
+
+    if( ( txn == NULL ) || ( txn->phy_addr > MDIO_PHY_ADDR_MAX ) || ( txn->reg_addr >= MDIO_C22_REG_COUNT ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    iface = mdio_acquire_scanned( eth_idx );
+    if( iface == NULL )
+    {
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    /* The cached value of a register written asynchronously is unknown until it is read again */
+    if( ( txn->is_write == true ) && ( txn->phy_addr == iface->phy_addr ) )
+    {
+        iface->valid &= ~( 1UL << txn->reg_addr );
+        if( ( txn->reg_addr == MDIO_REG_BMCR ) && ( ( txn->data & MDIO_BMCR_RESET ) != 0u ) )
+        {
+            iface->valid = 0;
+        }
+    }
+
+    if( iface->bus->async_enabled == true )
+    {
+        mdio_enqueue( iface->bus, txn );
+    }
+    else
+    {
+        /* Completed in the context of the caller until the MAC interrupts are enabled */
+        result = mdio_bus_transfer( iface->bus, txn );
+        if( ( result == CY_RSLT_SUCCESS ) && ( txn->callback != NULL ) )
+        {
+            txn->callback( txn );
+        }
+    }
+
+    mdio_release( iface );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_mdio_read_mmd( cy_ecm_interface_t eth_idx, uint8_t phy_addr, uint8_t devad, uint16_t reg_addr, uint16_t *value )
+{
+    cy_rslt_t result;
+    mdio_iface_t *iface;
+
+    if( ( value == NULL ) || ( phy_addr > MDIO_PHY_ADDR_MAX ) || ( devad > MDIO_MMD_DEVAD_MAX ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    iface = mdio_acquire_scanned( eth_idx );
+    if( iface == NULL )
+    {
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    /* The lock keeps the blocking accesses of other tasks out of the select and data sequence */
+    result = mdio_mmd_select( iface->bus, phy_addr, devad, reg_addr );
+    if( result == CY_RSLT_SUCCESS )
+    {
+        result = mdio_bus_read( iface->bus, phy_addr, MDIO_REG_MMDDATA, value );
+    }
+
+    mdio_release( iface );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_mdio_write_mmd( cy_ecm_interface_t eth_idx, uint8_t phy_addr, uint8_t devad, uint16_t reg_addr, uint16_t value )
+{
+    cy_rslt_t result;
+    mdio_iface_t *iface;
+
+    if( ( phy_addr > MDIO_PHY_ADDR_MAX ) || ( devad > MDIO_MMD_DEVAD_MAX ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    iface = mdio_acquire_scanned( eth_idx );
+    if( iface == NULL )
+    {
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    result = mdio_mmd_select( iface->bus, phy_addr, devad, reg_addr );
+    if( result == CY_RSLT_SUCCESS )
+    {
+        result = mdio_bus_write( iface->bus, phy_addr, MDIO_REG_MMDDATA, value );
+    }
+
+    mdio_release( iface );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_mdio_find_phy( cy_ecm_interface_t eth_idx, uint8_t *phy_addr )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    mdio_iface_t *iface;
+    mdio_bus_t *bus;
+    uint32_t available;
+    uint8_t addr;
+
+    if( phy_addr == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    iface = mdio_acquire_scanned( eth_idx );
+    if( iface == NULL )
+    {
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+    bus = iface->bus;
+
+    if( iface->claimed_addr == MDIO_ADDR_NONE )
+    {
+        available = bus->phy_mask & ~bus->claimed_mask;
+        for( addr = 0; addr <= MDIO_PHY_ADDR_MAX; addr++ )
+        {
+            if( ( available & ( 1UL << addr ) ) != 0u )
+            {
+                iface->claimed_addr = addr;
+                bus->claimed_mask |= ( 1UL << addr );
+                break;
+            }
+        }
+    }
+
+    if( iface->claimed_addr != MDIO_ADDR_NONE )
+    {
+        *phy_addr = iface->claimed_addr;
+    }
+    else
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "No unclaimed PHY on the MDIO bus of eth_idx: [%d] \n", eth_idx );
+        result = CY_RSLT_ECM_PHY_NOT_FOUND;
+    }
+
+    mdio_release( iface );
+
+    return result;
+}
+
+cy_rslt_t cy_ecm_get_mdio_stats( cy_ecm_t ecm_handle, cy_ecm_mdio_stats_t *stats )
+{
+    cy_ecm_object_t *ecm_obj;
+
+    if( ecm_handle == NULL || stats == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    cy_eth_mdio_get_stats( ecm_obj->eth_idx, stats );
+
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_ecm_get_mdio_bus_info( cy_ecm_t ecm_handle, cy_ecm_mdio_bus_info_t *info )
+{
+    cy_ecm_object_t *ecm_obj;
+    mdio_iface_t *iface;
+    mdio_bus_t *bus;
+
+    if( ecm_handle == NULL || info == NULL )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    ecm_obj = (cy_ecm_object_t *)ecm_handle;
+
+    if( ecm_obj->isobjinitialized != true )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n ECM library not initialized \n" );
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+
+    iface = mdio_acquire_scanned( ecm_obj->eth_idx );
+    if( iface == NULL )
+    {
+        return CY_RSLT_MODULE_ECM_NOT_INITIALIZED;
+    }
+    bus = iface->bus;
+
+    info->bus             = (cy_ecm_interface_t)( bus - mdio_bus );
+    info->interface_count = bus->users;
+    info->phy_mask        = bus->phy_mask;
+    memcpy( info->phy_id, bus->phy_id, sizeof( info->phy_id ) );
+    info->scan_time_us    = bus->scan_time_us;
+    info->lock_count      = bus->lock_count;
+    info->contended_count = bus->contended_count;
+    info->total_wait_us   = bus->total_wait_us;
+    info->max_wait_us     = bus->max_wait_us;
+
+    mdio_release( iface );
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,705 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file cy_ecm_phy_generic.c
+* @brief Generic Ethernet PHY driver of the Ethernet Connection Manager. Implements the PHY callbacks with the IEEE 802.3
+* clause 22 registers that every 10/100/1000 PHY provides, so that ECM can run without a vendor-specific driver.
+* Vendor-specific callbacks can replace individual members, and access the clause 45 MMD registers through
+* cy_ecm_mdio_read_mmd and cy_ecm_mdio_write_mmd. All PHY accesses go through the ECM MDIO access layer.
+*/
+
+#include <string.h>
+#include <stdbool.h>
+
+#include "cy_ecm.h"
+#include "cy_ecm_error.h"
+#include "cyabs_rtos.h"
+#include "cy_eth_user_config.h"
+
+#include "cy_log.h"
+
+/******************************************************
+ *                      Macros
+ ******************************************************/
+#ifdef ENABLE_ECM_LOGS
+#define cy_ecm_log_msg cy_log_msg
+#else
+#define cy_ecm_log_msg(a,b,c,...)
+#endif
+
+#define PHY_GENERIC_IF_COUNT        ((uint32_t)CY_ECM_INTERFACE_INVALID)
+#define PHY_GENERIC_ADDR_MAX        (31u)
+
+/* Clause 22 registers */
+#define PHY_REG_BMCR                (0x00u)
+#define PHY_REG_BMSR                (0x01u)
+#define PHY_REG_PHYID1              (0x02u)
+#define PHY_REG_PHYID2              (0x03u)
+#define PHY_REG_ANAR                (0x04u)
+#define PHY_REG_ANLPAR              (0x05u)
+#define PHY_REG_GBCR                (0x09u)     /* 1000BASE-T control */
+#define PHY_REG_GBSR                (0x0Au)     /* 1000BASE-T status */
+#define PHY_REG_ESTATUS             (0x0Fu)
+
+#define PHY_BMCR_RESET              (0x8000u)
+#define PHY_BMCR_SPEED_LSB          (0x2000u)
+#define PHY_BMCR_AN_ENABLE          (0x1000u)
+#define PHY_BMCR_POWER_DOWN         (0x0800u)
+#define PHY_BMCR_ISOLATE            (0x0400u)
+#define PHY_BMCR_RESTART_AN         (0x0200u)
+#define PHY_BMCR_FULL_DUPLEX        (0x0100u)
+#define PHY_BMCR_SPEED_MSB          (0x0040u)
+
+#define PHY_BMSR_100FD              (0x4000u)
+#define PHY_BMSR_100HD              (0x2000u)
+#define PHY_BMSR_10FD               (0x1000u)
+#define PHY_BMSR_10HD               (0x0800u)
+#define PHY_BMSR_ESTATUS            (0x0100u)
+#define PHY_BMSR_AN_COMPLETE        (0x0020u)
+#define PHY_BMSR_LINK_STATUS        (0x0004u)
+
+#define PHY_ANAR_100FD              (0x0100u)
+#define PHY_ANAR_100HD              (0x0080u)
+#define PHY_ANAR_10FD               (0x0040u)
+#define PHY_ANAR_10HD               (0x0020u)
+#define PHY_ANAR_ABILITY_MSK        (PHY_ANAR_100FD | PHY_ANAR_100HD | PHY_ANAR_10FD | PHY_ANAR_10HD)
+#define PHY_ANAR_SELECTOR_8023      (0x0001u)
+#define PHY_ANAR_SELECTOR_MSK       (0x001Fu)
+
+#define PHY_GBCR_1000FD             (0x0200u)
+#define PHY_GBCR_1000HD             (0x0100u)
+#define PHY_GBCR_ABILITY_MSK        (PHY_GBCR_1000FD | PHY_GBCR_1000HD)
+#define PHY_GBSR_LP_SHIFT           (2u)        /* Link partner 1000BASE-T abilities are two bits above the advertised ones */
+
+#define PHY_ESTATUS_1000TFD         (0x2000u)
+#define PHY_ESTATUS_1000THD         (0x1000u)
+
+#define PHY_RESET_POLL_INTERVAL_MS  (1u)
+
+/* True if the vendor-specific callbacks replace the given member */
+#define PHY_GENERIC_OVERRIDDEN(ctx, member)   ( ( (ctx)->overrides != NULL ) && ( (ctx)->overrides->member != NULL ) )
+
+/******************************************************
+ *             Structures
+ ******************************************************/
+typedef struct
+{
+    bool                           is_configured;   /* Set by cy_ecm_phy_generic_set_config or on first use */
+    uint8_t                        config_addr;     /* Configured PHY address, or CY_ECM_PHY_ADDR_ANY */
+    uint8_t                        phy_addr;        /* PHY address in use */
+    const cy_ecm_phy_callbacks_t  *overrides;
+    ETH_Type                      *base;        /* Identifies the interface in phy_enable_ext_reg */
+    uint32_t                       phy_id;      /* PHY identifier 1 and 2; 0 until the PHY is identified */
+    uint16_t                       bmsr_caps;   /* 10/100 abilities */
+    uint16_t                       gbcr_caps;   /* 1000BASE-T abilities, in the 1000BASE-T control register layout */
+} phy_generic_context_t;
+
+/******************************************************
+ *               Function declarations
+ ******************************************************/
+static cy_rslt_t phy_generic_init( uint8_t eth_idx, ETH_Type *reg_base );
+static cy_rslt_t phy_generic_configure( uint8_t eth_idx, uint32_t duplex, uint32_t speed );
+static cy_rslt_t phy_generic_reset( uint8_t eth_idx, ETH_Type *reg_base );
+static cy_rslt_t phy_generic_discover( uint8_t eth_idx );
+static cy_rslt_t phy_generic_enable_ext_reg( ETH_Type *reg_base, uint32_t speed );
+static cy_rslt_t phy_generic_get_linkspeed( uint8_t eth_idx, uint32_t *duplex, uint32_t *speed );
+static cy_rslt_t phy_generic_get_linkstatus( uint8_t eth_idx, uint32_t *link_status );
+static cy_rslt_t phy_generic_get_auto_neg_status( uint8_t eth_idx, uint32_t *neg_status );
+static cy_rslt_t phy_generic_get_link_partner_cap( uint8_t eth_idx, uint32_t *duplex, uint32_t *speed );
+static cy_rslt_t phy_generic_cable_diag( uint8_t eth_idx, cy_ecm_cable_report_t *report );
+static cy_rslt_t phy_generic_get_quality( uint8_t eth_idx, cy_ecm_phy_quality_t *quality );
+
+/******************************************************
+ *                 Static variables
+ ******************************************************/
+static phy_generic_context_t phy_generic_ctx[PHY_GENERIC_IF_COUNT];
+
+/******************************************************
+ *                 Global variables
+ ******************************************************/
+const cy_ecm_phy_callbacks_t cy_ecm_phy_generic_callbacks =
+{
+    .phy_init                 = phy_generic_init,
+    .phy_configure            = phy_generic_configure,
+    .phy_reset                = phy_generic_reset,
+    .phy_discover             = phy_generic_discover,
+    .phy_enable_ext_reg       = phy_generic_enable_ext_reg,
+    .phy_get_linkspeed        = phy_generic_get_linkspeed,
+    .phy_get_linkstatus       = phy_generic_get_linkstatus,
+    .phy_get_auto_neg_status  = phy_generic_get_auto_neg_status,
+    .phy_get_link_partner_cap = phy_generic_get_link_partner_cap,
+    .phy_cable_diag           = phy_generic_cable_diag,
+    .phy_get_quality          = phy_generic_get_quality
+};
+
+/******************************************************
+ *                 Static functions
+ ******************************************************/
+static phy_generic_context_t *phy_generic_get_ctx( uint8_t eth_idx )
+{
+    phy_generic_context_t *ctx;
+
+    if( eth_idx >= PHY_GENERIC_IF_COUNT )
+    {
+        return NULL;
+    }
+
+    ctx = &phy_generic_ctx[eth_idx];
+    if( ctx->is_configured == false )
+    {
+        ctx->config_addr = CY_ECM_PHY_GENERIC_DEFAULT_ADDR;
+        ctx->phy_addr = ( ctx->config_addr != CY_ECM_PHY_ADDR_ANY ) ? ctx->config_addr : 0u;
+        ctx->is_configured = true;
+    }
+    return ctx;
+}
+
+static cy_rslt_t phy_generic_read( uint8_t eth_idx, const phy_generic_context_t *ctx, uint8_t reg_addr, uint16_t *value )
+{
+    return cy_ecm_mdio_read( (cy_ecm_interface_t)eth_idx, ctx->phy_addr, reg_addr, value );
+}
+
+static cy_rslt_t phy_generic_write( uint8_t eth_idx, const phy_generic_context_t *ctx, uint8_t reg_addr, uint16_t value )
+{
+    return cy_ecm_mdio_write( (cy_ecm_interface_t)eth_idx, ctx->phy_addr, reg_addr, value );
+}
+
+/* Reads the identifier and the abilities of the PHY; the registers are cached by the MDIO layer after the first read */
+static cy_rslt_t phy_generic_identify( uint8_t eth_idx, phy_generic_context_t *ctx )
+{
+    uint16_t id1 = 0, id2 = 0, bmsr = 0, estatus = 0;
+    cy_rslt_t result;
+
+    result = phy_generic_read( eth_idx, ctx, PHY_REG_PHYID1, &id1 );
+    if( result == CY_RSLT_SUCCESS )
+    {
+        result = phy_generic_read( eth_idx, ctx, PHY_REG_PHYID2, &id2 );
+    }
+    if( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    /* An empty address reads as all ones; a PHY held in reset may read as all zeros */
+    if( ( ( id1 == 0xFFFFu ) && ( id2 == 0xFFFFu ) ) || ( ( id1 == 0x0000u ) && ( id2 == 0x0000u ) ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "No PHY responds at address %u \n", ctx->phy_addr );
+        ctx->phy_id = 0;
+        return CY_RSLT_ECM_ERROR;
+    }
+    ctx->phy_id = ( (uint32_t)id1 << 16 ) | id2;
+
+    result = phy_generic_read( eth_idx, ctx, PHY_REG_BMSR, &bmsr );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+    ctx->bmsr_caps = bmsr & ( PHY_BMSR_100FD | PHY_BMSR_100HD | PHY_BMSR_10FD | PHY_BMSR_10HD );
+    ctx->gbcr_caps = 0;
+
+    if( ( bmsr & PHY_BMSR_ESTATUS ) != 0u )
+    {
+        result = phy_generic_read( eth_idx, ctx, PHY_REG_ESTATUS, &estatus );
+        if( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+        ctx->gbcr_caps |= ( ( estatus & PHY_ESTATUS_1000TFD ) != 0u ) ? PHY_GBCR_1000FD : 0u;
+        ctx->gbcr_caps |= ( ( estatus & PHY_ESTATUS_1000THD ) != 0u ) ? PHY_GBCR_1000HD : 0u;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "PHY 0x%08lX at address %u \n", (unsigned long)ctx->phy_id, ctx->phy_addr );
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Highest common mode of the abilities, in the priority order of IEEE 802.3 annex 28B.3 */
+static void phy_generic_resolve( uint16_t anar_common, uint16_t gbcr_common, uint32_t *duplex, uint32_t *speed )
+{
+    if( ( gbcr_common & PHY_GBCR_1000FD ) != 0u )
+    {
+        *speed = CY_ECM_PHY_SPEED_1000M;
+        *duplex = CY_ECM_DUPLEX_FULL;
+    }
+    else if( ( gbcr_common & PHY_GBCR_1000HD ) != 0u )
+    {
+        *speed = CY_ECM_PHY_SPEED_1000M;
+        *duplex = CY_ECM_DUPLEX_HALF;
+    }
+    else if( ( anar_common & PHY_ANAR_100FD ) != 0u )
+    {
+        *speed = CY_ECM_PHY_SPEED_100M;
+        *duplex = CY_ECM_DUPLEX_FULL;
+    }
+    else if( ( anar_common & PHY_ANAR_100HD ) != 0u )
+    {
+        *speed = CY_ECM_PHY_SPEED_100M;
+        *duplex = CY_ECM_DUPLEX_HALF;
+    }
+    else if( ( anar_common & PHY_ANAR_10FD ) != 0u )
+    {
+        *speed = CY_ECM_PHY_SPEED_10M;
+        *duplex = CY_ECM_DUPLEX_FULL;
+    }
+    else
+    {
+        *speed = CY_ECM_PHY_SPEED_10M;
+        *duplex = CY_ECM_DUPLEX_HALF;
+    }
+}
+
+/* Resolves the mode negotiated with the link partner */
+static cy_rslt_t phy_generic_negotiated_mode( uint8_t eth_idx, const phy_generic_context_t *ctx, uint32_t *duplex, uint32_t *speed )
+{
+    uint16_t anar = 0, anlpar = 0, gbcr = 0, gbsr = 0;
+    cy_rslt_t result;
+
+    result = phy_generic_read( eth_idx, ctx, PHY_REG_ANAR, &anar );
+    if( result == CY_RSLT_SUCCESS )
+    {
+        result = phy_generic_read( eth_idx, ctx, PHY_REG_ANLPAR, &anlpar );
+    }
+    if( ( result == CY_RSLT_SUCCESS ) && ( ctx->gbcr_caps != 0u ) )
+    {
+        result = phy_generic_read( eth_idx, ctx, PHY_REG_GBCR, &gbcr );
+        if( result == CY_RSLT_SUCCESS )
+        {
+            result = phy_generic_read( eth_idx, ctx, PHY_REG_GBSR, &gbsr );
+        }
+    }
+    if( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    phy_generic_resolve( (uint16_t)( anar & anlpar ), (uint16_t)( gbcr & ( gbsr >> PHY_GBSR_LP_SHIFT ) ), duplex, speed );
+
+    return CY_RSLT_SUCCESS;
+}
+
+static cy_rslt_t phy_generic_init( uint8_t eth_idx, ETH_Type *reg_base )
+{
+    phy_generic_context_t *ctx = phy_generic_get_ctx( eth_idx );
+    cy_rslt_t result;
+
+    if( ctx == NULL )
+    {
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    ctx->base = reg_base;
+
+    if( ctx->config_addr == CY_ECM_PHY_ADDR_ANY )
+    {
+        /* The MDIO bus is scanned once; the address claimed for this interface does not change */
+        result = cy_ecm_mdio_find_phy( (cy_ecm_interface_t)eth_idx, &ctx->phy_addr );
+        if( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+    }
+
+    /* The abilities are needed by the generic callbacks even when the initialization is vendor specific */
+    result = phy_generic_identify( eth_idx, ctx );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+    if( PHY_GENERIC_OVERRIDDEN( ctx, phy_init ) )
+    {
+        result = ctx->overrides->phy_init( eth_idx, reg_base );
+    }
+
+    return result;
+}
+
+static cy_rslt_t phy_generic_configure( uint8_t eth_idx, uint32_t duplex, uint32_t speed )
+{
+    phy_generic_context_t *ctx = phy_generic_get_ctx( eth_idx );
+    uint16_t bmcr = 0, anar = 0, gbcr = 0, advertise, advertise_gbcr, forced_cap;
+    bool is_changed = false;
+    cy_rslt_t result;
+
+    if( ctx == NULL )
+    {
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+    if( PHY_GENERIC_OVERRIDDEN( ctx, phy_configure ) )
+    {
+        return ctx->overrides->phy_configure( eth_idx, duplex, speed );
+    }
+
+    /* 1000BASE-T cannot be forced, as the clock master is resolved by autonegotiation (IEEE 802.3 clause 40.5.1);
+     * a fixed 1000 Mbps mode is set up below by advertising only that mode */
+    if( ( duplex != (uint32_t)CY_ECM_DUPLEX_AUTO ) && ( speed != (uint32_t)CY_ECM_PHY_SPEED_AUTO ) &&
+        ( speed != (uint32_t)CY_ECM_PHY_SPEED_1000M ) )
+    {
+        /* Forced mode */
+        if( speed == (uint32_t)CY_ECM_PHY_SPEED_100M )
+        {
+            bmcr = PHY_BMCR_SPEED_LSB;
+            forced_cap = ( duplex == (uint32_t)CY_ECM_DUPLEX_FULL ) ? PHY_BMSR_100FD : PHY_BMSR_100HD;
+        }
+        else
+        {
+            forced_cap = ( duplex == (uint32_t)CY_ECM_DUPLEX_FULL ) ? PHY_BMSR_10FD : PHY_BMSR_10HD;
+        }
+        if( ( ctx->bmsr_caps & forced_cap ) == 0u )
+        {
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "PHY does not support the requested speed and duplex \n" );
+            return CY_RSLT_MODULE_ECM_BADARG;
+        }
+        bmcr |= ( duplex == (uint32_t)CY_ECM_DUPLEX_FULL ) ? PHY_BMCR_FULL_DUPLEX : 0u;
+        return phy_generic_write( eth_idx, ctx, PHY_REG_BMCR, bmcr );
+    }
+
+    /* Advertise the abilities of the PHY that match the requested speed and duplex */
+    advertise = 0;
+    advertise_gbcr = 0;
+    if( ( speed == (uint32_t)CY_ECM_PHY_SPEED_AUTO ) || ( speed == (uint32_t)CY_ECM_PHY_SPEED_1000M ) )
+    {
+        advertise_gbcr = ctx->gbcr_caps;
+    }
+    if( ( speed == (uint32_t)CY_ECM_PHY_SPEED_AUTO ) || ( speed == (uint32_t)CY_ECM_PHY_SPEED_100M ) )
+    {
+        advertise |= ( ( ctx->bmsr_caps & PHY_BMSR_100FD ) != 0u ) ? PHY_ANAR_100FD : 0u;
+        advertise |= ( ( ctx->bmsr_caps & PHY_BMSR_100HD ) != 0u ) ? PHY_ANAR_100HD : 0u;
+    }
+    if( ( speed == (uint32_t)CY_ECM_PHY_SPEED_AUTO ) || ( speed == (uint32_t)CY_ECM_PHY_SPEED_10M ) )
+    {
+        advertise |= ( ( ctx->bmsr_caps & PHY_BMSR_10FD ) != 0u ) ? PHY_ANAR_10FD : 0u;
+        advertise |= ( ( ctx->bmsr_caps & PHY_BMSR_10HD ) != 0u ) ? PHY_ANAR_10HD : 0u;
+    }
+    if( duplex == (uint32_t)CY_ECM_DUPLEX_FULL )
+    {
+        advertise &= (uint16_t)~( PHY_ANAR_100HD | PHY_ANAR_10HD );
+        advertise_gbcr &= (uint16_t)~PHY_GBCR_1000HD;
+    }
+    else if( duplex == (uint32_t)CY_ECM_DUPLEX_HALF )
+    {
+        advertise &= (uint16_t)~( PHY_ANAR_100FD | PHY_ANAR_10FD );
+        advertise_gbcr &= (uint16_t)~PHY_GBCR_1000FD;
+    }
+    if( ( advertise == 0u ) && ( advertise_gbcr == 0u ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "PHY does not support the requested speed and duplex \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    /* Registers already holding the advertisement are not written; the pause and next page bits are kept */
+    result = phy_generic_read( eth_idx, ctx, PHY_REG_ANAR, &anar );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+    advertise |= (uint16_t)( anar & (uint16_t)~( PHY_ANAR_ABILITY_MSK | PHY_ANAR_SELECTOR_MSK ) ) | PHY_ANAR_SELECTOR_8023;
+    if( advertise != anar )
+    {
+        result = phy_generic_write( eth_idx, ctx, PHY_REG_ANAR, advertise );
+        is_changed = true;
+    }
+
+    if( ( result == CY_RSLT_SUCCESS ) && ( ctx->gbcr_caps != 0u ) )
+    {
+        result = phy_generic_read( eth_idx, ctx, PHY_REG_GBCR, &gbcr );
+        advertise_gbcr |= (uint16_t)( gbcr & (uint16_t)~PHY_GBCR_ABILITY_MSK );
+        if( ( result == CY_RSLT_SUCCESS ) && ( advertise_gbcr != gbcr ) )
+        {
+            result = phy_generic_write( eth_idx, ctx, PHY_REG_GBCR, advertise_gbcr );
+            is_changed = true;
+        }
+    }
+
+    if( result == CY_RSLT_SUCCESS )
+    {
+        result = phy_generic_read( eth_idx, ctx, PHY_REG_BMCR, &bmcr );
+    }
+    if( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    /* A PHY already negotiating with this advertisement, as after a reset, is not restarted; a restart costs a full negotiation */
+    if( ( is_changed == true ) || ( ( bmcr & PHY_BMCR_AN_ENABLE ) == 0u ) ||
+        ( ( bmcr & ( PHY_BMCR_POWER_DOWN | PHY_BMCR_ISOLATE ) ) != 0u ) )
+    {
+        result = phy_generic_write( eth_idx, ctx, PHY_REG_BMCR, PHY_BMCR_AN_ENABLE | PHY_BMCR_RESTART_AN );
+    }
+
+    return result;
+}
+
+static cy_rslt_t phy_generic_reset( uint8_t eth_idx, ETH_Type *reg_base )
+{
+    phy_generic_context_t *ctx = phy_generic_get_ctx( eth_idx );
+    uint32_t waited_ms = 0;
+    uint16_t bmcr = 0;
+    cy_rslt_t result;
+
+    if( ctx == NULL )
+    {
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+    if( PHY_GENERIC_OVERRIDDEN( ctx, phy_reset ) )
+    {
+        return ctx->overrides->phy_reset( eth_idx, reg_base );
+    }
+
+    result = phy_generic_write( eth_idx, ctx, PHY_REG_BMCR, PHY_BMCR_RESET );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    /* The reset bit clears itself once the PHY is ready */
+    do
+    {
+        cy_rtos_delay_milliseconds( PHY_RESET_POLL_INTERVAL_MS );
+        waited_ms += PHY_RESET_POLL_INTERVAL_MS;
+        result = phy_generic_read( eth_idx, ctx, PHY_REG_BMCR, &bmcr );
+        if( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+    } while( ( ( bmcr & PHY_BMCR_RESET ) != 0u ) && ( waited_ms < CY_ECM_PHY_RESET_TIMEOUT_MS ) );
+
+    if( ( bmcr & PHY_BMCR_RESET ) != 0u )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "PHY reset did not complete in %u ms \n", (unsigned int)CY_ECM_PHY_RESET_TIMEOUT_MS );
+        return CY_RSLT_ECM_ERROR;
+    }
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "PHY reset completed in %lu ms \n", (unsigned long)waited_ms );
+
+    return CY_RSLT_SUCCESS;
+}
+
+static cy_rslt_t phy_generic_discover( uint8_t eth_idx )
+{
+    phy_generic_context_t *ctx = phy_generic_get_ctx( eth_idx );
+
+    if( ctx == NULL )
+    {
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+    if( PHY_GENERIC_OVERRIDDEN( ctx, phy_discover ) )
+    {
+        return ctx->overrides->phy_discover( eth_idx );
+    }
+
+    /* The reset restored the defaults; identify the PHY again */
+    return phy_generic_identify( eth_idx, ctx );
+}
+
+static cy_rslt_t phy_generic_enable_ext_reg( ETH_Type *reg_base, uint32_t speed )
+{
+    uint32_t i;
+
+    for( i = 0; i < PHY_GENERIC_IF_COUNT; i++ )
+    {
+        if( ( phy_generic_ctx[i].base == reg_base ) && PHY_GENERIC_OVERRIDDEN( &phy_generic_ctx[i], phy_enable_ext_reg ) )
+        {
+            return phy_generic_ctx[i].overrides->phy_enable_ext_reg( reg_base, speed );
+        }
+    }
+
+    /* Standard PHYs have no extended registers to enable */
+    return CY_RSLT_SUCCESS;
+}
+
+static cy_rslt_t phy_generic_get_linkspeed( uint8_t eth_idx, uint32_t *duplex, uint32_t *speed )
+{
+    phy_generic_context_t *ctx = phy_generic_get_ctx( eth_idx );
+    uint16_t bmcr = 0;
+    cy_rslt_t result;
+
+    if( ( ctx == NULL ) || ( duplex == NULL ) || ( speed == NULL ) )
+    {
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+    if( PHY_GENERIC_OVERRIDDEN( ctx, phy_get_linkspeed ) )
+    {
+        return ctx->overrides->phy_get_linkspeed( eth_idx, duplex, speed );
+    }
+
+    result = phy_generic_read( eth_idx, ctx, PHY_REG_BMCR, &bmcr );
+    if( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    if( ( bmcr & PHY_BMCR_AN_ENABLE ) != 0u )
+    {
+        return phy_generic_negotiated_mode( eth_idx, ctx, duplex, speed );
+    }
+
+    *duplex = ( ( bmcr & PHY_BMCR_FULL_DUPLEX ) != 0u ) ? CY_ECM_DUPLEX_FULL : CY_ECM_DUPLEX_HALF;
+    if( ( bmcr & PHY_BMCR_SPEED_MSB ) != 0u )
+    {
+        *speed = CY_ECM_PHY_SPEED_1000M;
+    }
+    else
+    {
+        *speed = ( ( bmcr & PHY_BMCR_SPEED_LSB ) != 0u ) ? CY_ECM_PHY_SPEED_100M : CY_ECM_PHY_SPEED_10M;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+static cy_rslt_t phy_generic_get_linkstatus( uint8_t eth_idx, uint32_t *link_status )
+{
+    phy_generic_context_t *ctx = phy_generic_get_ctx( eth_idx );
+    uint16_t bmsr = 0;
+    cy_rslt_t result;
+
+    if( ( ctx == NULL ) || ( link_status == NULL ) )
+    {
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+    if( PHY_GENERIC_OVERRIDDEN( ctx, phy_get_linkstatus ) )
+    {
+        return ctx->overrides->phy_get_linkstatus( eth_idx, link_status );
+    }
+
+    /* The link status latches low; the MDIO layer reads BMSR once per poll cycle, so a link drop is reported once */
+    result = phy_generic_read( eth_idx, ctx, PHY_REG_BMSR, &bmsr );
+    if( result == CY_RSLT_SUCCESS )
+    {
+        *link_status = ( ( bmsr & PHY_BMSR_LINK_STATUS ) != 0u ) ? 1u : 0u;
+    }
+
+    return result;
+}
+
+static cy_rslt_t phy_generic_get_auto_neg_status( uint8_t eth_idx, uint32_t *neg_status )
+{
+    phy_generic_context_t *ctx = phy_generic_get_ctx( eth_idx );
+    uint16_t bmsr = 0;
+    cy_rslt_t result;
+
+    if( ( ctx == NULL ) || ( neg_status == NULL ) )
+    {
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+    if( PHY_GENERIC_OVERRIDDEN( ctx, phy_get_auto_neg_status ) )
+    {
+        return ctx->overrides->phy_get_auto_neg_status( eth_idx, neg_status );
+    }
+
+    result = phy_generic_read( eth_idx, ctx, PHY_REG_BMSR, &bmsr );
+    if( result == CY_RSLT_SUCCESS )
+    {
+        *neg_status = ( ( bmsr & PHY_BMSR_AN_COMPLETE ) != 0u ) ? 1u : 0u;
+    }
+
+    return result;
+}
+
+static cy_rslt_t phy_generic_get_link_partner_cap( uint8_t eth_idx, uint32_t *duplex, uint32_t *speed )
+{
+    phy_generic_context_t *ctx = phy_generic_get_ctx( eth_idx );
+
+    if( ( ctx == NULL ) || ( duplex == NULL ) || ( speed == NULL ) )
+    {
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+    if( PHY_GENERIC_OVERRIDDEN( ctx, phy_get_link_partner_cap ) )
+    {
+        return ctx->overrides->phy_get_link_partner_cap( eth_idx, duplex, speed );
+    }
+
+    /* The MAC is configured for the best mode that both ends advertise */
+    return phy_generic_negotiated_mode( eth_idx, ctx, duplex, speed );
+}
+
+static cy_rslt_t phy_generic_cable_diag( uint8_t eth_idx, cy_ecm_cable_report_t *report )
+{
+    phy_generic_context_t *ctx = phy_generic_get_ctx( eth_idx );
+
+    if( ( ctx == NULL ) || ( report == NULL ) )
+    {
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+    if( PHY_GENERIC_OVERRIDDEN( ctx, phy_cable_diag ) )
+    {
+        return ctx->overrides->phy_cable_diag( eth_idx, report );
+    }
+
+    /* IEEE 802.3 does not define the TDR registers */
+    return CY_RSLT_ECM_NOT_SUPPORTED;
+}
+
+static cy_rslt_t phy_generic_get_quality( uint8_t eth_idx, cy_ecm_phy_quality_t *quality )
+{
+    phy_generic_context_t *ctx = phy_generic_get_ctx( eth_idx );
+
+    if( ( ctx == NULL ) || ( quality == NULL ) )
+    {
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+    if( PHY_GENERIC_OVERRIDDEN( ctx, phy_get_quality ) )
+    {
+        return ctx->overrides->phy_get_quality( eth_idx, quality );
+    }
+
+    /* The signal quality index and the receive error counter are vendor specific */
+    return CY_RSLT_ECM_NOT_SUPPORTED;
+}
+
+/******************************************************
+ *               Function definitions
+ ******************************************************/
+cy_rslt_t cy_ecm_phy_generic_set_config( cy_ecm_interface_t eth_idx, const cy_ecm_phy_generic_config_t *config )
+{
+    phy_generic_context_t *ctx;
+
+    if( ( (uint32_t)eth_idx >= PHY_GENERIC_IF_COUNT ) || ( config == NULL ) ||
+        ( ( config->phy_addr > PHY_GENERIC_ADDR_MAX ) && ( config->phy_addr != CY_ECM_PHY_ADDR_ANY ) ) ||
+        ( config->overrides == &cy_ecm_phy_generic_callbacks ) )
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "\n Invalid Arguments \n" );
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    ctx = &phy_generic_ctx[eth_idx];
+    memset( ctx, 0x00, sizeof( phy_generic_context_t ) );
+    ctx->config_addr   = config->phy_addr;
+    ctx->phy_addr      = ( config->phy_addr != CY_ECM_PHY_ADDR_ANY ) ? config->phy_addr : 0u;
+    ctx->overrides     = config->overrides;
+    ctx->is_configured = true;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -47,6 +47,9 @@
 #include "cy_ecm.h"
 #include "cy_ecm_error.h"
 #include "cycfg.h"
+#if defined(COMPONENT_LWIP)
+#include "lwip/pbuf.h"
+#endif
 
 #ifdef ENABLE_ECM_LOGS
 #define cy_ecm_log_msg cy_log_msg
@@ -56,6 +59,63 @@
 
 #define SLEEP_ETHERNET_PHY_STATUS                 (1) /* Sleep time in milliseconds. */
 
+#define CY_ECM_BD_SIZE                            (8u)    /* Rx and Tx buffer descriptors are two words each; TSU timestamp words are not used */
+
+/* Size of one receive buffer posted to an Rx descriptor; the network stack provides the buffers */
+#if defined(COMPONENT_LWIP)
+#define ETH_RX_BUFFER_SIZE                        ((uint32_t)PBUF_POOL_BUFSIZE)
+#else
+#define ETH_RX_BUFFER_SIZE                        ((uint32_t)CY_ETH_SIZE_MAX_FRAME)
+#endif
+
+/********************************************************/
+/* Consistency checks of the configuration in cy_eth_user_config.h */
+#if (CY_ECM_RX_BD_PER_QUEUE < 2u) || (CY_ECM_TX_BD_PER_QUEUE < 1u)
+#error "cy_eth_user_config.h: at least 2 Rx and 1 Tx buffer descriptors per queue are required"
+#endif
+
+#if (CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE != CY_ECM_RX_BD_PER_QUEUE) || (CY_ETH_DEFINE_TOTAL_BD_PER_TXQUEUE != CY_ECM_TX_BD_PER_QUEUE)
+#error "cy_eth_user_config.h: configure the ring depth through CY_ECM_RX_BD_PER_QUEUE and CY_ECM_TX_BD_PER_QUEUE only"
+#endif
+
+#if (CY_ECM_ETH0_RXQ2_ENABLE && !CY_ECM_ETH0_RXQ1_ENABLE) || (CY_ECM_ETH1_RXQ2_ENABLE && !CY_ECM_ETH1_RXQ1_ENABLE) || \
+    (CY_ECM_ETH0_TXQ2_ENABLE && !CY_ECM_ETH0_TXQ1_ENABLE) || (CY_ECM_ETH1_TXQ2_ENABLE && !CY_ECM_ETH1_TXQ1_ENABLE)
+#error "cy_eth_user_config.h: queue 2 cannot be enabled without queue 1"
+#endif
+
+#define CY_ECM_RXQ_EXT_ENABLED    (CY_ECM_ETH0_RXQ1_ENABLE || CY_ECM_ETH1_RXQ1_ENABLE)
+
+/* Receive buffers in cacheable SRAM need explicit D-cache maintenance */
+#if (CY_ECM_DMA_BUFFER_PLACEMENT == CY_ECM_DMA_PLACEMENT_CACHEABLE) && defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+#define CY_ECM_DMA_CACHE_MAINTENANCE    (1)
+#endif
+
+#if (CY_ECM_DMA_BUFFER_ALIGNMENT & (CY_ECM_DMA_BUFFER_ALIGNMENT - 1u)) != 0u
+#error "cy_eth_user_config.h: CY_ECM_DMA_BUFFER_ALIGNMENT must be a power of two"
+#endif
+
+#define ETH_NETWORK_CONFIG_FULL_DUPLEX    (0x00000002UL)    /* Network configuration register, bit 1 */
+#define ETH_NETWORK_CONFIG_DISCARD_NON_VLAN (0x00000004UL)  /* Network configuration register, bit 2; only tagged frames are received */
+#define ETH_SCREENING_TYPE_2_VLAN_PRIORITY_POS (4u)        /* Screening type 2 register: queue [3:0], VLAN priority [6:4] */
+#define ETH_SCREENING_TYPE_2_VLAN_ENABLE  (0x00000100UL)    /* Screening type 2 register, bit 8; match the VLAN priority */
+#define ETH_DMA_CONFIG_BURST_MSK          (0x0000001FUL)    /* DMA configuration register, AMBA burst length [4:0] */
+#define ETH_TRANSMIT_STATUS_TX_GO         (0x00000008UL)    /* Transmit status register, transmit in progress */
+#define ETH_NETWORK_CONTROL_TX_START      (0x00000200UL)    /* Network control register, bit 9; start or resume transmission */
+#define ETH_NETWORK_CONTROL_TX_HALT       (0x00000400UL)    /* Network control register, bit 10; halt after the frame in progress */
+#define ETH_TX_HALT_MAX_CHECKS            (3u)              /* At the CY_ETH_TX_HALT_CHECK_MS pace, longer than a 1536-byte frame at 10 Mbit/s */
+#define ETH_PBUF_TXCUTTHRU_ENABLE         (0x80000000UL)    /* Tx partial store and forward enable */
+#define ETH_INT_MODERATION_TX_POS         (16u)             /* Interrupt moderation register: Rx delay [7:0], Tx delay [23:16] */
+#define ETH_INT_MODERATION_UNIT_NS        (800u)            /* Moderation delay unit */
+#define ETH_INT_MODERATION_MAX            (255u)
+
+#if (CY_ECM_INT_MODERATION_MAX_DELAY_US * 1000u / ETH_INT_MODERATION_UNIT_NS) > ETH_INT_MODERATION_MAX
+#error "cy_eth_user_config.h: CY_ECM_INT_MODERATION_MAX_DELAY_US must not exceed 204"
+#endif
+
+#if CY_ECM_INT_MODERATION_HIGH_RATE <= CY_ECM_INT_MODERATION_LOW_RATE
+#error "cy_eth_user_config.h: CY_ECM_INT_MODERATION_HIGH_RATE must be greater than CY_ECM_INT_MODERATION_LOW_RATE"
+#endif
+
 /********************************************************/
 extern uint8_t *pRx_Q_buff_pool[CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE];
 
@@ -67,12 +127,177 @@ extern void cy_tx_failure_cb ( ETH_Type *pstcEth, uint8_t u8QueueIndex );
 static void cy_eth_phy_initialization ( cy_ecm_interface_t eth_idx,
                                         ETH_Type *reg_base,
                                         cy_ecm_phy_config_t *ecm_phy_config,
-                                        cy_ecm_phy_callbacks_t *phy_callbacks );
+                                        const cy_ecm_phy_callbacks_t *phy_callbacks );
 
 /********************************************************/
 
 static bool is_driver_configured = false;
 
+/* Queue enablement per interface from cy_eth_user_config.h; queue 0 is always enabled */
+typedef struct
+{
+    bool rxq1;
+    bool rxq2;
+    bool txq1;
+    bool txq2;
+} eth_queue_config_t;
+
+static const eth_queue_config_t eth_queue_config[CY_ECM_ETH_INTERFACE_MAX] =
+{
+    { CY_ECM_ETH0_RXQ1_ENABLE, CY_ECM_ETH0_RXQ2_ENABLE, CY_ECM_ETH0_TXQ1_ENABLE, CY_ECM_ETH0_TXQ2_ENABLE },
+    { CY_ECM_ETH1_RXQ1_ENABLE, CY_ECM_ETH1_RXQ2_ENABLE, CY_ECM_ETH1_TXQ1_ENABLE, CY_ECM_ETH1_TXQ2_ENABLE }
+};
+
+/* Time of the first unicast frame received after cy_eth_rx_timestamp_arm(); used to measure the time to traffic after link up */
+static volatile bool      eth_rx_timestamp_armed[CY_ECM_ETH_INTERFACE_MAX];
+static volatile bool      eth_rx_timestamp_valid[CY_ECM_ETH_INTERFACE_MAX];
+static volatile cy_time_t eth_rx_timestamp[CY_ECM_ETH_INTERFACE_MAX];
+
+/* The MAC statistics registers clear on read; their values are accumulated here so that each consumer can take differences */
+static cy_eth_mac_counters_t eth_mac_counters[CY_ECM_ETH_INTERFACE_MAX];
+
+/* Tx error interrupts per queue: retry limit exceeded, late collision, underrun, or frame corrupted */
+static volatile uint32_t eth_tx_queue_errors[CY_ECM_ETH_INTERFACE_MAX][CY_ECM_TX_QUEUE_COUNT];
+
+/* AMBA burst length before the first reduction by cy_eth_tx_fallback; 0 while the burst is not reduced */
+static uint32_t eth_tx_burst_default[CY_ECM_ETH_INTERFACE_MAX];
+
+/* Checks of the transmitter since the halt was requested by eth_tx_halt; 0 while the transmitter is not being halted */
+static uint8_t eth_tx_halt_checks[CY_ECM_ETH_INTERFACE_MAX];
+
+/* Adaptive interrupt moderation; the frame and interrupt rates are measured in the interrupt context */
+typedef struct
+{
+    uint32_t                      irq_count;            /* Counts of the current interval */
+    uint32_t                      rx_frames;
+    uint32_t                      tx_frames;
+    cy_time_t                     interval_start;
+    cy_ecm_int_moderation_stats_t stats;
+} eth_moderation_t;
+
+static eth_moderation_t eth_moderation[CY_ECM_ETH_INTERFACE_MAX];
+
+/* Polled mode: the Ethernet interrupt is disabled and the events are handled by cy_eth_poll() */
+static volatile bool     eth_polled_mode[CY_ECM_ETH_INTERFACE_MAX];
+static volatile uint32_t eth_frames_handled[CY_ECM_ETH_INTERFACE_MAX];   /* Rx frames and Tx completions */
+static cy_ecm_poll_stats_t eth_poll_stats[CY_ECM_ETH_INTERFACE_MAX];
+
+/* Receive dispatch table, keyed by EtherType and VLAN ID. An entry is looked up in the CY_ECM_DISPATCH_PROBE_MAX slots
+ * that follow the hash of its EtherType, so a lookup costs the same whatever the table holds. Entries are never modified
+ * once published: an update publishes a new entry with a single pointer store, and recycles the replaced entry only
+ * once no dispatch that may have read it is in progress. Frames without an entry go to the network stack only */
+typedef struct
+{
+    uint16_t           ethertype;
+    uint16_t           vlan_id;                       /* CY_ECM_VLAN_ID_ANY matches tagged and untagged frames */
+    cy_ecm_raw_rx_cb_t callback;                      /* NULL for a free pool entry */
+    void              *ctx;
+    cy_ecm_t           handle;
+} eth_dispatch_entry_t;
+
+#define ETH_DISPATCH_MASK                 (CY_ECM_DISPATCH_TABLE_SIZE - 1u)
+#define ETH_ETHERTYPE_VLAN                (0x8100u)
+#define ETH_VLAN_ID_MSK                   (0x0FFFu)
+
+#if (CY_ECM_DISPATCH_TABLE_SIZE & ETH_DISPATCH_MASK) != 0u
+#error "cy_eth_user_config.h: CY_ECM_DISPATCH_TABLE_SIZE must be a power of two"
+#endif
+
+#if CY_ECM_DISPATCH_PROBE_MAX > CY_ECM_DISPATCH_TABLE_SIZE
+#error "cy_eth_user_config.h: CY_ECM_DISPATCH_PROBE_MAX must not exceed CY_ECM_DISPATCH_TABLE_SIZE"
+#endif
+
+static eth_dispatch_entry_t * volatile eth_dispatch_table[CY_ECM_ETH_INTERFACE_MAX][CY_ECM_DISPATCH_TABLE_SIZE];
+/* One spare entry, so that an entry can be replaced while the table is full */
+static eth_dispatch_entry_t eth_dispatch_pool[CY_ECM_ETH_INTERFACE_MAX][CY_ECM_DISPATCH_TABLE_SIZE + 1u];
+static volatile uint32_t eth_dispatch_seq[CY_ECM_ETH_INTERFACE_MAX];   /* Odd while a dispatch is in progress */
+static volatile uint32_t eth_dispatch_count[CY_ECM_ETH_INTERFACE_MAX]; /* Published entries */
+static cy_ecm_raw_stats_t eth_raw_stats[CY_ECM_ETH_INTERFACE_MAX];
+
+/* Frame rate limiter of the storm control and the port mirroring. The tokens are counted in thousandths of a frame,
+ * so that a bucket can be refilled every millisecond at any rate */
+#define ETH_TOKEN_UNIT                    (1000u)
+#define ETH_TOKEN_BURST_MAX               (UINT32_MAX / ETH_TOKEN_UNIT)
+
+typedef struct
+{
+    uint32_t  rate;                                   /* Frames per second; 0 if not limited */
+    uint32_t  burst;
+    uint32_t  tokens;
+    cy_time_t last_refill;
+    uint32_t  passed;
+    uint32_t  dropped;
+} eth_token_bucket_t;
+
+#if (CY_ECM_STORM_BURST == 0u) || (CY_ECM_STORM_BURST > ETH_TOKEN_BURST_MAX)
+#error "cy_eth_user_config.h: CY_ECM_STORM_BURST must be from 1 to 4294967"
+#endif
+
+/* Storm control: a token bucket per received traffic class */
+static eth_token_bucket_t eth_storm[CY_ECM_ETH_INTERFACE_MAX][CY_ECM_STORM_CLASS_COUNT];
+static volatile bool eth_storm_enabled[CY_ECM_ETH_INTERFACE_MAX];       /* At least one class is limited */
+static uint8_t eth_storm_mac[CY_ECM_ETH_INTERFACE_MAX][CY_ECM_MAC_ADDR_LEN];
+/* Receive buffer of a dropped frame, handed back to the DMA at the next refill instead of a new buffer from the
+ * network stack. A buffer left here at deinit is reused by the next initialization */
+static uint8_t *eth_rx_recycled[CY_ECM_ETH_INTERFACE_MAX];
+static uint32_t eth_rx_buff_len[CY_ECM_ETH_INTERFACE_MAX];
+
+/* Port mirroring, indexed by the source interface */
+#define ETH_MIRROR_RX                     (0x01u)
+#define ETH_MIRROR_TX                     (0x02u)
+
+typedef struct
+{
+    cy_ecm_interface_t    destination;
+    uint8_t               queue;
+    uint32_t              filter_len;
+    cy_ecm_capture_insn_t filter[CY_ECM_CAPTURE_FILTER_MAX_LEN];
+    eth_token_bucket_t    bucket;
+    uint32_t              mirrored;
+    uint32_t              tx_dropped;                 /* No Tx buffer free, or link down on the destination */
+} eth_mirror_t;
+
+static eth_mirror_t eth_mirror[CY_ECM_ETH_INTERFACE_MAX];
+static volatile uint8_t eth_mirror_flags[CY_ECM_ETH_INTERFACE_MAX];      /* ETH_MIRROR_* of the source interface */
+static volatile bool eth_mirror_destination[CY_ECM_ETH_INTERFACE_MAX];   /* Tx path owned by a port mirror */
+
+/* VLAN configuration. The MAC can only discard the untagged frames; the VLAN membership of the tagged frames is
+ * checked in the receive path, in a bitmap indexed by the VLAN ID */
+#define ETH_VLAN_FILTER                   (0x01u)
+#define ETH_VLAN_STRIP                    (0x02u)
+#define ETH_VLAN_TAG                      (0x04u)
+#define ETH_VLAN_TAG_LEN                  (4u)
+#define ETH_VLAN_MEMBER_WORDS             ((ETH_VLAN_ID_MSK + 1u) / 32u)
+
+typedef struct
+{
+    uint16_t pvid;                                    /* CY_ECM_VLAN_ID_NONE if untagged frames are not accepted */
+    uint32_t member[ETH_VLAN_MEMBER_WORDS];
+    uint32_t member_count;
+    uint32_t rx_dropped;
+    uint32_t rx_stripped;
+    uint32_t rx_raw_only;
+    uint32_t tx_tagged;
+} eth_vlan_t;
+
+static eth_vlan_t eth_vlan[CY_ECM_ETH_INTERFACE_MAX];
+static volatile uint8_t eth_vlan_flags[CY_ECM_ETH_INTERFACE_MAX];        /* ETH_VLAN_* */
+/* Copy of a raw frame whose tag is inserted or changed; the raw frame send is serialized by its caller */
+static uint8_t eth_vlan_tx_frame[CY_ECM_ETH_INTERFACE_MAX][CY_ECM_RAW_FRAME_MAX_LEN];
+
+/* 802.1p priority map. The received tagged frames are steered to the Rx queue of their priority code point by the
+ * type 2 screeners of the MAC, one per priority that does not use queue 0; untagged frames use queue 0 */
+#define ETH_PCP_POS                       (5u)            /* Priority code point in the first byte of the tag control */
+#define ETH_ETHERTYPE_IPV4                (0x0800u)
+#define ETH_ETHERTYPE_IPV6                (0x86DDu)
+
+static cy_ecm_priority_map_t eth_priority_map[CY_ECM_ETH_INTERFACE_MAX];
+
+#if CY_ECM_RXQ_EXT_ENABLED
+/* Receive buffer pools of Rx queues 1 and 2; queue 0 uses the pool of the network stack */
+static uint8_t *rx_q_ext_buff_pool[CY_ECM_ETH_INTERFACE_MAX][2][CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE];
+#endif
+
 static cy_stc_ethif_wrapper_config_t stcWrapperConfig;
 
 int eth_index_internal;
@@ -82,7 +307,7 @@ static cy_stc_ethif_mac_config_t stcENETConfig = {
                 .bintrEnable         = 1,                           /** Interrupt enable  */
                 .dmaDataBurstLen     = CY_ETHIF_DMA_DBUR_LEN_4,
                 .u8dmaCfgFlags       = CY_ETHIF_CFG_DMA_FRCE_TX_BRST,
-                .mdcPclkDiv          = CY_ETHIF_MDC_DIV_BY_48,      /** source clock is 80 MHz and MDC must be less than 2.5MHz   */
+                .mdcPclkDiv          = CY_ETHIF_MDC_DIV_BY_48,      /** Selected from the source clock at initialization; see eth_mdc_divider_select()   */
                 .u8rxLenErrDisc      = 0,                           /** Length error frame not discarded  */
                 .u8disCopyPause      = 0,
                 .u8chkSumOffEn       = 0,                           /** Checksum for both Tx and Rx disabled    */
@@ -132,16 +357,22 @@ static cy_stc_ethif_intr_config_t stcInterruptConfig = {
                 .btx_used_read          = 1,          /** Used bit set has been read in Tx descriptor list */
                 .brx_used_read          = 1,          /** Used bit set has been read in Rx descriptor list */
                 .brx_complete           = 1,          /** Frame received successfully and stored */
-                .bman_frame             = 0,          /** Management frame sent */
+                .bman_frame             = 1,          /** Management frame sent; completes the queued MDIO transactions */
 };
 
+static void eth_rx_frame_cb(ETH_Type *base, uint8_t *rx_buffer, uint32_t length);
+static void eth_rx_get_buff_cb(ETH_Type *base, uint8_t **rx_buffer, uint32_t *length);
+static void eth_tx_error_cb(ETH_Type *base, uint8_t u8QueueIndex);
+static void eth_tx_complete_cb(ETH_Type *base, uint8_t u8QueueIndex);
+static void eth_moderation_update(cy_ecm_interface_t eth_idx);
+
 static cy_stc_ethif_cb_t stcInterruptCB = {
     /** Callback functions  */
-                .rxframecb  = cy_process_ethernet_data_cb, //Ethx_RxFrameCB,
-                .txerrorcb  = cy_tx_failure_cb,
-                .txcompletecb = cy_tx_complete_cb, /** Set it to NULL if callback is not required */
+                .rxframecb  = eth_rx_frame_cb, //Ethx_RxFrameCB,
+                .txerrorcb  = eth_tx_error_cb,
+                .txcompletecb = eth_tx_complete_cb, /** Set it to NULL if callback is not required */
                 .tsuSecondInccb = NULL,
-                .rxgetbuff = cy_notify_ethernet_rx_data_cb
+                .rxgetbuff = eth_rx_get_buff_cb
 };
 
 /** Enable Ethernet interrupts  */
@@ -151,191 +382,1623 @@ static const cy_stc_sysint_t irq_cfg_eth0_q1 = {.intrSrc  = (eth_0_INTRSRC_Q1),
 static const cy_stc_sysint_t irq_cfg_eth0_q2 = {.intrSrc  = (eth_0_INTRSRC_Q2), .intrPriority=eth_0_INTRPRIORITY};
 #endif
 
-#if (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
-static const cy_stc_sysint_t irq_cfg_eth1_q0 = {.intrSrc  = (eth_1_INTRSRC_Q0), .intrPriority=eth_1_INTRPRIORITY};
-static const cy_stc_sysint_t irq_cfg_eth1_q1 = {.intrSrc  = (eth_1_INTRSRC_Q1), .intrPriority=eth_1_INTRPRIORITY};
-static const cy_stc_sysint_t irq_cfg_eth1_q2 = {.intrSrc  = (eth_1_INTRSRC_Q2), .intrPriority=eth_1_INTRPRIORITY};
-#endif
+#if (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
+static const cy_stc_sysint_t irq_cfg_eth1_q0 = {.intrSrc  = (eth_1_INTRSRC_Q0), .intrPriority=eth_1_INTRPRIORITY};
+static const cy_stc_sysint_t irq_cfg_eth1_q1 = {.intrSrc  = (eth_1_INTRSRC_Q1), .intrPriority=eth_1_INTRPRIORITY};
+static const cy_stc_sysint_t irq_cfg_eth1_q2 = {.intrSrc  = (eth_1_INTRSRC_Q2), .intrPriority=eth_1_INTRPRIORITY};
+#endif
+
+/********************************************************/
+/** Interrupt handlers for Ethernet 0     */
+#if (defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
+static void Cy_Eth0_InterruptHandler (void)
+{
+    Cy_ETHIF_DecodeEvent(ETH0);
+    cy_eth_mdio_isr(CY_ECM_INTERFACE_ETH0);
+    eth_moderation_update(CY_ECM_INTERFACE_ETH0);
+}
+#endif
+
+/** Interrupt handlers for Ethernet 1     */
+#if (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
+static void Cy_Eth1_InterruptHandler (void)
+{
+    Cy_ETHIF_DecodeEvent(ETH1);
+    cy_eth_mdio_isr(CY_ECM_INTERFACE_ETH1);
+    eth_moderation_update(CY_ECM_INTERFACE_ETH1);
+}
+#endif
+
+/********************************************************/
+static inline cy_ecm_interface_t eth_base_to_idx(ETH_Type *base)
+{
+#if CY_IP_MXETH_INSTANCES > 1
+    return (base == ETH1) ? CY_ECM_INTERFACE_ETH1 : CY_ECM_INTERFACE_ETH0;
+#else
+    (void)base;
+    return CY_ECM_INTERFACE_ETH0;
+#endif
+}
+
+static inline ETH_Type *eth_idx_to_base(cy_ecm_interface_t eth_idx)
+{
+#if CY_IP_MXETH_INSTANCES > 1
+    return (eth_idx == CY_ECM_INTERFACE_ETH1) ? ETH1 : ETH0;
+#else
+    (void)eth_idx;
+    return ETH0;
+#endif
+}
+
+/* Moderation delay for a frame rate: none up to the low rate for latency, then linear up to the maximum at the high rate */
+static uint32_t eth_moderation_target(uint32_t frame_rate)
+{
+    if(frame_rate <= CY_ECM_INT_MODERATION_LOW_RATE)
+    {
+        return 0;
+    }
+    if(frame_rate >= CY_ECM_INT_MODERATION_HIGH_RATE)
+    {
+        return CY_ECM_INT_MODERATION_MAX_DELAY_US;
+    }
+    return (uint32_t)(((uint64_t)CY_ECM_INT_MODERATION_MAX_DELAY_US * (frame_rate - CY_ECM_INT_MODERATION_LOW_RATE)) /
+                      (CY_ECM_INT_MODERATION_HIGH_RATE - CY_ECM_INT_MODERATION_LOW_RATE));
+}
+
+/* The delay drops at once when the load falls, and rises halfway to the target per interval so that a short burst does not add latency */
+static uint32_t eth_moderation_step(uint32_t current, uint32_t target)
+{
+    return (target <= current) ? target : ((current + target + 1u) / 2u);
+}
+
+/** Runs at the end of each Ethernet interrupt */
+static void eth_moderation_update(cy_ecm_interface_t eth_idx)
+{
+    eth_moderation_t *mod = &eth_moderation[eth_idx];
+    cy_time_t         now;
+    uint32_t          elapsed;
+
+    mod->irq_count++;
+    mod->stats.irq_count++;
+
+    if(cy_rtos_get_time(&now) != CY_RSLT_SUCCESS)
+    {
+        return;
+    }
+    elapsed = (uint32_t)(now - mod->interval_start);
+    if(elapsed < CY_ECM_INT_MODERATION_INTERVAL_MS)
+    {
+        return;
+    }
+
+    mod->stats.rx_frame_rate = (uint32_t)(((uint64_t)mod->rx_frames * 1000u) / elapsed);
+    mod->stats.tx_frame_rate = (uint32_t)(((uint64_t)mod->tx_frames * 1000u) / elapsed);
+    mod->stats.irq_rate      = (uint32_t)(((uint64_t)mod->irq_count * 1000u) / elapsed);
+    mod->irq_count = 0;
+    mod->rx_frames = 0;
+    mod->tx_frames = 0;
+    mod->interval_start = now;
+
+#if CY_ECM_INT_MODERATION_ENABLE
+    {
+        uint32_t rx_delay = eth_moderation_step(mod->stats.rx_delay_us, eth_moderation_target(mod->stats.rx_frame_rate));
+        uint32_t tx_delay = eth_moderation_step(mod->stats.tx_delay_us, eth_moderation_target(mod->stats.tx_frame_rate));
+
+        if((rx_delay != mod->stats.rx_delay_us) || (tx_delay != mod->stats.tx_delay_us))
+        {
+            mod->stats.rx_delay_us = rx_delay;
+            mod->stats.tx_delay_us = tx_delay;
+            mod->stats.adjust_count++;
+            eth_idx_to_base(eth_idx)->INT_MODERATION =
+                (((tx_delay * 1000u) / ETH_INT_MODERATION_UNIT_NS) << ETH_INT_MODERATION_TX_POS) |
+                ((rx_delay * 1000u) / ETH_INT_MODERATION_UNIT_NS);
+        }
+    }
+#endif
+}
+
+static inline uint32_t eth_dispatch_hash(uint16_t ethertype)
+{
+    return ((uint32_t)ethertype ^ ((uint32_t)ethertype >> 5) ^ ((uint32_t)ethertype >> 11)) & ETH_DISPATCH_MASK;
+}
+
+/* Hands a frame to the handler of its EtherType and VLAN, in place. The handler of the VLAN of the frame takes
+ * precedence over a handler of any VLAN, whichever was registered first, so the whole probe window is searched */
+static void eth_raw_dispatch(cy_ecm_interface_t eth_idx, const uint8_t *frame, uint32_t length)
+{
+    eth_dispatch_entry_t *const volatile *table = eth_dispatch_table[eth_idx];
+    const eth_dispatch_entry_t          *entry, *match = NULL;
+    uint32_t                             slot, start, cycles;
+    uint16_t                             ethertype, vlan_id = CY_ECM_VLAN_ID_ANY;
+
+    if((eth_dispatch_count[eth_idx] == 0u) || (length < CY_ECM_RAW_FRAME_MIN_LEN))
+    {
+        return;
+    }
+
+    ethertype = (uint16_t)(((uint16_t)frame[12] << 8) | frame[13]);
+    if((ethertype == ETH_ETHERTYPE_VLAN) && (length >= (CY_ECM_RAW_FRAME_MIN_LEN + 4u)))
+    {
+        vlan_id   = (uint16_t)((((uint16_t)frame[14] << 8) | frame[15]) & ETH_VLAN_ID_MSK);
+        ethertype = (uint16_t)(((uint16_t)frame[16] << 8) | frame[17]);
+    }
+
+    start = DWT->CYCCNT;
+    eth_dispatch_seq[eth_idx]++;
+    slot = eth_dispatch_hash(ethertype);
+    for(uint32_t i = 0; i < CY_ECM_DISPATCH_PROBE_MAX; i++, slot = (slot + 1u) & ETH_DISPATCH_MASK)
+    {
+        entry = table[slot];
+        if((entry != NULL) && (entry->ethertype == ethertype))
+        {
+            if(entry->vlan_id == vlan_id)
+            {
+                match = entry;
+                break;
+            }
+            if(entry->vlan_id == CY_ECM_VLAN_ID_ANY)
+            {
+                match = entry;
+            }
+        }
+    }
+    if(match != NULL)
+    {
+        match->callback(match->handle, frame, length, match->ctx);
+        eth_raw_stats[eth_idx].rx_frames++;
+    }
+    eth_dispatch_seq[eth_idx]++;
+    cycles = DWT->CYCCNT - start;
+
+    if(cycles > eth_raw_stats[eth_idx].rx_max_cycles)
+    {
+        eth_raw_stats[eth_idx].rx_max_cycles = cycles;
+    }
+}
+
+static void eth_bucket_set(eth_token_bucket_t *bucket, uint32_t rate, uint32_t burst)
+{
+    cy_time_t now = 0;
+
+    (void)cy_rtos_get_time(&now);
+    bucket->rate = rate;
+    bucket->burst = burst;
+    bucket->tokens = burst * ETH_TOKEN_UNIT;
+    bucket->last_refill = now;
+}
+
+/* Takes the token of one frame; returns false if the bucket is empty */
+static bool eth_bucket_take(eth_token_bucket_t *bucket)
+{
+    cy_time_t now;
+    uint64_t tokens;
+
+    if((cy_rtos_get_time(&now) == CY_RSLT_SUCCESS) && (now != bucket->last_refill))
+    {
+        tokens = (uint64_t)bucket->tokens + ((uint64_t)(uint32_t)(now - bucket->last_refill) * bucket->rate);
+        bucket->tokens = (tokens > ((uint64_t)bucket->burst * ETH_TOKEN_UNIT)) ?
+                         (bucket->burst * ETH_TOKEN_UNIT) : (uint32_t)tokens;
+        bucket->last_refill = now;
+    }
+
+    if(bucket->tokens < ETH_TOKEN_UNIT)
+    {
+        bucket->dropped++;
+        return false;
+    }
+    bucket->tokens -= ETH_TOKEN_UNIT;
+    bucket->passed++;
+    return true;
+}
+
+/* Returns true if the frame exceeds the rate limit of its class; runs in the receive path */
+static bool eth_storm_police(cy_ecm_interface_t eth_idx, const uint8_t *frame)
+{
+    eth_token_bucket_t *bucket;
+    cy_ecm_storm_class_t storm_class;
+
+    if((frame[0] & 0x01u) != 0u)
+    {
+        storm_class = ((frame[0] & frame[1] & frame[2] & frame[3] & frame[4] & frame[5]) == 0xFFu) ?
+                      CY_ECM_STORM_BROADCAST : CY_ECM_STORM_MULTICAST;
+    }
+    else if(memcmp(frame, eth_storm_mac[eth_idx], CY_ECM_MAC_ADDR_LEN) != 0)
+    {
+        storm_class = CY_ECM_STORM_UNKNOWN_UNICAST;
+    }
+    else
+    {
+        return false;
+    }
+
+    bucket = &eth_storm[eth_idx][storm_class];
+    return (bucket->rate != 0u) && !eth_bucket_take(bucket);
+}
+
+static inline bool eth_vlan_is_tagged(const uint8_t *frame, uint32_t length)
+{
+    return (length >= (CY_ECM_RAW_FRAME_MIN_LEN + ETH_VLAN_TAG_LEN)) && (frame[12] == (uint8_t)(ETH_ETHERTYPE_VLAN >> 8)) &&
+           (frame[13] == (uint8_t)ETH_ETHERTYPE_VLAN);
+}
+
+/* Returns the VLAN ID of a tagged frame, or CY_ECM_VLAN_ID_NONE for an untagged or priority tagged frame */
+static inline uint16_t eth_vlan_id(const uint8_t *frame, uint32_t length)
+{
+    if(!eth_vlan_is_tagged(frame, length))
+    {
+        return CY_ECM_VLAN_ID_NONE;
+    }
+    return (uint16_t)((((uint16_t)frame[14] << 8) | frame[15]) & ETH_VLAN_ID_MSK);
+}
+
+/* Returns true if the interface is not a member of the VLAN of the frame; runs in the receive path */
+static bool eth_vlan_police(cy_ecm_interface_t eth_idx, const uint8_t *frame, uint32_t length)
+{
+    eth_vlan_t *vlan = &eth_vlan[eth_idx];
+    uint16_t vlan_id = eth_vlan_id(frame, length);
+
+    /* Untagged and priority tagged frames belong to the port VLAN */
+    if(vlan_id == CY_ECM_VLAN_ID_NONE)
+    {
+        vlan_id = vlan->pvid;
+    }
+
+    if((vlan_id != CY_ECM_VLAN_ID_NONE) &&
+       ((vlan_id == vlan->pvid) || ((vlan->member[vlan_id >> 5] & (1UL << (vlan_id & 31u))) != 0u)))
+    {
+        return false;
+    }
+    vlan->rx_dropped++;
+    return true;
+}
+
+/* Removes the VLAN tag of a received frame in place and returns the new length. The payload is moved rather than the
+ * addresses, because the network stack identifies the buffer by its start address */
+static uint32_t eth_vlan_strip(cy_ecm_interface_t eth_idx, uint8_t *frame, uint32_t length)
+{
+    if(!eth_vlan_is_tagged(frame, length))
+    {
+        return length;
+    }
+
+    memmove(&frame[12], &frame[12u + ETH_VLAN_TAG_LEN], length - (12u + ETH_VLAN_TAG_LEN));
+    eth_vlan[eth_idx].rx_stripped++;
+    return length - ETH_VLAN_TAG_LEN;
+}
+
+/* Copies an untagged frame with the tag of the port VLAN inserted after the addresses */
+static const uint8_t *eth_vlan_tag(cy_ecm_interface_t eth_idx, const uint8_t *frame, uint32_t length, uint8_t pcp)
+{
+    uint8_t *tagged = eth_vlan_tx_frame[eth_idx];
+    uint16_t pvid = eth_vlan[eth_idx].pvid;
+
+    memcpy(tagged, frame, 12u);
+    tagged[12] = (uint8_t)(ETH_ETHERTYPE_VLAN >> 8);
+    tagged[13] = (uint8_t)ETH_ETHERTYPE_VLAN;
+    tagged[14] = (uint8_t)((pcp << ETH_PCP_POS) | (pvid >> 8));
+    tagged[15] = (uint8_t)pvid;
+    memcpy(&tagged[12u + ETH_VLAN_TAG_LEN], &frame[12], length - 12u);
+    return tagged;
+}
+
+/* Copies a tagged frame with its priority code point replaced */
+static const uint8_t *eth_vlan_set_pcp(cy_ecm_interface_t eth_idx, const uint8_t *frame, uint32_t length, uint8_t pcp)
+{
+    uint8_t *tagged = eth_vlan_tx_frame[eth_idx];
+
+    memcpy(tagged, frame, length);
+    tagged[14] = (uint8_t)((pcp << ETH_PCP_POS) | (tagged[14] & ((1u << ETH_PCP_POS) - 1u)));
+    return tagged;
+}
+
+/* Returns the class selector of the DSCP of an IPv4 or IPv6 frame, which is taken as its priority; 0 for other frames */
+static uint8_t eth_dscp_priority(const uint8_t *frame, uint32_t length)
+{
+    uint32_t offset = eth_vlan_is_tagged(frame, length) ? (12u + ETH_VLAN_TAG_LEN) : 12u;
+    uint16_t ethertype;
+
+    if(length < (offset + 4u))
+    {
+        return 0;
+    }
+
+    ethertype = (uint16_t)(((uint16_t)frame[offset] << 8) | frame[offset + 1u]);
+    if(ethertype == ETH_ETHERTYPE_IPV4)
+    {
+        return (uint8_t)(frame[offset + 3u] >> 5);    /* Type of service: DSCP [7:2] */
+    }
+    if(ethertype == ETH_ETHERTYPE_IPV6)
+    {
+        return (uint8_t)((frame[offset + 2u] >> 1) & 0x07u);  /* Version [7:4] and the upper traffic class bits [3:0] */
+    }
+    return 0;
+}
+
+/* Copies a frame of the source interface to the Tx queue of the mirror destination */
+static void eth_mirror_frame(cy_ecm_interface_t eth_idx, const uint8_t *frame, uint32_t length)
+{
+    eth_mirror_t *mirror = &eth_mirror[eth_idx];
+    cy_en_ethif_status_t eth_status;
+    uint32_t state;
+
+    if((mirror->filter_len != 0u) && (cy_eth_filter_run(mirror->filter, frame, length) == 0u))
+    {
+        return;
+    }
+
+    /* Frames are mirrored from the receive path and from the raw frame send; the Tx path of the destination is not
+     * reentrant, and its own interrupt cannot preempt a transmission started here */
+    state = Cy_SysLib_EnterCriticalSection();
+    if(eth_bucket_take(&mirror->bucket))
+    {
+        eth_status = Cy_ETHIF_TransmitFrame(eth_idx_to_base(mirror->destination), (uint8_t *)frame, (uint16_t)length, mirror->queue, true);
+        if(eth_status == CY_ETHIF_SUCCESS)
+        {
+            mirror->mirrored++;
+        }
+        else
+        {
+            mirror->tx_dropped++;
+        }
+    }
+    Cy_SysLib_ExitCriticalSection(state);
+}
+
+/* Waits until no dispatch can still hold an entry that was unpublished before the call. In interrupt mode, the
+ * dispatch runs to completion before this thread resumes; in polled mode, cy_eth_poll() may have been preempted */
+static void eth_dispatch_wait_grace(cy_ecm_interface_t eth_idx)
+{
+    uint32_t seq = eth_dispatch_seq[eth_idx];
+
+    while(((seq & 1u) != 0u) && (eth_dispatch_seq[eth_idx] == seq))
+    {
+        cy_rtos_delay_milliseconds(1);
+    }
+}
+
+/** Receive path; runs in the Ethernet interrupt context  */
+static void eth_rx_frame_cb(ETH_Type *base, uint8_t *rx_buffer, uint32_t length)
+{
+    cy_ecm_interface_t eth_idx = eth_base_to_idx(base);
+
+    eth_moderation[eth_idx].rx_frames++;
+    eth_frames_handled[eth_idx]++;
+
+#ifdef CY_ECM_DMA_CACHE_MAINTENANCE
+    /* Drop lines that the CPU may have speculatively loaded while the DMA was writing the frame */
+    SCB_InvalidateDCache_by_Addr((volatile void *)rx_buffer, (int32_t)length);
+#endif
+
+    if((cy_eth_capture_flags[eth_idx] & CY_ETH_CAPTURE_RX) != 0u)
+    {
+        cy_eth_capture_frame(rx_buffer, length);
+    }
+
+    if((eth_mirror_flags[eth_idx] & ETH_MIRROR_RX) != 0u)
+    {
+        eth_mirror_frame(eth_idx, rx_buffer, length);
+    }
+
+    /* A dropped frame never reaches the network stack; its buffer goes back to the DMA. Frames of other VLANs do not
+     * take the tokens of the storm control */
+    if((eth_rx_recycled[eth_idx] == NULL) &&
+       ((((eth_vlan_flags[eth_idx] & ETH_VLAN_FILTER) != 0u) && eth_vlan_police(eth_idx, rx_buffer, length)) ||
+        (eth_storm_enabled[eth_idx] && eth_storm_police(eth_idx, rx_buffer))))
+    {
+        eth_rx_recycled[eth_idx] = rx_buffer;
+        return;
+    }
+
+    /* Only a unicast frame addressed to this interface shows that the peers reach it again */
+    if(eth_rx_timestamp_armed[eth_idx] && ((rx_buffer[0] & 0x01u) == 0u))
+    {
+        cy_time_t now;
+
+        if(cy_rtos_get_time(&now) == CY_RSLT_SUCCESS)
+        {
+            eth_rx_timestamp[eth_idx] = now;
+            eth_rx_timestamp_valid[eth_idx] = true;
+        }
+        eth_rx_timestamp_armed[eth_idx] = false;
+    }
+
+    /* The buffer belongs to the network stack, which also frees it; a frame of an EtherType it does not handle is dropped there */
+    eth_raw_dispatch(eth_idx, rx_buffer, length);
+
+    /* Raw frame handlers match on the VLAN ID, so the tag is only removed for the network stack. The network stack is
+     * in the port VLAN; the frames of the other member VLANs are for the raw frame handlers only, and keep their tag
+     * if the buffer cannot be reused, so that the network stack drops them by their EtherType */
+    if((eth_vlan_flags[eth_idx] & ETH_VLAN_STRIP) != 0u)
+    {
+        uint16_t vlan_id = eth_vlan_id(rx_buffer, length);
+
+        if((vlan_id != CY_ECM_VLAN_ID_NONE) && (vlan_id != eth_vlan[eth_idx].pvid))
+        {
+            eth_vlan[eth_idx].rx_raw_only++;
+            if(eth_rx_recycled[eth_idx] == NULL)
+            {
+                eth_rx_recycled[eth_idx] = rx_buffer;
+                return;
+            }
+        }
+        else
+        {
+            length = eth_vlan_strip(eth_idx, rx_buffer, length);
+        }
+    }
+
+    cy_process_ethernet_data_cb(base, rx_buffer, length);
+}
+
+static void eth_tx_complete_cb(ETH_Type *base, uint8_t u8QueueIndex)
+{
+    cy_ecm_interface_t eth_idx = eth_base_to_idx(base);
+
+    eth_moderation[eth_idx].tx_frames++;
+    eth_frames_handled[eth_idx]++;
+    cy_tx_complete_cb(base, u8QueueIndex);
+}
+
+/** Tx error path; runs in the Ethernet interrupt context. The cause is read from the statistics registers later */
+static void eth_tx_error_cb(ETH_Type *base, uint8_t u8QueueIndex)
+{
+    if(u8QueueIndex < CY_ECM_TX_QUEUE_COUNT)
+    {
+        eth_tx_queue_errors[eth_base_to_idx(base)][u8QueueIndex]++;
+    }
+    cy_tx_failure_cb(base, u8QueueIndex);
+}
+
+static void eth_rx_get_buff_cb(ETH_Type *base, uint8_t **rx_buffer, uint32_t *length)
+{
+    cy_ecm_interface_t eth_idx = eth_base_to_idx(base);
+
+    if(eth_rx_recycled[eth_idx] != NULL)
+    {
+        *rx_buffer = eth_rx_recycled[eth_idx];
+        *length = eth_rx_buff_len[eth_idx];
+        eth_rx_recycled[eth_idx] = NULL;
+    }
+    else
+    {
+        cy_notify_ethernet_rx_data_cb(base, rx_buffer, length);
+        eth_rx_buff_len[eth_idx] = *length;
+    }
+#ifdef CY_ECM_DMA_CACHE_MAINTENANCE
+    /* Write back and drop the buffer before it is handed to the DMA, so no dirty line is evicted over the received frame */
+    if(*rx_buffer != NULL)
+    {
+        SCB_CleanInvalidateDCache_by_Addr((volatile void *)*rx_buffer, (int32_t)*length);
+    }
+#endif
+}
+
+#if CY_ECM_RXQ_EXT_ENABLED
+static void eth_fill_rx_buff_pool(ETH_Type *reg_base, uint8_t **buff_pool)
+{
+    uint32_t length;
+
+    /* Receive buffers of the additional queues are allocated from the network stack, like the buffers of queue 0 */
+    for(uint32_t i = 0; i < CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE; i++)
+    {
+        length = 0;
+        eth_rx_get_buff_cb(reg_base, &buff_pool[i], &length);
+        if(((uintptr_t)buff_pool[i] & (CY_ECM_DMA_BUFFER_ALIGNMENT - 1u)) != 0u)
+        {
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_WARNING, "Rx buffer %p is not aligned to %u bytes \n", buff_pool[i], (unsigned int)CY_ECM_DMA_BUFFER_ALIGNMENT );
+        }
+    }
+}
+#endif
+
+/* MDC dividers supported by the MAC, from the fastest to the slowest */
+static const struct
+{
+    cy_en_ethif_mdc_div_t div_sel;
+    uint32_t              divider;
+} eth_mdc_dividers[] =
+{
+    { CY_ETHIF_MDC_DIV_BY_8,   8u   },
+    { CY_ETHIF_MDC_DIV_BY_16,  16u  },
+    { CY_ETHIF_MDC_DIV_BY_32,  32u  },
+    { CY_ETHIF_MDC_DIV_BY_48,  48u  },
+    { CY_ETHIF_MDC_DIV_BY_64,  64u  },
+    { CY_ETHIF_MDC_DIV_BY_96,  96u  },
+    { CY_ETHIF_MDC_DIV_BY_128, 128u },
+    { CY_ETHIF_MDC_DIV_BY_224, 224u }
+};
+
+/* Selects the fastest MDC divider within CY_ECM_MDC_MAX_FREQUENCY_HZ and returns the resulting MDC frequency */
+static uint32_t eth_mdc_divider_select(cy_en_ethif_mdc_div_t *div_sel)
+{
+    const uint32_t count = (uint32_t)(sizeof(eth_mdc_dividers) / sizeof(eth_mdc_dividers[0]));
+#if defined(CY_ECM_MDC_SOURCE_CLOCK_HZ)
+    uint32_t src_hz = CY_ECM_MDC_SOURCE_CLOCK_HZ;
+#else
+    uint32_t src_hz = Cy_SysClk_ClkPeriGetFrequency();
+#endif
+    uint32_t i = 0;
+
+#if defined(CY_ECM_MDC_DIVIDER)
+    while((i < (count - 1u)) && (eth_mdc_dividers[i].div_sel != (cy_en_ethif_mdc_div_t)CY_ECM_MDC_DIVIDER))
+    {
+        i++;
+    }
+#else
+    while((i < (count - 1u)) && ((src_hz / eth_mdc_dividers[i].divider) > CY_ECM_MDC_MAX_FREQUENCY_HZ))
+    {
+        i++;
+    }
+    if((src_hz / eth_mdc_dividers[i].divider) > CY_ECM_MDC_MAX_FREQUENCY_HZ)
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_WARNING, "MDC exceeds %u Hz with the largest divider \n", (unsigned int)CY_ECM_MDC_MAX_FREQUENCY_HZ );
+    }
+#endif
+
+    *div_sel = eth_mdc_dividers[i].div_sel;
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "MDC: %u Hz / %u = %u Hz \n", (unsigned int)src_hz, (unsigned int)eth_mdc_dividers[i].divider,
+                    (unsigned int)(src_hz / eth_mdc_dividers[i].divider) );
+
+    return src_hz / eth_mdc_dividers[i].divider;
+}
+
+static cy_en_ethif_speed_sel_t ecm_config_to_speed_sel( cy_ecm_phy_config_t *config)
+{
+    cy_en_ethif_speed_sel_t speed_sel;
+
+    if( config->interface_speed_type == CY_ECM_SPEED_TYPE_MII)
+    {
+        speed_sel = (cy_en_ethif_speed_sel_t)config->phy_speed;
+    }
+    else if( config->interface_speed_type == CY_ECM_SPEED_TYPE_GMII)
+    {
+        speed_sel = CY_ETHIF_CTL_GMII_1000;
+    }
+    else if( config->interface_speed_type == CY_ECM_SPEED_TYPE_RGMII)
+    {
+        if(config->phy_speed == CY_ECM_PHY_SPEED_10M)
+        {
+            speed_sel = CY_ETHIF_CTL_RGMII_10;
+        }
+        else if(config->phy_speed == CY_ECM_PHY_SPEED_100M)
+        {
+            speed_sel = CY_ETHIF_CTL_RGMII_100;
+        }
+        else
+        {
+            speed_sel = CY_ETHIF_CTL_RGMII_1000;
+        }
+    }
+    else
+    {
+        speed_sel = (config->phy_speed == CY_ECM_PHY_SPEED_10M)?CY_ETHIF_CTL_RMII_10 : CY_ETHIF_CTL_RMII_100;
+    }
+
+    return speed_sel;
+}
+
+static void eth_clock_config(cy_ecm_interface_t eth_idx, cy_en_ethif_speed_sel_t speed_sel, cy_ecm_phy_speed_t phy_speed)
+{
+    if((speed_sel == CY_ETHIF_CTL_MII_10) && (phy_speed == CY_ECM_PHY_SPEED_10M))
+        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_MII_10;       /** 10 Mbps MII */
+    else if((speed_sel == CY_ETHIF_CTL_MII_100) && (phy_speed == CY_ECM_PHY_SPEED_100M))
+        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_MII_100;      /** 100 Mbps MII */
+    else if((speed_sel == CY_ETHIF_CTL_GMII_1000) && (phy_speed == CY_ECM_PHY_SPEED_1000M))
+        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_GMII_1000;    /** 1000 Mbps GMII */
+    else if((speed_sel == CY_ETHIF_CTL_RGMII_10) && (phy_speed == CY_ECM_PHY_SPEED_10M))
+        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_RGMII_10;     /** 10 Mbps RGMII */
+    else if((speed_sel == CY_ETHIF_CTL_RGMII_100) && (phy_speed == CY_ECM_PHY_SPEED_100M))
+        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_RGMII_100;    /** 100 Mbps RGMII */
+    else if((speed_sel == CY_ETHIF_CTL_RGMII_1000) && (phy_speed == CY_ECM_PHY_SPEED_1000M))
+        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_RGMII_1000;    /** 1000 Mbps RGMII */
+    else if((speed_sel == CY_ETHIF_CTL_RMII_10) && (phy_speed == CY_ECM_PHY_SPEED_10M))
+        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_RMII_10;      /** 10 Mbps RMII */
+    else if((speed_sel == CY_ETHIF_CTL_RMII_100) && (phy_speed == CY_ECM_PHY_SPEED_100M))
+        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_RMII_100;     /** 100 Mbps RMII */
+    else
+        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_RGMII_1000;  /** Error in configuration */
+    if(eth_idx == CY_ECM_INTERFACE_ETH0)
+    {
+#if (defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
+        stcWrapperConfig.bRefClockSource = (cy_en_ethif_clock_ref_t)eth_0_MAC_CLOCK;     /** Assigning Ref_Clk to HSIO clock; use an external clock from HSIO  */
+#endif
+    }
+    else if(eth_idx == CY_ECM_INTERFACE_ETH1)
+    {
+#if (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
+        stcWrapperConfig.bRefClockSource = (cy_en_ethif_clock_ref_t)eth_1_MAC_CLOCK;     /** Assigning Ref_Clk to HSIO clock; use an external clock from HSIO  */
+#endif
+    }
+    else
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s() Invalid Ethernet Interface... \n", __FUNCTION__ );
+    }
+
+    if(phy_speed == CY_ECM_PHY_SPEED_10M)
+    {
+#if (defined (CYCFG_XMC7100_DEFINED) && (CYCFG_XMC7100_DEFINED == 1u))
+        stcWrapperConfig.u8RefClkDiv = 1;                          /** RefClk: 2.5 MHz; divide Refclock by 1 to have a 25-MHz Tx clock  */
+#else
+        stcWrapperConfig.u8RefClkDiv = 10;                         /** RefClk: 25 MHz; divide Refclock by 10 to have a 2.5-MHz Tx clock  */
+#endif
+    }
+    else if(phy_speed == CY_ECM_PHY_SPEED_100M)
+    {
+        stcWrapperConfig.u8RefClkDiv = 1;                          /** RefClk: 25 MHz; divide Refclock by 1 to have a 25-MHz Tx clock  */
+    }
+    else if(phy_speed == CY_ECM_PHY_SPEED_1000M)
+    {
+        stcWrapperConfig.u8RefClkDiv = 1;                          /** RefClk: 25 MHz; divide Refclock by 1 to have a 25-MHz Tx clock  */
+    }
+    else /*(phy_speed == CY_ECM_PHY_SPEED_1000M)*/
+    {
+        stcWrapperConfig.u8RefClkDiv = 1;                          /** RefClk: 125 MHz; divide Refclock by 1 to have a 125-MHz Tx clock || Although only relevant in RGMII/GMII modes */
+    }
+
+    return;
+}
+
+cy_rslt_t cy_eth_driver_initialization(cy_ecm_interface_t eth_idx,
+                                       ETH_Type *reg_base,
+                                       cy_ecm_phy_config_t *ecm_phy_config,
+                                       const cy_ecm_phy_callbacks_t *phy_callbacks)
+{
+    cy_rslt_t  result = CY_RSLT_SUCCESS;
+    uint32_t   retry_count = 0, link_status = 0;
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+
+    if(eth_idx == CY_ECM_INTERFACE_ETH0)
+    {
+#if (defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
+        Cy_SysInt_Init(&irq_cfg_eth0_q0, Cy_Eth0_InterruptHandler);
+        Cy_SysInt_Init(&irq_cfg_eth0_q1, Cy_Eth0_InterruptHandler);
+        Cy_SysInt_Init(&irq_cfg_eth0_q2, Cy_Eth0_InterruptHandler);
+        NVIC_ClearPendingIRQ((IRQn_Type)eth_0_INTRMUXNUMBER);
+        NVIC_EnableIRQ((IRQn_Type)eth_0_INTRMUXNUMBER);
+#endif
+    }
+    else
+    {
+#if (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
+        Cy_SysInt_Init(&irq_cfg_eth1_q0, Cy_Eth1_InterruptHandler);
+        Cy_SysInt_Init(&irq_cfg_eth1_q1, Cy_Eth1_InterruptHandler);
+        Cy_SysInt_Init(&irq_cfg_eth1_q2, Cy_Eth1_InterruptHandler);
+        NVIC_ClearPendingIRQ((IRQn_Type)eth_1_INTRMUXNUMBER);
+        NVIC_EnableIRQ((IRQn_Type)eth_1_INTRMUXNUMBER);
+#endif
+    }
+
+    /* MDC divider from the actual source clock; used from the first MDIO access onwards */
+    cy_eth_mdio_set_mdc_frequency(eth_idx, eth_mdc_divider_select(&stcENETConfig.mdcPclkDiv));
+
+    /* rx Q0 buffer pool */
+    stcENETConfig.pRxQbuffPool[0] = (cy_ethif_buffpool_t *)&pRx_Q_buff_pool;
+    stcENETConfig.pRxQbuffPool[1] = NULL;
+    stcENETConfig.pRxQbuffPool[2] = NULL;
+
+    /* Queue enablement of this interface */
+    stcENETConfig.brxq1enable = eth_queue_config[eth_idx].rxq1;
+    stcENETConfig.brxq2enable = eth_queue_config[eth_idx].rxq2;
+    stcENETConfig.btxq1enable = eth_queue_config[eth_idx].txq1;
+    stcENETConfig.btxq2enable = eth_queue_config[eth_idx].txq2;
+
+#if CY_ECM_RXQ_EXT_ENABLED
+    if(!is_driver_configured)
+    {
+        for(uint8_t queue = 0; queue < 2u; queue++)
+        {
+            if((queue == 0u) ? eth_queue_config[eth_idx].rxq1 : eth_queue_config[eth_idx].rxq2)
+            {
+                eth_fill_rx_buff_pool(reg_base, rx_q_ext_buff_pool[eth_idx][queue]);
+                stcENETConfig.pRxQbuffPool[queue + 1u] = (cy_ethif_buffpool_t *)&rx_q_ext_buff_pool[eth_idx][queue];
+            }
+        }
+    }
+#endif
+
+    /** Initialize PHY  */
+    cy_eth_phy_initialization(eth_idx, reg_base, ecm_phy_config, phy_callbacks);
+
+    while( retry_count < MAX_WAIT_ETHERNET_PHY_STATUS)
+    {
+        cy_eth_mdio_new_cycle(eth_idx);
+        result = phy_callbacks->phy_get_linkstatus((uint8_t)eth_idx, &link_status);
+        if(result == CY_RSLT_SUCCESS)
+        {
+            if(link_status == 1)
+            {
+                result = CY_RSLT_SUCCESS;
+                break;
+            }
+        }
+        cy_rtos_delay_milliseconds(SLEEP_ETHERNET_PHY_STATUS);
+        retry_count += SLEEP_ETHERNET_PHY_STATUS;
+    }
+
+    if(retry_count > MAX_WAIT_ETHERNET_PHY_STATUS)
+    {
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Link up failed\n" );
+        result = CY_RSLT_ECM_ERROR;
+    }
+
+    Cy_ETHIF_RegisterCallbacks(reg_base, &stcInterruptCB);
+
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s():retry_count:[%d] END \n", __FUNCTION__, retry_count );
+
+    return result;
+}
+
+
+void cy_eth_get_memory_usage(cy_ecm_interface_t eth_idx, cy_ecm_memory_usage_t *usage)
+{
+    uint32_t rx_queues = 1u + (uint32_t)eth_queue_config[eth_idx].rxq1 + (uint32_t)eth_queue_config[eth_idx].rxq2;
+    uint32_t tx_queues = 1u + (uint32_t)eth_queue_config[eth_idx].txq1 + (uint32_t)eth_queue_config[eth_idx].txq2;
+
+    usage->rx_descriptors = rx_queues * CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE * CY_ECM_BD_SIZE;
+    usage->tx_descriptors = tx_queues * CY_ETH_DEFINE_TOTAL_BD_PER_TXQUEUE * CY_ECM_BD_SIZE;
+    usage->rx_buffers     = rx_queues * CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE * ETH_RX_BUFFER_SIZE;
+    usage->tx_buffers     = tx_queues * CY_ETH_DEFINE_TOTAL_BD_PER_TXQUEUE * (uint32_t)CY_ETH_SIZE_MAX_FRAME;
+}
+
+void cy_eth_rx_timestamp_arm(cy_ecm_interface_t eth_idx, bool enable)
+{
+    eth_rx_timestamp_valid[eth_idx] = false;
+    eth_rx_timestamp_armed[eth_idx] = enable;
+}
+
+bool cy_eth_rx_timestamp_get(cy_ecm_interface_t eth_idx, cy_time_t *rx_time)
+{
+    if(!eth_rx_timestamp_valid[eth_idx])
+    {
+        return false;
+    }
+    *rx_time = eth_rx_timestamp[eth_idx];
+    return true;
+}
+
+void cy_eth_get_mac_counters(cy_ecm_interface_t eth_idx, cy_eth_mac_counters_t *counters)
+{
+    ETH_Type *base = eth_idx_to_base(eth_idx);
+    cy_eth_mac_counters_t *acc = &eth_mac_counters[eth_idx];
+
+    acc->frames_rx            += base->FRAMES_RXED_OK;
+    acc->frames_tx            += base->FRAMES_TXED_OK;
+    acc->fcs_errors           += base->FCS_ERRORS;
+    acc->alignment_errors     += base->ALIGNMENT_ERRORS;
+    acc->symbol_errors        += base->RECEIVE_SYMBOL_ERRORS;
+    acc->rx_overruns          += base->RECEIVE_OVERRUNS;
+    acc->rx_resource_errors   += base->RECEIVE_RESOURCE_ERRORS;
+    acc->single_collisions    += base->SINGLE_COLLISIONS;
+    acc->multiple_collisions  += base->MULTIPLE_COLLISIONS;
+    acc->late_collisions      += base->LATE_COLLISIONS;
+    acc->excessive_collisions += base->EXCESSIVE_COLLISIONS;
+    acc->tx_underruns         += base->TRANSMIT_UNDER_RUNS;
+    acc->tx_error_events       = 0;
+    for(uint32_t q = 0; q < CY_ECM_TX_QUEUE_COUNT; q++)
+    {
+        acc->tx_queue_errors[q] = eth_tx_queue_errors[eth_idx][q];
+        acc->tx_error_events   += acc->tx_queue_errors[q];
+    }
+
+    *counters = *acc;
+}
+
+bool cy_eth_link_quality_update(ecm_link_quality_t *lq, const cy_eth_mac_counters_t *mac, const cy_ecm_phy_quality_t *phy)
+{
+    uint32_t frames, fcs, align, symbol, errors, sample;
+    uint64_t ppm;
+
+    frames = mac->frames_rx - lq->mac_prev.frames_rx;
+    fcs    = mac->fcs_errors - lq->mac_prev.fcs_errors;
+    align  = mac->alignment_errors - lq->mac_prev.alignment_errors;
+    symbol = mac->symbol_errors - lq->mac_prev.symbol_errors;
+    lq->mac_prev = *mac;
+
+    lq->info.frames_rx        += frames;
+    lq->info.fcs_errors       += fcs;
+    lq->info.alignment_errors += align;
+    lq->info.symbol_errors    += symbol;
+    lq->info.phy_rx_errors    += phy->rx_errors;
+    lq->info.sqi = phy->sqi;
+
+    errors = fcs + align + symbol + phy->rx_errors;
+    frames = frames + fcs + align;
+    if((frames == 0u) && (errors == 0u) && (phy->sqi == CY_ECM_SQI_UNKNOWN))
+    {
+        /* An idle link says nothing about its quality */
+        return false;
+    }
+
+    if(frames == 0u)
+    {
+        sample = (errors == 0u) ? 100u : 0u;
+    }
+    else
+    {
+        ppm = ((uint64_t)errors * 1000000u) / frames;
+        sample = (ppm >= CY_ECM_LINK_QUALITY_ERROR_FULL_SCALE_PPM) ? 0u :
+                 (100u - (uint32_t)((ppm * 100u) / CY_ECM_LINK_QUALITY_ERROR_FULL_SCALE_PPM));
+    }
+    if((phy->sqi != CY_ECM_SQI_UNKNOWN) && (phy->sqi < sample))
+    {
+        sample = phy->sqi;
+    }
+
+    lq->score_q8 += ((int32_t)(sample << 8) - lq->score_q8) / (int32_t)CY_ECM_LINK_QUALITY_SMOOTHING;
+    lq->info.score = (uint32_t)((lq->score_q8 + 128) >> 8);
+
+    if((lq->info.is_degraded == false) && (lq->info.score < CY_ECM_LINK_QUALITY_DEGRADED_THRESHOLD))
+    {
+        lq->info.is_degraded = true;
+        lq->info.degraded_count++;
+        return true;
+    }
+    if((lq->info.is_degraded == true) && (lq->info.score >= CY_ECM_LINK_QUALITY_RESTORED_THRESHOLD))
+    {
+        lq->info.is_degraded = false;
+        return true;
+    }
+
+    return false;
+}
+
+bool cy_eth_duplex_mismatch_update(ecm_duplex_monitor_t *dm, const cy_eth_mac_counters_t *mac)
+{
+    uint32_t late, excessive;
+
+    late      = mac->late_collisions - dm->mac_prev.late_collisions;
+    excessive = mac->excessive_collisions - dm->mac_prev.excessive_collisions;
+    dm->stats.late_collisions      += late;
+    dm->stats.excessive_collisions += excessive;
+    dm->stats.tx_error_events      += mac->tx_error_events - dm->mac_prev.tx_error_events;
+    dm->mac_prev = *mac;
+
+    /* The errors of one interval are judged on their own; a collision-free interval re-arms the report */
+    if((late + excessive) < CY_ECM_DUPLEX_MISMATCH_THRESHOLD)
+    {
+        if((late + excessive) == 0u)
+        {
+            dm->is_reported = false;
+        }
+        return false;
+    }
+    if(dm->is_reported == true)
+    {
+        return false;
+    }
+
+    dm->is_reported = true;
+    dm->stats.mismatch_count++;
+    return true;
+}
+
+bool cy_eth_storm_update(ecm_storm_monitor_t *sm, const uint32_t *dropped, cy_time_t now, cy_ecm_storm_class_t *storm_class)
+{
+    uint32_t i;
+
+    /* A class is in a storm from its first drop, and until an interval passes without a drop */
+    for(i = 0; i < CY_ECM_STORM_CLASS_COUNT; i++)
+    {
+        if(dropped[i] != sm->dropped_prev[i])
+        {
+            sm->is_storm_sampled[i] = true;
+        }
+    }
+
+    if((uint32_t)(now - sm->last_sample_time) >= CY_ECM_STORM_INTERVAL_MS)
+    {
+        sm->last_sample_time = now;
+        for(i = 0; i < CY_ECM_STORM_CLASS_COUNT; i++)
+        {
+            if(dropped[i] == sm->dropped_prev[i])
+            {
+                sm->is_storm_sampled[i] = false;
+            }
+            sm->dropped_prev[i] = dropped[i];
+        }
+    }
+
+    /* One change per call, so that each is notified in its own event */
+    for(i = 0; i < CY_ECM_STORM_CLASS_COUNT; i++)
+    {
+        if(sm->is_storm[i] != sm->is_storm_sampled[i])
+        {
+            sm->is_storm[i] = sm->is_storm_sampled[i];
+            if(sm->is_storm[i] == true)
+            {
+                sm->storm_count[i]++;
+            }
+            *storm_class = (cy_ecm_storm_class_t)i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool cy_eth_get_mac_full_duplex(cy_ecm_interface_t eth_idx)
+{
+    return ((eth_idx_to_base(eth_idx)->NETWORK_CONFIG & ETH_NETWORK_CONFIG_FULL_DUPLEX) != 0u);
+}
+
+void cy_eth_get_tx_dma_config(cy_ecm_interface_t eth_idx, uint32_t *burst_len, bool *is_store_and_forward)
+{
+    ETH_Type *base = eth_idx_to_base(eth_idx);
+
+    *burst_len = base->DMA_CONFIG & ETH_DMA_CONFIG_BURST_MSK;
+    *is_store_and_forward = ((base->PBUF_TXCUTTHRU & ETH_PBUF_TXCUTTHRU_ENABLE) == 0u);
+}
+
+/* Halts the transmitter at the end of the frame in progress, without waiting for the frame. TX_GO alone does not tell that
+ * the DMA is between frames, as it stays set while the queue is not empty; the halt makes the next frame wait. The
+ * first call requests the halt, and each call checks TX_GO: returns CY_RSLT_SUCCESS once the transmitter is idle, or
+ * CY_RSLT_ECM_BUSY to be called again on the next pass of the event thread. If the frame in progress has not ended
+ * after ETH_TX_HALT_MAX_CHECKS checks, the transmitter is resumed and the next call starts over */
+static cy_rslt_t eth_tx_halt(cy_ecm_interface_t eth_idx)
+{
+    ETH_Type *base = eth_idx_to_base(eth_idx);
+
+    if(eth_tx_halt_checks[eth_idx] == 0u)
+    {
+        base->NETWORK_CONTROL |= ETH_NETWORK_CONTROL_TX_HALT;
+    }
+    if((base->TRANSMIT_STATUS & ETH_TRANSMIT_STATUS_TX_GO) == 0u)
+    {
+        eth_tx_halt_checks[eth_idx] = 0u;
+        return CY_RSLT_SUCCESS;
+    }
+
+    eth_tx_halt_checks[eth_idx]++;
+    if(eth_tx_halt_checks[eth_idx] > ETH_TX_HALT_MAX_CHECKS)
+    {
+        base->NETWORK_CONTROL |= ETH_NETWORK_CONTROL_TX_START;
+        eth_tx_halt_checks[eth_idx] = 0u;
+    }
+    return CY_RSLT_ECM_BUSY;
+}
+
+/* Resumes the frames queued while the transmitter was halted */
+static void eth_tx_resume(ETH_Type *base)
+{
+    base->NETWORK_CONTROL |= ETH_NETWORK_CONTROL_TX_START;
+}
+
+bool cy_eth_tx_is_halting(cy_ecm_interface_t eth_idx)
+{
+    return (eth_tx_halt_checks[eth_idx] != 0u);
+}
+
+cy_rslt_t cy_eth_tx_fallback(cy_ecm_interface_t eth_idx)
+{
+    ETH_Type *base = eth_idx_to_base(eth_idx);
+    uint32_t  burst_len = base->DMA_CONFIG & ETH_DMA_CONFIG_BURST_MSK;
+
+    if(((base->PBUF_TXCUTTHRU & ETH_PBUF_TXCUTTHRU_ENABLE) == 0u) && (burst_len <= 1u))
+    {
+        return CY_RSLT_ECM_NOT_SUPPORTED;
+    }
+
+    /* The DMA settings are changed only between frames */
+    if(eth_tx_halt(eth_idx) != CY_RSLT_SUCCESS)
+    {
+        return CY_RSLT_ECM_BUSY;
+    }
+
+    /* A frame is sent only once it is completely in the packet buffer, so that the DMA cannot fall behind the MAC. This
+     * only affects the transmitter, so it is tried first */
+    if((base->PBUF_TXCUTTHRU & ETH_PBUF_TXCUTTHRU_ENABLE) != 0u)
+    {
+        base->PBUF_TXCUTTHRU &= ~ETH_PBUF_TXCUTTHRU_ENABLE;
+        eth_tx_resume(base);
+        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Tx switched to store and forward \n" );
+        return CY_RSLT_SUCCESS;
+    }
+
+    /* Shorter bursts hold the bus for less time, at the cost of DMA efficiency; 16 -> 8 -> 4 -> single. The burst
+     * length is shared by the Rx DMA, so it is restored by cy_eth_tx_restore_burst once the link recovers */
+    if(eth_tx_burst_default[eth_idx] == 0u)
+    {
+        eth_tx_burst_default[eth_idx] = burst_len;
+    }
+    burst_len = (burst_len >= 16u) ? 8u : ((burst_len >= 8u) ? 4u : 1u);
+    base->DMA_CONFIG = (base->DMA_CONFIG & ~ETH_DMA_CONFIG_BURST_MSK) | burst_len;
+    eth_tx_resume(base);
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Tx DMA burst length reduced to %u \n", (unsigned int)burst_len );
+
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_eth_tx_restore_burst(cy_ecm_interface_t eth_idx)
+{
+    ETH_Type *base = eth_idx_to_base(eth_idx);
+
+    if(eth_tx_burst_default[eth_idx] == 0u)
+    {
+        /* A halt left pending by a fallback that the link change dropped */
+        if(eth_tx_halt_checks[eth_idx] != 0u)
+        {
+            eth_tx_halt_checks[eth_idx] = 0u;
+            eth_tx_resume(base);
+        }
+        return CY_RSLT_SUCCESS;
+    }
+
+    if(eth_tx_halt(eth_idx) != CY_RSLT_SUCCESS)
+    {
+        return CY_RSLT_ECM_BUSY;
+    }
+    base->DMA_CONFIG = (base->DMA_CONFIG & ~ETH_DMA_CONFIG_BURST_MSK) | eth_tx_burst_default[eth_idx];
+    eth_tx_resume(base);
+    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_INFO, "Tx DMA burst length restored to %u \n", (unsigned int)eth_tx_burst_default[eth_idx] );
+    eth_tx_burst_default[eth_idx] = 0u;
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cy_eth_get_int_moderation_stats(cy_ecm_interface_t eth_idx, cy_ecm_int_moderation_stats_t *stats)
+{
+    uint32_t state = Cy_SysLib_EnterCriticalSection();
+
+    *stats = eth_moderation[eth_idx].stats;
+    Cy_SysLib_ExitCriticalSection(state);
+    stats->eth_idx = eth_idx;
+}
+
+void cy_eth_set_polled_mode(cy_ecm_interface_t eth_idx, bool enable)
+{
+    IRQn_Type irqn;
+
+#if (defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u)) && (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
+    irqn = (eth_idx == CY_ECM_INTERFACE_ETH1) ? (IRQn_Type)eth_1_INTRMUXNUMBER : (IRQn_Type)eth_0_INTRMUXNUMBER;
+#elif (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
+    irqn = (IRQn_Type)eth_1_INTRMUXNUMBER;
+#else
+    irqn = (IRQn_Type)eth_0_INTRMUXNUMBER;
+#endif
+
+    if(enable)
+    {
+        NVIC_DisableIRQ(irqn);
+        eth_polled_mode[eth_idx] = true;
+
+        /* With the interrupt disabled, the MDIO frames are completed synchronously by the caller */
+        cy_eth_mdio_set_async(eth_idx, false);
+
+        /* The moderation delays only matter to the interrupt */
+        eth_idx_to_base(eth_idx)->INT_MODERATION = 0;
+        eth_moderation[eth_idx].stats.rx_delay_us = 0;
+        eth_moderation[eth_idx].stats.tx_delay_us = 0;
+    }
+    else
+    {
+        eth_polled_mode[eth_idx] = false;
+        /* The events raised while polled are handled by the first interrupt */
+        NVIC_EnableIRQ(irqn);
+        cy_eth_mdio_set_async(eth_idx, true);
+    }
+    eth_poll_stats[eth_idx].is_polled = enable;
+}
+
+bool cy_eth_is_polled_mode(cy_ecm_interface_t eth_idx)
+{
+    return eth_polled_mode[eth_idx];
+}
+
+/* Each pass of Cy_ETHIF_DecodeEvent() handles at most the descriptors of the rings; the passes stop once the budget is
+ * reached or a pass finds nothing, so that the frames handled per call are at most the budget plus one pass */
+void cy_eth_poll(cy_ecm_interface_t eth_idx, uint32_t budget)
+{
+    ETH_Type            *base = eth_idx_to_base(eth_idx);
+    cy_ecm_poll_stats_t *stats = &eth_poll_stats[eth_idx];
+    uint32_t             start = DWT->CYCCNT;
+    uint32_t             first = eth_frames_handled[eth_idx];
+    uint32_t             before, frames, cycles;
+
+    do
+    {
+        before = eth_frames_handled[eth_idx];
+        Cy_ETHIF_DecodeEvent(base);
+        cy_eth_mdio_isr(eth_idx);
+        frames = eth_frames_handled[eth_idx] - first;
+    } while((eth_frames_handled[eth_idx] != before) && (frames < budget));
+
+    cycles = DWT->CYCCNT - start;
+
+    stats->poll_count++;
+    stats->frames += frames;
+    stats->last_cycles = cycles;
+    if(cycles > stats->max_cycles)
+    {
+        stats->max_cycles = cycles;
+    }
+    if(frames > stats->max_frames)
+    {
+        stats->max_frames = frames;
+    }
+    if(frames >= budget)
+    {
+        stats->budget_exhausted_count++;
+    }
+}
+
+void cy_eth_get_poll_stats(cy_ecm_interface_t eth_idx, cy_ecm_poll_stats_t *stats)
+{
+    uint32_t state = Cy_SysLib_EnterCriticalSection();
+
+    *stats = eth_poll_stats[eth_idx];
+    Cy_SysLib_ExitCriticalSection(state);
+    stats->eth_idx = eth_idx;
+}
+
+/* Updates are serialized by the caller; the receive path is never blocked */
+cy_rslt_t cy_eth_raw_register(cy_ecm_interface_t eth_idx, uint16_t ethertype, uint16_t vlan_id,
+                              cy_ecm_raw_rx_cb_t callback, void *ctx, cy_ecm_t handle)
+{
+    eth_dispatch_entry_t *old_entry = NULL, *new_entry = NULL;
+    uint32_t              slot, target = CY_ECM_DISPATCH_TABLE_SIZE;
+
+    /* The slot of the same key, or else the first free slot in the probe window */
+    slot = eth_dispatch_hash(ethertype);
+    for(uint32_t i = 0; i < CY_ECM_DISPATCH_PROBE_MAX; i++, slot = (slot + 1u) & ETH_DISPATCH_MASK)
+    {
+        eth_dispatch_entry_t *entry = eth_dispatch_table[eth_idx][slot];
+
+        if((entry != NULL) && (entry->ethertype == ethertype) && (entry->vlan_id == vlan_id))
+        {
+            old_entry = entry;
+            target = slot;
+            break;
+        }
+        if((entry == NULL) && (target == CY_ECM_DISPATCH_TABLE_SIZE))
+        {
+            target = slot;
+        }
+    }
+
+    if(callback == NULL)
+    {
+        if(old_entry == NULL)
+        {
+            return CY_RSLT_SUCCESS;
+        }
+    }
+    else
+    {
+        if(target == CY_ECM_DISPATCH_TABLE_SIZE)
+        {
+            return CY_RSLT_ECM_ERROR_NOMEM;
+        }
+        for(uint32_t i = 0; i < (CY_ECM_DISPATCH_TABLE_SIZE + 1u); i++)
+        {
+            if(eth_dispatch_pool[eth_idx][i].callback == NULL)
+            {
+                new_entry = &eth_dispatch_pool[eth_idx][i];
+                break;
+            }
+        }
+        if(new_entry == NULL)
+        {
+            return CY_RSLT_ECM_ERROR_NOMEM;
+        }
+        new_entry->ethertype = ethertype;
+        new_entry->vlan_id   = vlan_id;
+        new_entry->ctx       = ctx;
+        new_entry->handle    = handle;
+        new_entry->callback  = callback;
+    }
+
+    /* The entry is complete in memory before the receive path can see it */
+    __DMB();
+    eth_dispatch_table[eth_idx][target] = new_entry;
+    if(old_entry == NULL)
+    {
+        eth_dispatch_count[eth_idx]++;
+    }
+    else if(new_entry == NULL)
+    {
+        eth_dispatch_count[eth_idx]--;
+    }
+
+    if(old_entry != NULL)
+    {
+        eth_dispatch_wait_grace(eth_idx);
+        old_entry->callback = NULL;
+    }
 
-/********************************************************/
-/** Interrupt handlers for Ethernet 0     */
-#if (defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
-static void Cy_Eth0_InterruptHandler (void)
-{
-    Cy_ETHIF_DecodeEvent(ETH0);
+    return CY_RSLT_SUCCESS;
 }
-#endif
 
-/** Interrupt handlers for Ethernet 1     */
-#if (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
-static void Cy_Eth1_InterruptHandler (void)
+void cy_eth_raw_unregister_all(cy_ecm_interface_t eth_idx)
 {
-    Cy_ETHIF_DecodeEvent(ETH1);
+    eth_dispatch_count[eth_idx] = 0;
+    for(uint32_t i = 0; i < CY_ECM_DISPATCH_TABLE_SIZE; i++)
+    {
+        eth_dispatch_table[eth_idx][i] = NULL;
+    }
+    eth_dispatch_wait_grace(eth_idx);
+    memset(eth_dispatch_pool[eth_idx], 0, sizeof(eth_dispatch_pool[eth_idx]));
 }
-#endif
 
-static cy_en_ethif_speed_sel_t ecm_config_to_speed_sel( cy_ecm_phy_config_t *config)
+/* The PDL copies the frame into its own Tx buffer, so the caller may reuse the frame on return. A frame whose tag
+ * is inserted or changed is copied once more */
+cy_rslt_t cy_eth_raw_send(cy_ecm_interface_t eth_idx, const uint8_t *frame, uint32_t length, uint8_t queue, uint8_t pcp)
 {
-    cy_en_ethif_speed_sel_t speed_sel;
+    cy_ecm_raw_stats_t  *stats = &eth_raw_stats[eth_idx];
+    cy_en_ethif_status_t eth_status;
+    uint32_t             start, cycles;
+    bool                 is_tagged = false;
 
-    if( config->interface_speed_type == CY_ECM_SPEED_TYPE_MII)
+    if(((queue == 1u) && !eth_queue_config[eth_idx].txq1) || ((queue == 2u) && !eth_queue_config[eth_idx].txq2))
     {
-        speed_sel = (cy_en_ethif_speed_sel_t)config->phy_speed;
+        return CY_RSLT_MODULE_ECM_BADARG;
     }
-    else if( config->interface_speed_type == CY_ECM_SPEED_TYPE_GMII)
+
+    if(eth_mirror_destination[eth_idx])
     {
-        speed_sel = CY_ETHIF_CTL_GMII_1000;
+        return CY_RSLT_ECM_BUSY;
     }
-    else if( config->interface_speed_type == CY_ECM_SPEED_TYPE_RGMII)
+
+    if(((eth_vlan_flags[eth_idx] & ETH_VLAN_TAG) != 0u) && !eth_vlan_is_tagged(frame, length))
     {
-        if(config->phy_speed == CY_ECM_PHY_SPEED_10M)
-        {
-            speed_sel = CY_ETHIF_CTL_RGMII_10;
-        }
-        else if(config->phy_speed == CY_ECM_PHY_SPEED_100M)
-        {
-            speed_sel = CY_ETHIF_CTL_RGMII_100;
-        }
-        else
+        if(length > (CY_ECM_RAW_FRAME_MAX_LEN - ETH_VLAN_TAG_LEN))
         {
-            speed_sel = CY_ETHIF_CTL_RGMII_1000;
+            return CY_RSLT_MODULE_ECM_BADARG;
         }
+        frame = eth_vlan_tag(eth_idx, frame, length, (pcp == CY_ETH_PCP_KEEP) ? 0u : pcp);
+        length += ETH_VLAN_TAG_LEN;
+        is_tagged = true;
     }
-    else
+    else if((pcp != CY_ETH_PCP_KEEP) && eth_vlan_is_tagged(frame, length))
     {
-        speed_sel = (config->phy_speed == CY_ECM_PHY_SPEED_10M)?CY_ETHIF_CTL_RMII_10 : CY_ETHIF_CTL_RMII_100;
+        frame = eth_vlan_set_pcp(eth_idx, frame, length, pcp);
     }
 
-    return speed_sel;
+    start = DWT->CYCCNT;
+    eth_status = Cy_ETHIF_TransmitFrame(eth_idx_to_base(eth_idx), (uint8_t *)frame, (uint16_t)length, queue, true);
+    cycles = DWT->CYCCNT - start;
+
+    switch(eth_status)
+    {
+        case CY_ETHIF_SUCCESS:
+            stats->tx_frames++;
+            if(cycles > stats->tx_max_cycles)
+            {
+                stats->tx_max_cycles = cycles;
+            }
+            if(is_tagged)
+            {
+                eth_vlan[eth_idx].tx_tagged++;
+            }
+            if((cy_eth_capture_flags[eth_idx] & CY_ETH_CAPTURE_TX) != 0u)
+            {
+                cy_eth_capture_frame(frame, length);
+            }
+            if((eth_mirror_flags[eth_idx] & ETH_MIRROR_TX) != 0u)
+            {
+                eth_mirror_frame(eth_idx, frame, length);
+            }
+            return CY_RSLT_SUCCESS;
+
+        case CY_ETHIF_BUFFER_NOT_AVAILABLE:
+        case CY_ETHIF_MEMORY_NOT_ENOUGH:
+            stats->tx_busy++;
+            return CY_RSLT_ECM_BUSY;
+
+        case CY_ETHIF_LINK_DOWN:
+            return CY_RSLT_ECM_LINK_DOWN;
+
+        default:
+            cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_ERR, "Raw frame transmit failed with ethStatus=0x%X \n", eth_status );
+            return CY_RSLT_ECM_ERROR;
+    }
 }
 
-static void eth_clock_config(cy_ecm_interface_t eth_idx, cy_en_ethif_speed_sel_t speed_sel, cy_ecm_phy_speed_t phy_speed)
+cy_rslt_t cy_eth_raw_send_priority(cy_ecm_interface_t eth_idx, const uint8_t *frame, uint32_t length, uint8_t priority)
 {
-    if((speed_sel == CY_ETHIF_CTL_MII_10) && (phy_speed == CY_ECM_PHY_SPEED_10M))
-        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_MII_10;       /** 10 Mbps MII */
-    else if((speed_sel == CY_ETHIF_CTL_MII_100) && (phy_speed == CY_ECM_PHY_SPEED_100M))
-        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_MII_100;      /** 100 Mbps MII */
-    else if((speed_sel == CY_ETHIF_CTL_GMII_1000) && (phy_speed == CY_ECM_PHY_SPEED_1000M))
-        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_GMII_1000;    /** 1000 Mbps GMII */
-    else if((speed_sel == CY_ETHIF_CTL_RGMII_10) && (phy_speed == CY_ECM_PHY_SPEED_10M))
-        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_RGMII_10;     /** 10 Mbps RGMII */
-    else if((speed_sel == CY_ETHIF_CTL_RGMII_100) && (phy_speed == CY_ECM_PHY_SPEED_100M))
-        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_RGMII_100;    /** 100 Mbps RGMII */
-    else if((speed_sel == CY_ETHIF_CTL_RGMII_1000) && (phy_speed == CY_ECM_PHY_SPEED_1000M))
-        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_RGMII_1000;    /** 1000 Mbps RGMII */
-    else if((speed_sel == CY_ETHIF_CTL_RMII_10) && (phy_speed == CY_ECM_PHY_SPEED_10M))
-        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_RMII_10;      /** 10 Mbps RMII */
-    else if((speed_sel == CY_ETHIF_CTL_RMII_100) && (phy_speed == CY_ECM_PHY_SPEED_100M))
-        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_RMII_100;     /** 100 Mbps RMII */
-    else
-        stcWrapperConfig.stcInterfaceSel = CY_ETHIF_CTL_RGMII_1000;  /** Error in configuration */
-    if(eth_idx == CY_ECM_INTERFACE_ETH0)
+    const cy_ecm_priority_map_t *map = &eth_priority_map[eth_idx];
+
+    if(priority == CY_ECM_PRIORITY_DSCP)
     {
-#if (defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
-        stcWrapperConfig.bRefClockSource = (cy_en_ethif_clock_ref_t)eth_0_MAC_CLOCK;     /** Assigning Ref_Clk to HSIO clock; use an external clock from HSIO  */
-#endif
+        priority = eth_dscp_priority(frame, length);
     }
-    else if(eth_idx == CY_ECM_INTERFACE_ETH1)
+    return cy_eth_raw_send(eth_idx, frame, length, map->tx_queue[priority], map->tx_pcp[priority]);
+}
+
+void cy_eth_get_raw_stats(cy_ecm_interface_t eth_idx, cy_ecm_raw_stats_t *stats)
+{
+    uint32_t state = Cy_SysLib_EnterCriticalSection();
+
+    *stats = eth_raw_stats[eth_idx];
+    stats->handler_count = eth_dispatch_count[eth_idx];
+    Cy_SysLib_ExitCriticalSection(state);
+    stats->eth_idx = eth_idx;
+}
+
+void cy_eth_storm_init(cy_ecm_interface_t eth_idx, const uint8_t *mac_address)
+{
+    uint32_t state = Cy_SysLib_EnterCriticalSection();
+
+    eth_storm_enabled[eth_idx] = false;
+    memset(eth_storm[eth_idx], 0, sizeof(eth_storm[eth_idx]));
+    memcpy(eth_storm_mac[eth_idx], mac_address, CY_ECM_MAC_ADDR_LEN);
+    Cy_SysLib_ExitCriticalSection(state);
+}
+
+cy_rslt_t cy_eth_set_storm_control(cy_ecm_interface_t eth_idx, cy_ecm_storm_class_t storm_class, uint32_t rate, uint32_t burst)
+{
+    bool enabled = false;
+    uint32_t state;
+
+    if(((rate != 0u) && (burst == 0u)) || (burst > ETH_TOKEN_BURST_MAX))
+    {
+        return CY_RSLT_MODULE_ECM_BADARG;
+    }
+
+    state = Cy_SysLib_EnterCriticalSection();
+    eth_bucket_set(&eth_storm[eth_idx][storm_class], rate, burst);
+    for(uint32_t i = 0; i < CY_ECM_STORM_CLASS_COUNT; i++)
+    {
+        enabled = enabled || (eth_storm[eth_idx][i].rate != 0u);
+    }
+    eth_storm_enabled[eth_idx] = enabled;
+    Cy_SysLib_ExitCriticalSection(state);
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cy_eth_get_storm_stats(cy_ecm_interface_t eth_idx, cy_ecm_storm_stats_t *stats)
+{
+    uint32_t state = Cy_SysLib_EnterCriticalSection();
+
+    for(uint32_t i = 0; i < CY_ECM_STORM_CLASS_COUNT; i++)
     {
+        stats->rate[i]    = eth_storm[eth_idx][i].rate;
+        stats->burst[i]   = eth_storm[eth_idx][i].burst;
+        stats->passed[i]  = eth_storm[eth_idx][i].passed;
+        stats->dropped[i] = eth_storm[eth_idx][i].dropped;
+    }
+    Cy_SysLib_ExitCriticalSection(state);
+    stats->eth_idx = eth_idx;
+}
+
+/* Interrupt priority of an interface; a lower value preempts a higher one */
+static uint32_t eth_irq_priority(cy_ecm_interface_t eth_idx)
+{
 #if (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
-        stcWrapperConfig.bRefClockSource = (cy_en_ethif_clock_ref_t)eth_1_MAC_CLOCK;     /** Assigning Ref_Clk to HSIO clock; use an external clock from HSIO  */
+    if(eth_idx == CY_ECM_INTERFACE_ETH1)
+    {
+        return irq_cfg_eth1_q0.intrPriority;
+    }
 #endif
+#if (defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
+    if(eth_idx == CY_ECM_INTERFACE_ETH0)
+    {
+        return irq_cfg_eth0_q0.intrPriority;
     }
-    else
+#endif
+    return 0;
+}
+
+cy_rslt_t cy_eth_mirror_start(cy_ecm_interface_t eth_idx, cy_ecm_interface_t destination, const cy_ecm_mirror_config_t *config)
+{
+    eth_mirror_t *mirror = &eth_mirror[eth_idx];
+
+    if(((config->queue == 1u) && !eth_queue_config[destination].txq1) || ((config->queue == 2u) && !eth_queue_config[destination].txq2) ||
+       (config->burst > ETH_TOKEN_BURST_MAX))
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s() Invalid Ethernet Interface... \n", __FUNCTION__ );
+        return CY_RSLT_MODULE_ECM_BADARG;
     }
 
-    if(phy_speed == CY_ECM_PHY_SPEED_10M)
+    if((config->filter_len > CY_ECM_CAPTURE_FILTER_MAX_LEN) || ((config->filter_len != 0u) && (config->filter == NULL)) ||
+       ((config->filter_len != 0u) && !cy_eth_filter_validate(config->filter, config->filter_len)))
     {
-#if (defined (CYCFG_XMC7100_DEFINED) && (CYCFG_XMC7100_DEFINED == 1u))
-        stcWrapperConfig.u8RefClkDiv = 1;                          /** RefClk: 2.5 MHz; divide Refclock by 1 to have a 25-MHz Tx clock  */
-#else
-        stcWrapperConfig.u8RefClkDiv = 10;                         /** RefClk: 25 MHz; divide Refclock by 10 to have a 2.5-MHz Tx clock  */
-#endif
+        return CY_RSLT_ECM_INVALID_FILTER;
     }
-    else if(phy_speed == CY_ECM_PHY_SPEED_100M)
+
+    /* The interrupt of the destination must not be preempted by the source, which transmits on it */
+    if(eth_irq_priority(destination) > eth_irq_priority(eth_idx))
     {
-        stcWrapperConfig.u8RefClkDiv = 1;                          /** RefClk: 25 MHz; divide Refclock by 1 to have a 25-MHz Tx clock  */
+        return CY_RSLT_ECM_NOT_SUPPORTED;
     }
-    else if(phy_speed == CY_ECM_PHY_SPEED_1000M)
+
+    /* No chain; a source mirrors to one destination */
+    if(eth_mirror_destination[eth_idx] || (eth_mirror_flags[destination] != 0u) ||
+       ((eth_mirror_flags[eth_idx] != 0u) && (mirror->destination != destination)))
     {
-        stcWrapperConfig.u8RefClkDiv = 1;                          /** RefClk: 25 MHz; divide Refclock by 1 to have a 25-MHz Tx clock  */
+        return CY_RSLT_ECM_BUSY;
     }
-    else /*(phy_speed == CY_ECM_PHY_SPEED_1000M)*/
+
+    eth_mirror_flags[eth_idx] = 0;
+
+    /* The mirror path no longer reads the state */
+    mirror->destination = destination;
+    mirror->queue = config->queue;
+    mirror->filter_len = config->filter_len;
+    if(config->filter_len != 0u)
     {
-        stcWrapperConfig.u8RefClkDiv = 1;                          /** RefClk: 125 MHz; divide Refclock by 1 to have a 125-MHz Tx clock || Although only relevant in RGMII/GMII modes */
+        memcpy(mirror->filter, config->filter, config->filter_len * sizeof(cy_ecm_capture_insn_t));
     }
+    eth_bucket_set(&mirror->bucket, config->rate, config->burst);
+    mirror->bucket.passed = 0;
+    mirror->bucket.dropped = 0;
+    mirror->mirrored = 0;
+    mirror->tx_dropped = 0;
+    eth_mirror_destination[destination] = true;
 
-    return;
+    __DMB();
+    eth_mirror_flags[eth_idx] = (uint8_t)((config->mirror_rx ? ETH_MIRROR_RX : 0u) | (config->mirror_tx ? ETH_MIRROR_TX : 0u));
+
+    return CY_RSLT_SUCCESS;
 }
 
-cy_rslt_t cy_eth_driver_initialization(cy_ecm_interface_t eth_idx,
-                                       ETH_Type *reg_base,
-                                       cy_ecm_phy_config_t *ecm_phy_config,
-                                       cy_ecm_phy_callbacks_t *phy_callbacks)
+void cy_eth_mirror_stop(cy_ecm_interface_t eth_idx)
 {
-    cy_rslt_t  result = CY_RSLT_SUCCESS;
-    uint32_t   retry_count = 0, link_status = 0;
+    if(eth_mirror_flags[eth_idx] != 0u)
+    {
+        eth_mirror_flags[eth_idx] = 0;
+        eth_mirror_destination[eth_mirror[eth_idx].destination] = false;
+    }
+}
 
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s(): START \n", __FUNCTION__ );
+void cy_eth_mirror_detach(cy_ecm_interface_t eth_idx)
+{
+    for(uint32_t i = 0; i < CY_ECM_ETH_INTERFACE_MAX; i++)
+    {
+        if(((cy_ecm_interface_t)i == eth_idx) || (eth_mirror[i].destination == eth_idx))
+        {
+            cy_eth_mirror_stop((cy_ecm_interface_t)i);
+        }
+    }
+}
 
-    if(eth_idx == CY_ECM_INTERFACE_ETH0)
+bool cy_eth_is_mirror_destination(cy_ecm_interface_t eth_idx)
+{
+    return eth_mirror_destination[eth_idx];
+}
+
+void cy_eth_get_mirror_stats(cy_ecm_interface_t eth_idx, cy_ecm_mirror_stats_t *stats)
+{
+    uint32_t state = Cy_SysLib_EnterCriticalSection();
+
+    stats->eth_idx      = eth_idx;
+    stats->destination  = eth_mirror[eth_idx].destination;
+    stats->is_rx        = ((eth_mirror_flags[eth_idx] & ETH_MIRROR_RX) != 0u);
+    stats->is_tx        = ((eth_mirror_flags[eth_idx] & ETH_MIRROR_TX) != 0u);
+    stats->mirrored     = eth_mirror[eth_idx].mirrored;
+    stats->rate_dropped = eth_mirror[eth_idx].bucket.dropped;
+    stats->tx_dropped   = eth_mirror[eth_idx].tx_dropped;
+    Cy_SysLib_ExitCriticalSection(state);
+}
+
+void cy_eth_vlan_init(cy_ecm_interface_t eth_idx)
+{
+    uint32_t state = Cy_SysLib_EnterCriticalSection();
+
+    eth_vlan_flags[eth_idx] = 0;
+    memset(&eth_vlan[eth_idx], 0, sizeof(eth_vlan[eth_idx]));
+    eth_idx_to_base(eth_idx)->NETWORK_CONFIG &= ~ETH_NETWORK_CONFIG_DISCARD_NON_VLAN;
+    Cy_SysLib_ExitCriticalSection(state);
+}
+
+void cy_eth_set_vlan_config(cy_ecm_interface_t eth_idx, const cy_ecm_vlan_config_t *config)
+{
+    ETH_Type *base = eth_idx_to_base(eth_idx);
+    uint32_t state = Cy_SysLib_EnterCriticalSection();
+
+    eth_vlan[eth_idx].pvid = config->pvid;
+    eth_vlan_flags[eth_idx] = (uint8_t)((config->filter ? ETH_VLAN_FILTER : 0u) | (config->strip_rx ? ETH_VLAN_STRIP : 0u) |
+                                        (config->tag_tx ? ETH_VLAN_TAG : 0u));
+
+    /* Without a port VLAN, the MAC drops the untagged frames before they take a receive buffer */
+    if(config->filter && (config->pvid == CY_ECM_VLAN_ID_NONE))
     {
-#if (defined (eth_0_ENABLED) && (eth_0_ENABLED == 1u))
-        Cy_SysInt_Init(&irq_cfg_eth0_q0, Cy_Eth0_InterruptHandler);
-        Cy_SysInt_Init(&irq_cfg_eth0_q1, Cy_Eth0_InterruptHandler);
-        Cy_SysInt_Init(&irq_cfg_eth0_q2, Cy_Eth0_InterruptHandler);
-        NVIC_ClearPendingIRQ((IRQn_Type)eth_0_INTRMUXNUMBER);
-        NVIC_EnableIRQ((IRQn_Type)eth_0_INTRMUXNUMBER);
-#endif
+        base->NETWORK_CONFIG |= ETH_NETWORK_CONFIG_DISCARD_NON_VLAN;
     }
     else
     {
-#if (defined (eth_1_ENABLED) && (eth_1_ENABLED == 1u))
-        Cy_SysInt_Init(&irq_cfg_eth1_q0, Cy_Eth1_InterruptHandler);
-        Cy_SysInt_Init(&irq_cfg_eth1_q1, Cy_Eth1_InterruptHandler);
-        Cy_SysInt_Init(&irq_cfg_eth1_q2, Cy_Eth1_InterruptHandler);
-        NVIC_ClearPendingIRQ((IRQn_Type)eth_1_INTRMUXNUMBER);
-        NVIC_EnableIRQ((IRQn_Type)eth_1_INTRMUXNUMBER);
-#endif
+        base->NETWORK_CONFIG &= ~ETH_NETWORK_CONFIG_DISCARD_NON_VLAN;
     }
+    Cy_SysLib_ExitCriticalSection(state);
+}
 
-    /* rx Q0 buffer pool */
-    stcENETConfig.pRxQbuffPool[0] = (cy_ethif_buffpool_t *)&pRx_Q_buff_pool;
-    stcENETConfig.pRxQbuffPool[1] = NULL;
+void cy_eth_set_vlan_member(cy_ecm_interface_t eth_idx, uint16_t vlan_id, bool is_member)
+{
+    eth_vlan_t *vlan = &eth_vlan[eth_idx];
+    uint32_t bit = 1UL << (vlan_id & 31u);
+    uint32_t state = Cy_SysLib_EnterCriticalSection();
 
-    /** Initialize PHY  */
-    cy_eth_phy_initialization(eth_idx, reg_base, ecm_phy_config, phy_callbacks);
+    if(is_member && ((vlan->member[vlan_id >> 5] & bit) == 0u))
+    {
+        vlan->member[vlan_id >> 5] |= bit;
+        vlan->member_count++;
+    }
+    else if(!is_member && ((vlan->member[vlan_id >> 5] & bit) != 0u))
+    {
+        vlan->member[vlan_id >> 5] &= ~bit;
+        vlan->member_count--;
+    }
+    Cy_SysLib_ExitCriticalSection(state);
+}
 
-    while( retry_count < MAX_WAIT_ETHERNET_PHY_STATUS)
+void cy_eth_get_vlan_stats(cy_ecm_interface_t eth_idx, cy_ecm_vlan_stats_t *stats)
+{
+    uint32_t state = Cy_SysLib_EnterCriticalSection();
+
+    stats->eth_idx        = eth_idx;
+    stats->pvid           = eth_vlan[eth_idx].pvid;
+    stats->member_count   = eth_vlan[eth_idx].member_count;
+    stats->is_hw_filtered = ((eth_idx_to_base(eth_idx)->NETWORK_CONFIG & ETH_NETWORK_CONFIG_DISCARD_NON_VLAN) != 0u);
+    stats->rx_dropped     = eth_vlan[eth_idx].rx_dropped;
+    stats->rx_stripped    = eth_vlan[eth_idx].rx_stripped;
+    stats->rx_raw_only    = eth_vlan[eth_idx].rx_raw_only;
+    stats->tx_tagged      = eth_vlan[eth_idx].tx_tagged;
+    Cy_SysLib_ExitCriticalSection(state);
+}
+
+void cy_eth_priority_init(cy_ecm_interface_t eth_idx)
+{
+    cy_ecm_priority_map_t map;
+
+    /* Every priority on queue 0, with its own priority code point */
+    memset(&map, 0, sizeof(map));
+    for(uint32_t i = 0; i < CY_ECM_PRIORITY_COUNT; i++)
     {
-        result = phy_callbacks->phy_get_linkstatus((uint8_t)eth_idx, &link_status);
-        if(result == CY_RSLT_SUCCESS)
+        map.tx_pcp[i] = (uint8_t)i;
+    }
+    (void)cy_eth_set_priority_map(eth_idx, &map);
+}
+
+cy_rslt_t cy_eth_set_priority_map(cy_ecm_interface_t eth_idx, const cy_ecm_priority_map_t *map)
+{
+    volatile uint32_t *screener = (volatile uint32_t *)&eth_idx_to_base(eth_idx)->SCREENING_TYPE_2_REGISTER_0;
+    uint32_t count = 0;
+
+    for(uint32_t i = 0; i < CY_ECM_PRIORITY_COUNT; i++)
+    {
+        if((map->rx_queue[i] >= CY_ECM_RX_QUEUE_COUNT) || (map->tx_queue[i] >= CY_ECM_TX_QUEUE_COUNT) || (map->tx_pcp[i] >= CY_ECM_PRIORITY_COUNT) ||
+           ((map->rx_queue[i] == 1u) && !eth_queue_config[eth_idx].rxq1) || ((map->rx_queue[i] == 2u) && !eth_queue_config[eth_idx].rxq2) ||
+           ((map->tx_queue[i] == 1u) && !eth_queue_config[eth_idx].txq1) || ((map->tx_queue[i] == 2u) && !eth_queue_config[eth_idx].txq2))
         {
-            if(link_status == 1)
-            {
-                result = CY_RSLT_SUCCESS;
-                break;
-            }
+            return CY_RSLT_MODULE_ECM_BADARG;
         }
-        cy_rtos_delay_milliseconds(SLEEP_ETHERNET_PHY_STATUS);
-        retry_count += SLEEP_ETHERNET_PHY_STATUS;
     }
 
-    if(retry_count > MAX_WAIT_ETHERNET_PHY_STATUS)
+    for(uint32_t i = 0; i < CY_ECM_PRIORITY_COUNT; i++)
     {
-        cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Link up failed\n" );
-        result = CY_RSLT_ECM_ERROR;
+        if(map->rx_queue[i] != 0u)
+        {
+            screener[count++] = (uint32_t)map->rx_queue[i] | (i << ETH_SCREENING_TYPE_2_VLAN_PRIORITY_POS) | ETH_SCREENING_TYPE_2_VLAN_ENABLE;
+        }
+    }
+    /* A cleared screener steers to queue 0, where the unmatched frames go anyway */
+    while(count < CY_ECM_PRIORITY_COUNT)
+    {
+        screener[count++] = 0;
     }
 
-    Cy_ETHIF_RegisterCallbacks(reg_base, &stcInterruptCB);
-
-    cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "%s():retry_count:[%d] END \n", __FUNCTION__, retry_count );
+    eth_priority_map[eth_idx] = *map;
+    return CY_RSLT_SUCCESS;
+}
 
-    return result;
+void cy_eth_get_priority_map(cy_ecm_interface_t eth_idx, cy_ecm_priority_map_t *map)
+{
+    *map = eth_priority_map[eth_idx];
 }
 
+void cy_eth_set_mac_full_duplex(cy_ecm_interface_t eth_idx, bool is_full_duplex)
+{
+    ETH_Type *base = eth_idx_to_base(eth_idx);
+
+    if(is_full_duplex)
+    {
+        base->NETWORK_CONFIG |= ETH_NETWORK_CONFIG_FULL_DUPLEX;
+    }
+    else
+    {
+        base->NETWORK_CONFIG &= ~ETH_NETWORK_CONFIG_FULL_DUPLEX;
+    }
+}
 
 void deregister_cb(ETH_Type *reg_base)
 {
@@ -356,7 +2019,7 @@ void deregister_cb(ETH_Type *reg_base)
 *******************************************************************************/
 static void cy_eth_phy_initialization (cy_ecm_interface_t eth_idx, ETH_Type *reg_base,
                                        cy_ecm_phy_config_t *ecm_phy_config,
-                                       cy_ecm_phy_callbacks_t *phy_callbacks)
+                                       const cy_ecm_phy_callbacks_t *phy_callbacks)
 {
     cy_en_ethif_speed_sel_t speed_sel;
     uint32_t                duplex = 0, phy_speed = 0, neg_status = 0;
@@ -410,14 +2073,30 @@ static void cy_eth_phy_initialization (cy_ecm_interface_t eth_idx, ETH_Type *reg
             do
             {
                 cy_rtos_delay_milliseconds(100);
-                result = phy_callbacks->phy_get_auto_neg_status((uint8_t)eth_idx, &neg_status);
+                cy_eth_mdio_new_cycle(eth_idx);
+                if(phy_callbacks->phy_get_auto_neg_status != NULL)
+                {
+                    result = phy_callbacks->phy_get_auto_neg_status((uint8_t)eth_idx, &neg_status);
+                }
+                else
+                {
+                    /* Without an autonegotiation status, link up indicates that the negotiation completed */
+                    result = phy_callbacks->phy_get_linkstatus((uint8_t)eth_idx, &neg_status);
+                }
                 if(result != CY_RSLT_SUCCESS)
                 {
                     break;
                 }
             } while(neg_status == 0);
 
-            result = phy_callbacks->phy_get_link_partner_cap((uint8_t)eth_idx, &duplex, &phy_speed);
+            if(phy_callbacks->phy_get_link_partner_cap != NULL)
+            {
+                result = phy_callbacks->phy_get_link_partner_cap((uint8_t)eth_idx, &duplex, &phy_speed);
+            }
+            else
+            {
+                result = phy_callbacks->phy_get_linkspeed((uint8_t)eth_idx, &duplex, &phy_speed);
+            }
             if(result == CY_RSLT_SUCCESS)
             {
                 ecm_phy_config->phy_speed = (cy_ecm_phy_speed_t)phy_speed;
@@ -437,6 +2116,11 @@ static void cy_eth_phy_initialization (cy_ecm_interface_t eth_idx, ETH_Type *reg
             cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Ethernet MAC Init failed with ethStatus=0x%X \n", eth_status );
             return;
         }
+        /* Cy_ETHIF_Init programs the default DMA configuration */
+        eth_tx_burst_default[eth_idx] = 0u;
+        eth_tx_halt_checks[eth_idx] = 0u;
+        /* The management frame interrupt is enabled from here on */
+        cy_eth_mdio_set_async(eth_idx, true);
         if(!(ecm_phy_config->phy_speed == CY_ECM_PHY_SPEED_AUTO || ecm_phy_config->mode == CY_ECM_DUPLEX_AUTO))
         {
             /* Initialize the PHY */
@@ -445,13 +2129,19 @@ static void cy_eth_phy_initialization (cy_ecm_interface_t eth_idx, ETH_Type *reg
         is_driver_configured = true;
     }
     cy_ecm_log_msg( CYLF_MIDDLEWARE, CY_LOG_DEBUG, "Register driver callbacks  \n" );
-    stcInterruptCB.rxframecb  = cy_process_ethernet_data_cb;
+    stcInterruptCB.rxframecb  = eth_rx_frame_cb;
 
     /* Reset the PHY */
-    (void)phy_callbacks->phy_reset((uint8_t)eth_idx, reg_base);
+    if(phy_callbacks->phy_reset != NULL)
+    {
+        (void)phy_callbacks->phy_reset((uint8_t)eth_idx, reg_base);
+    }
 
     /* Discover */
-    (void)phy_callbacks->phy_discover((uint8_t)eth_idx);
+    if(phy_callbacks->phy_discover != NULL)
+    {
+        (void)phy_callbacks->phy_discover((uint8_t)eth_idx);
+    }
 
     duplex = ecm_phy_config->mode;
     phy_speed = ecm_phy_config->phy_speed;
@@ -459,7 +2149,10 @@ static void cy_eth_phy_initialization (cy_ecm_interface_t eth_idx, ETH_Type *reg
     (void)phy_callbacks->phy_configure((uint8_t)eth_idx, duplex, phy_speed);
 
     /* Enable PHY extended registers */
-    (void)phy_callbacks->phy_enable_ext_reg(reg_base, phy_speed);
+    if(phy_callbacks->phy_enable_ext_reg != NULL)
+    {
+        (void)phy_callbacks->phy_enable_ext_reg(reg_base, phy_speed);
+    }
 }
 
 // EMAC END *******
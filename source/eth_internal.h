@@ -40,8 +40,11 @@
 #define ETHERNET_INTERNAL_H
 
 #include "cy_result.h"
+#include "cy_eth_user_config.h"
 #include "cy_ethif.h"
 #include "cy_ecm.h"
+#include "cyabs_rtos.h"
+#include "cy_network_mw_core.h"
 
 extern int eth_index_internal;
 
@@ -54,6 +57,8 @@ extern int eth_index_internal;
  /* After hardware initialization, max wait time to get the physical link up */
 #define MAX_WAIT_ETHERNET_PHY_STATUS          (10000)
 
+#define CY_ECM_ETH_INTERFACE_MAX              (2)
+
 /**
  * Structure containing the configuration parameters to configure Ethernet PHY and MAC for data transfer handling
  */
@@ -64,7 +69,177 @@ typedef struct
     cy_ecm_duplex_t mode;                     /**< Transfer mode */
 } cy_ecm_phy_config_t;
 
-cy_rslt_t  cy_eth_driver_initialization(cy_ecm_interface_t eth_idx, ETH_Type *eth_type, cy_ecm_phy_config_t *ecm_phy_config, cy_ecm_phy_callbacks_t *phy_callbacks);
+/* MAC statistics accumulated since the driver started; the counters wrap around */
+typedef struct
+{
+    uint32_t frames_rx;
+    uint32_t frames_tx;
+    uint32_t fcs_errors;
+    uint32_t alignment_errors;
+    uint32_t symbol_errors;
+    uint32_t rx_overruns;
+    uint32_t rx_resource_errors;
+    uint32_t single_collisions;
+    uint32_t multiple_collisions;
+    uint32_t late_collisions;
+    uint32_t excessive_collisions;
+    uint32_t tx_underruns;
+    uint32_t tx_error_events;      /* Tx error interrupts */
+    uint32_t tx_queue_errors[CY_ECM_TX_QUEUE_COUNT];
+} cy_eth_mac_counters_t;
+
+/* Internal state of the link quality monitor */
+typedef struct
+{
+    bool                          is_started;           /* Counters baselined since the last link up */
+    int32_t                       score_q8;             /* Rolling score, 0 to 100 in Q8 fixed point */
+    cy_time_t                     last_sample_time;
+    cy_eth_mac_counters_t         mac_prev;             /* MAC counters at the previous sample */
+    cy_ecm_link_quality_t         info;
+} ecm_link_quality_t;
+
+/* Internal state of the duplex mismatch detector */
+typedef struct
+{
+    bool                          is_started;           /* Counters baselined since the last link up */
+    bool                          is_reported;          /* Mismatch reported; cleared by a collision-free interval or a link change */
+    bool                          is_resync_pending;    /* Autonegotiation restarted; the MAC follows the PHY duplex at the next link up */
+    cy_ecm_duplex_mismatch_action_t action;
+    cy_ecm_duplex_t               forced_duplex;
+    cy_time_t                     last_sample_time;
+    cy_eth_mac_counters_t         mac_prev;
+    cy_ecm_duplex_stats_t         stats;
+} ecm_duplex_monitor_t;
+
+/* Internal state of the Tx underrun monitor */
+typedef struct
+{
+    cy_time_t                     last_sample_time;
+    uint32_t                      underruns_prev;       /* Underrun count at the previous sample */
+    bool                          is_fallback_pending;  /* Underrun threshold exceeded; applied once the transmitter is idle */
+    bool                          is_restore_pending;   /* Link recovered; the Rx/Tx DMA burst length is restored once the transmitter is idle */
+    uint32_t                      fallback_count;
+} ecm_tx_monitor_t;
+
+/* Internal state of the storm detector; the frames are counted and dropped in the receive path */
+typedef struct
+{
+    cy_time_t                     last_sample_time;
+    uint32_t                      dropped_prev[CY_ECM_STORM_CLASS_COUNT];
+    bool                          is_storm[CY_ECM_STORM_CLASS_COUNT];        /* State last reported */
+    bool                          is_storm_sampled[CY_ECM_STORM_CLASS_COUNT]; /* State at the last sample; reported one class at a time */
+    uint32_t                      storm_count[CY_ECM_STORM_CLASS_COUNT];
+} ecm_storm_monitor_t;
+
+/* Secondary IPv4 address of an interface, in network byte order */
+typedef struct
+{
+    bool                          is_used;
+    uint32_t                      address;
+    uint32_t                      netmask;
+} ecm_ip_alias_t;
+
+/**
+ * Ethernet Connection Manager handle.
+ * Fields read on every link poll and in the data path come first, so that they share a cache line; the fields used
+ * only by connection management APIs follow.
+ */
+typedef struct ecm_object
+{
+    /* Hot */
+    ETH_Type                     *eth_base_type;
+    const cy_ecm_phy_callbacks_t *eth_phy_cb;           /* Application callback table; referenced, not copied */
+    cy_ecm_interface_t            eth_idx;
+    bool                          isobjinitialized;     /* Indicates that the ECM object is initialized      */
+    bool                          network_up;
+
+    /* Cold */
+    cy_network_interface_context *iface_context;
+    void*                         user_data;            /* Argument to be passed back to the user while invoking the callback */
+    cy_mutex_t                    obj_mutex;            /* Mutex to serialize object access in multi-threading mode  */
+    uint8_t                       mac_address[CY_ECM_MAC_ADDR_LEN];
+    bool                          is_static_ip;         /* Connected with a static address; no DHCP to restart on link up */
+    bool                          recovery_pending;     /* Link came up while connected; waiting for traffic to resume */
+    bool                          is_suspended;         /* Traffic suspended by cy_ecm_suspend; the network interface is kept */
+    bool                          is_diag_running;      /* Cable diagnostics in progress; link changes are not reported */
+    cy_time_t                     link_up_time;         /* Time at which the link up was detected */
+    cy_ecm_recovery_stats_t       recovery_stats;
+    ecm_link_quality_t            link_quality;
+    ecm_duplex_monitor_t          duplex_monitor;
+    ecm_tx_monitor_t              tx_monitor;
+    ecm_storm_monitor_t           storm_monitor;
+    ecm_ip_alias_t                ip_alias[CY_ECM_IP_ALIAS_MAX];
+} cy_ecm_object_t;
+
+cy_rslt_t  cy_eth_driver_initialization(cy_ecm_interface_t eth_idx, ETH_Type *eth_type, cy_ecm_phy_config_t *ecm_phy_config, const cy_ecm_phy_callbacks_t *phy_callbacks);
 void deregister_cb(ETH_Type *reg_base);
+void cy_eth_get_memory_usage(cy_ecm_interface_t eth_idx, cy_ecm_memory_usage_t *usage);
+void cy_eth_rx_timestamp_arm(cy_ecm_interface_t eth_idx, bool enable);
+bool cy_eth_rx_timestamp_get(cy_ecm_interface_t eth_idx, cy_time_t *rx_time);
+void cy_eth_get_mac_counters(cy_ecm_interface_t eth_idx, cy_eth_mac_counters_t *counters);
+/* Scores the counters of one link quality sample into the rolling score; returns true if the score crossed a threshold */
+bool cy_eth_link_quality_update(ecm_link_quality_t *lq, const cy_eth_mac_counters_t *mac, const cy_ecm_phy_quality_t *phy);
+/* Counts the collisions of one duplex mismatch interval; returns true if a mismatch is newly detected */
+bool cy_eth_duplex_mismatch_update(ecm_duplex_monitor_t *dm, const cy_eth_mac_counters_t *mac);
+/* Samples the storm control drop counts; returns true and the class if a class started or ended a storm */
+bool cy_eth_storm_update(ecm_storm_monitor_t *sm, const uint32_t *dropped, cy_time_t now, cy_ecm_storm_class_t *storm_class);
+bool cy_eth_get_mac_full_duplex(cy_ecm_interface_t eth_idx);
+void cy_eth_set_mac_full_duplex(cy_ecm_interface_t eth_idx, bool is_full_duplex);
+void cy_eth_get_tx_dma_config(cy_ecm_interface_t eth_idx, uint32_t *burst_len, bool *is_store_and_forward);
+cy_rslt_t cy_eth_tx_fallback(cy_ecm_interface_t eth_idx);
+cy_rslt_t cy_eth_tx_restore_burst(cy_ecm_interface_t eth_idx);
+#define CY_ETH_TX_HALT_CHECK_MS               (2u)      /* Pace of the event thread while the transmitter is being halted */
+bool cy_eth_tx_is_halting(cy_ecm_interface_t eth_idx);
+void cy_eth_get_int_moderation_stats(cy_ecm_interface_t eth_idx, cy_ecm_int_moderation_stats_t *stats);
+void cy_eth_set_polled_mode(cy_ecm_interface_t eth_idx, bool enable);
+bool cy_eth_is_polled_mode(cy_ecm_interface_t eth_idx);
+void cy_eth_poll(cy_ecm_interface_t eth_idx, uint32_t budget);
+void cy_eth_get_poll_stats(cy_ecm_interface_t eth_idx, cy_ecm_poll_stats_t *stats);
+cy_rslt_t cy_eth_raw_register(cy_ecm_interface_t eth_idx, uint16_t ethertype, uint16_t vlan_id,
+                              cy_ecm_raw_rx_cb_t callback, void *ctx, cy_ecm_t handle);
+void cy_eth_raw_unregister_all(cy_ecm_interface_t eth_idx);
+#define CY_ETH_PCP_KEEP                       (0xFFu)   /* Raw frame sent with its priority code point unchanged */
+cy_rslt_t cy_eth_raw_send(cy_ecm_interface_t eth_idx, const uint8_t *frame, uint32_t length, uint8_t queue, uint8_t pcp);
+cy_rslt_t cy_eth_raw_send_priority(cy_ecm_interface_t eth_idx, const uint8_t *frame, uint32_t length, uint8_t priority);
+void cy_eth_get_raw_stats(cy_ecm_interface_t eth_idx, cy_ecm_raw_stats_t *stats);
+void cy_eth_storm_init(cy_ecm_interface_t eth_idx, const uint8_t *mac_address);
+cy_rslt_t cy_eth_set_storm_control(cy_ecm_interface_t eth_idx, cy_ecm_storm_class_t storm_class, uint32_t rate, uint32_t burst);
+void cy_eth_get_storm_stats(cy_ecm_interface_t eth_idx, cy_ecm_storm_stats_t *stats);
+cy_rslt_t cy_eth_mirror_start(cy_ecm_interface_t eth_idx, cy_ecm_interface_t destination, const cy_ecm_mirror_config_t *config);
+void cy_eth_mirror_stop(cy_ecm_interface_t eth_idx);
+void cy_eth_mirror_detach(cy_ecm_interface_t eth_idx);
+bool cy_eth_is_mirror_destination(cy_ecm_interface_t eth_idx);
+void cy_eth_get_mirror_stats(cy_ecm_interface_t eth_idx, cy_ecm_mirror_stats_t *stats);
+void cy_eth_vlan_init(cy_ecm_interface_t eth_idx);
+void cy_eth_set_vlan_config(cy_ecm_interface_t eth_idx, const cy_ecm_vlan_config_t *config);
+void cy_eth_set_vlan_member(cy_ecm_interface_t eth_idx, uint16_t vlan_id, bool is_member);
+void cy_eth_get_vlan_stats(cy_ecm_interface_t eth_idx, cy_ecm_vlan_stats_t *stats);
+void cy_eth_priority_init(cy_ecm_interface_t eth_idx);
+cy_rslt_t cy_eth_set_priority_map(cy_ecm_interface_t eth_idx, const cy_ecm_priority_map_t *map);
+void cy_eth_get_priority_map(cy_ecm_interface_t eth_idx, cy_ecm_priority_map_t *map);
+
+/* Packet capture; cy_ecm_capture.c */
+#define CY_ETH_CAPTURE_RX                     (0x01u)
+#define CY_ETH_CAPTURE_TX                     (0x02u)
+
+extern volatile uint8_t cy_eth_capture_flags[CY_ECM_ETH_INTERFACE_MAX];   /* CY_ETH_CAPTURE_* of the interface being captured */
+
+cy_rslt_t cy_eth_capture_start(cy_ecm_interface_t eth_idx, const cy_ecm_capture_config_t *config);
+void cy_eth_capture_stop(cy_ecm_interface_t eth_idx);
+void cy_eth_capture_frame(const uint8_t *frame, uint32_t length);
+uint32_t cy_eth_capture_read(cy_ecm_interface_t eth_idx, uint8_t *buffer, uint32_t size);
+void cy_eth_capture_get_stats(cy_ecm_interface_t eth_idx, cy_ecm_capture_stats_t *stats);
+bool cy_eth_filter_validate(const cy_ecm_capture_insn_t *filter, uint32_t filter_len);
+uint32_t cy_eth_filter_run(const cy_ecm_capture_insn_t *insn, const uint8_t *frame, uint32_t length);
+
+/* MDIO access layer; cy_ecm_mdio.c */
+cy_rslt_t cy_eth_mdio_init(cy_ecm_interface_t eth_idx, ETH_Type *base);
+void cy_eth_mdio_deinit(cy_ecm_interface_t eth_idx);
+bool cy_eth_mdio_is_bus_shared(cy_ecm_interface_t eth_idx);
+void cy_eth_mdio_set_mdc_frequency(cy_ecm_interface_t eth_idx, uint32_t mdc_hz);
+void cy_eth_mdio_set_async(cy_ecm_interface_t eth_idx, bool enable);
+void cy_eth_mdio_isr(cy_ecm_interface_t eth_idx);
+void cy_eth_mdio_new_cycle(cy_ecm_interface_t eth_idx);
+void cy_eth_mdio_get_stats(cy_ecm_interface_t eth_idx, cy_ecm_mdio_stats_t *stats);
 
 #endif /* ETHERNET_INTERNAL_H */ 
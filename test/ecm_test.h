@@ -0,0 +1,112 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file ecm_test.h
+* @brief Checks and timing helpers of the ECM host tests; see test/README.md.
+*/
+
+#ifndef ECM_TEST_H
+#define ECM_TEST_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+extern uint32_t test_checks;
+extern uint32_t test_failures;
+
+/* Records a failed check and goes on with the test */
+#define TEST_CHECK(cond)                                                                        \
+    do                                                                                          \
+    {                                                                                           \
+        test_checks++;                                                                          \
+        if(!(cond))                                                                             \
+        {                                                                                       \
+            test_failures++;                                                                    \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);                              \
+        }                                                                                       \
+    } while(0)
+
+#define TEST_CHECK_EQ(actual, expected)                                                         \
+    do                                                                                          \
+    {                                                                                           \
+        unsigned long long test_a = (unsigned long long)(actual);                               \
+        unsigned long long test_e = (unsigned long long)(expected);                             \
+        test_checks++;                                                                          \
+        if(test_a != test_e)                                                                    \
+        {                                                                                       \
+            test_failures++;                                                                    \
+            printf("FAIL %s:%d: %s is 0x%llX, expected 0x%llX\n", __FILE__, __LINE__, #actual, test_a, test_e); \
+        }                                                                                       \
+    } while(0)
+
+/* Operations are timed in batches, so that the clock read costs little against the operation */
+#define TEST_BENCH_BATCH            (100u)
+#define TEST_BENCH_BATCHES          (2000u)
+
+static inline uint64_t test_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/* Times one statement; prints the mean over all batches and the mean of the fastest batch, in nanoseconds of the host */
+#define TEST_BENCH(name, stmt)                                                                  \
+    do                                                                                          \
+    {                                                                                           \
+        uint64_t test_total = 0, test_min = UINT64_MAX;                                         \
+        for(uint32_t test_b = 0; test_b < TEST_BENCH_BATCHES; test_b++)                         \
+        {                                                                                       \
+            uint64_t test_start = test_now_ns();                                                \
+            for(uint32_t test_i = 0; test_i < TEST_BENCH_BATCH; test_i++)                       \
+            {                                                                                   \
+                stmt;                                                                           \
+            }                                                                                   \
+            uint64_t test_ns = test_now_ns() - test_start;                                      \
+            test_total += test_ns;                                                              \
+            test_min = (test_ns < test_min) ? test_ns : test_min;                               \
+        }                                                                                       \
+        printf("BENCH %-44s %7.1f ns/op  (best batch %5.1f ns/op)\n", name,                    \
+               (double)test_total / (TEST_BENCH_BATCHES * TEST_BENCH_BATCH), (double)test_min / TEST_BENCH_BATCH); \
+    } while(0)
+
+void test_capture_run(void);
+void test_frame_path_run(void);
+void test_mdio_run(void);
+void test_phy_generic_run(void);
+void test_link_monitor_run(void);
+
+#endif /* ECM_TEST_H */
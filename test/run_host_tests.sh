@@ -0,0 +1,27 @@
+#!/bin/sh
+#
+# Builds and runs the ECM host tests with the host C compiler. The PDL, RTOS, and network stack are replaced by the
+# stand-ins of test/stubs, so the tests cover the logic of the ECM sources, and the BENCH lines give host timings only;
+# see test/README.md.
+#
+# Usage: test/run_host_tests.sh [build directory]
+
+set -e
+
+TEST_DIR=$(cd "$(dirname "$0")" && pwd)
+ROOT_DIR=$(dirname "$TEST_DIR")
+BUILD_DIR=${1:-"$ROOT_DIR/_host_test_build"}
+CC=${CC:-cc}
+
+mkdir -p "$BUILD_DIR"
+
+# Rx queues 1 and 2 and Tx queue 1 of ETH0 are enabled to cover the priority mapping; ETH1 keeps the defaults
+$CC -std=gnu11 -O2 -g -Wall -Wextra -Werror -Wno-unused-parameter -Wno-unused-function \
+    -DCY_ECM_ETH0_RXQ1_ENABLE=1u -DCY_ECM_ETH0_RXQ2_ENABLE=1u -DCY_ECM_ETH0_TXQ1_ENABLE=1u \
+    -I"$TEST_DIR" -I"$TEST_DIR/stubs" -I"$ROOT_DIR/include" -I"$ROOT_DIR/source" -I"$ROOT_DIR/configs" \
+    "$TEST_DIR/test_main.c" "$TEST_DIR/test_capture.c" "$TEST_DIR/test_frame_path.c" "$TEST_DIR/test_mdio.c" \
+    "$TEST_DIR/test_phy_generic.c" "$TEST_DIR/test_link_monitor.c" \
+    "$TEST_DIR/stubs/test_stubs.c" "$ROOT_DIR/source/cy_ecm_capture.c" "$ROOT_DIR/source/cy_ecm_mdio.c" \
+    -o "$BUILD_DIR/ecm_host_test"
+
+"$BUILD_DIR/ecm_host_test"
@@ -0,0 +1,205 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file cy_ethif.h
+* @brief Host stand-in for the Ethernet PDL driver. The MAC registers are plain memory that the tests set and inspect;
+* see test/README.md.
+*/
+
+#ifndef CY_ETHIF_H
+#define CY_ETHIF_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct
+{
+    volatile uint32_t NETWORK_CONTROL;
+    volatile uint32_t NETWORK_CONFIG;
+    volatile uint32_t NETWORK_STATUS;
+    volatile uint32_t DMA_CONFIG;
+    volatile uint32_t TRANSMIT_STATUS;
+    volatile uint32_t PHY_MANAGEMENT;
+    volatile uint32_t INT_MODERATION;
+    volatile uint32_t PBUF_TXCUTTHRU;
+    volatile uint32_t FCS_ERRORS;
+    volatile uint32_t ALIGNMENT_ERRORS;
+    volatile uint32_t RECEIVE_SYMBOL_ERRORS;
+    volatile uint32_t LATE_COLLISIONS;
+    volatile uint32_t EXCESSIVE_COLLISIONS;
+    volatile uint32_t TRANSMIT_UNDER_RUNS;
+    volatile uint32_t RECEIVE_OVERRUNS;
+    volatile uint32_t RECEIVE_RESOURCE_ERRORS;
+    volatile uint32_t FRAMES_RXED_OK;
+    volatile uint32_t FRAMES_TXED_OK;
+    volatile uint32_t SINGLE_COLLISIONS;
+    volatile uint32_t MULTIPLE_COLLISIONS;
+    volatile uint32_t SCREENING_TYPE_2_REGISTER_0[16];
+} ETH_Type;
+
+extern ETH_Type test_eth0, test_eth1;
+#define ETH0                                    (&test_eth0)
+#define ETH1                                    (&test_eth1)
+#define CY_IP_MXETH_INSTANCES                   (2u)
+
+#ifndef CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE
+#define CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE      (4u)
+#endif
+#ifndef CY_ETH_DEFINE_TOTAL_BD_PER_TXQUEUE
+#define CY_ETH_DEFINE_TOTAL_BD_PER_TXQUEUE      (2u)
+#endif
+#define CY_ETH_SIZE_MAX_FRAME                   (1536u)
+#define CY_ETH_DEFINE_NUM_RXQS                  (3u)
+#define CY_ETH_DEFINE_NUM_TXQS                  (3u)
+
+typedef uint8_t *cy_ethif_buffpool_t[CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE];
+
+typedef enum
+{
+    CY_ETHIF_SUCCESS = 0,
+    CY_ETHIF_BAD_PARAM,
+    CY_ETHIF_MEMORY_NOT_ENOUGH,
+    CY_ETHIF_LINK_DOWN,
+    CY_ETHIF_LINK_UP,
+    CY_ETHIF_BUFFER_NOT_AVAILABLE
+} cy_en_ethif_status_t;
+
+typedef enum
+{
+    CY_ETHIF_CTL_MII_10 = 0,
+    CY_ETHIF_CTL_MII_100,
+    CY_ETHIF_CTL_GMII_1000,
+    CY_ETHIF_CTL_RGMII_10,
+    CY_ETHIF_CTL_RGMII_100,
+    CY_ETHIF_CTL_RGMII_1000,
+    CY_ETHIF_CTL_RMII_10,
+    CY_ETHIF_CTL_RMII_100
+} cy_en_ethif_speed_sel_t;
+
+typedef enum { CY_ETHIF_EXTERNAL_HSIO = 0 } cy_en_ethif_clock_ref_t;
+
+typedef enum
+{
+    CY_ETHIF_DMA_DBUR_LEN_1 = 1,
+    CY_ETHIF_DMA_DBUR_LEN_4 = 4,
+    CY_ETHIF_DMA_DBUR_LEN_8 = 8,
+    CY_ETHIF_DMA_DBUR_LEN_16 = 16
+} cy_en_ethif_dma_data_buffer_len_t;
+
+typedef enum
+{
+    CY_ETHIF_MDC_DIV_BY_8 = 0,
+    CY_ETHIF_MDC_DIV_BY_16,
+    CY_ETHIF_MDC_DIV_BY_32,
+    CY_ETHIF_MDC_DIV_BY_48,
+    CY_ETHIF_MDC_DIV_BY_64,
+    CY_ETHIF_MDC_DIV_BY_96,
+    CY_ETHIF_MDC_DIV_BY_128,
+    CY_ETHIF_MDC_DIV_BY_224
+} cy_en_ethif_mdc_div_t;
+
+#define CY_ETHIF_CFG_DMA_FRCE_RX_BRST           (0x2u)
+#define CY_ETHIF_CFG_DMA_FRCE_TX_BRST           (0x4u)
+
+typedef enum { CY_ETHIF_FILTER_TYPE_DESTINATION = 0, CY_ETHIF_FILTER_TYPE_SOURCE = 1 } cy_en_ethif_filter_type_t;
+typedef enum { CY_ETHIF_FILTER_NUM_1 = 1 } cy_en_ethif_filter_num_t;
+
+typedef struct { uint8_t byte[6]; } cy_stc_ethif_mac_address_t;
+
+typedef struct
+{
+    cy_en_ethif_filter_type_t  typeFilter;
+    cy_stc_ethif_mac_address_t filterAddr;
+    uint8_t                    ignoreBytes;
+} cy_stc_ethif_filter_config_t;
+
+typedef struct
+{
+    cy_en_ethif_speed_sel_t stcInterfaceSel;
+    cy_en_ethif_clock_ref_t bRefClockSource;
+    uint8_t                 u8RefClkDiv;
+} cy_stc_ethif_wrapper_config_t;
+
+typedef struct cy_stc_ethif_tsu_config cy_stc_ethif_tsu_config_t;
+
+typedef struct
+{
+    bool                              bintrEnable;
+    cy_en_ethif_dma_data_buffer_len_t dmaDataBurstLen;
+    uint8_t                           u8dmaCfgFlags;
+    cy_en_ethif_mdc_div_t             mdcPclkDiv;
+    uint8_t                           u8rxLenErrDisc, u8disCopyPause, u8chkSumOffEn, u8rx1536ByteEn, u8rxJumboFrEn;
+    uint8_t                           u8enRxBadPreamble, u8ignoreIpgRxEr, u8storeUdpTcpOffset;
+    uint8_t                           u8aw2wMaxPipeline, u8ar2rMaxPipeline, u8pfcMultiQuantum;
+    cy_stc_ethif_wrapper_config_t    *pstcWrapperConfig;
+    cy_stc_ethif_tsu_config_t        *pstcTSUConfig;
+    bool                              btxq0enable, btxq1enable, btxq2enable;
+    bool                              brxq0enable, brxq1enable, brxq2enable;
+    cy_ethif_buffpool_t              *pRxQbuffPool[3];
+} cy_stc_ethif_mac_config_t;
+
+typedef struct
+{
+    bool btsu_time_match, bwol_rx, blpi_ch_rx, btsu_sec_inc, bptp_tx_pdly_rsp, bptp_tx_pdly_req, bptp_rx_pdly_rsp;
+    bool bptp_rx_pdly_req, bptp_tx_sync, bptp_tx_dly_req, bptp_rx_sync, bptp_rx_dly_req, bext_intr, bpause_frame_tx;
+    bool bpause_time_zero, bpause_nz_qu_rx, bhresp_not_ok, brx_overrun, bpcs_link_change_det, btx_complete;
+    bool btx_fr_corrupt, btx_retry_ex_late_coll, btx_underrun, btx_used_read, brx_used_read, brx_complete, bman_frame;
+} cy_stc_ethif_intr_config_t;
+
+typedef void (*cy_ethif_rx_frame_cb_t)(ETH_Type *base, uint8_t *rx_buffer, uint32_t length);
+typedef void (*cy_ethif_tx_msg_cb_t)(ETH_Type *base, uint8_t queue);
+typedef void (*cy_ethif_rx_getbuffer_cb_t)(ETH_Type *base, uint8_t **rx_buffer, uint32_t *length);
+typedef void (*cy_ethif_tsu_inc_cb_t)(ETH_Type *base);
+
+typedef struct
+{
+    cy_ethif_rx_frame_cb_t     rxframecb;
+    cy_ethif_tx_msg_cb_t       txerrorcb;
+    cy_ethif_tx_msg_cb_t       txcompletecb;
+    cy_ethif_tsu_inc_cb_t      tsuSecondInccb;
+    cy_ethif_rx_getbuffer_cb_t rxgetbuff;
+} cy_stc_ethif_cb_t;
+
+cy_en_ethif_status_t Cy_ETHIF_Init(ETH_Type *base, cy_stc_ethif_mac_config_t *config, cy_stc_ethif_intr_config_t *intr);
+cy_en_ethif_status_t Cy_ETHIF_MdioInit(ETH_Type *base, cy_stc_ethif_mac_config_t *config);
+void Cy_ETHIF_RegisterCallbacks(ETH_Type *base, cy_stc_ethif_cb_t *callbacks);
+void Cy_ETHIF_DecodeEvent(ETH_Type *base);
+void Cy_ETHIF_SetPromiscuousMode(ETH_Type *base, bool enable);
+void Cy_ETHIF_SetNoBroadCast(ETH_Type *base, bool reject);
+cy_en_ethif_status_t Cy_ETHIF_SetFilterAddress(ETH_Type *base, cy_en_ethif_filter_num_t num, const cy_stc_ethif_filter_config_t *config);
+cy_en_ethif_status_t Cy_ETHIF_TransmitFrame(ETH_Type *base, uint8_t *buffer, uint16_t length, uint8_t queue, bool end_of_frame);
+uint32_t Cy_ETHIF_PhyRegRead(ETH_Type *base, uint8_t reg_addr, uint8_t phy_addr);
+void Cy_ETHIF_PhyRegWrite(ETH_Type *base, uint8_t reg_addr, uint16_t data, uint8_t phy_addr);
+
+#endif /* CY_ETHIF_H */
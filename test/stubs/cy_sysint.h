@@ -0,0 +1,90 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file cy_sysint.h
+* @brief Host stand-in for the interrupt, critical section, and core peripheral definitions of the PDL. The DWT cycle
+* counter is a plain variable; see test/README.md.
+*/
+
+#ifndef CY_SYSINT_H
+#define CY_SYSINT_H
+
+#include <stdint.h>
+
+typedef int IRQn_Type;
+typedef void (*cy_israddress)(void);
+
+typedef struct
+{
+    uint32_t intrSrc;
+    uint32_t intrPriority;
+} cy_stc_sysint_t;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type       test_dwt;
+extern CoreDebug_Type test_core_debug;
+extern uint32_t       SystemCoreClock;
+
+#define DWT                             (&test_dwt)
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL)
+#define CoreDebug                       (&test_core_debug)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24)
+
+#define __DMB()                         __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DSB()                         __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+int Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress handler);
+void NVIC_ClearPendingIRQ(IRQn_Type irqn);
+void NVIC_EnableIRQ(IRQn_Type irqn);
+void NVIC_DisableIRQ(IRQn_Type irqn);
+uint32_t Cy_SysLib_EnterCriticalSection(void);
+void Cy_SysLib_ExitCriticalSection(uint32_t state);
+void Cy_SysLib_DelayUs(uint16_t us);
+uint32_t Cy_SysClk_ClkPeriGetFrequency(void);
+uint32_t Cy_SysClk_ClkHfGetFrequency(uint32_t clk_hf);
+void SCB_CleanDCache_by_Addr(volatile void *addr, int32_t size);
+void SCB_InvalidateDCache_by_Addr(volatile void *addr, int32_t size);
+void SCB_CleanInvalidateDCache_by_Addr(volatile void *addr, int32_t size);
+
+#endif /* CY_SYSINT_H */
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file cyabs_rtos.h
+* @brief Host stand-in for the RTOS abstraction. The tests run on one thread: mutexes always succeed, semaphores are
+* counters, and the time only advances in cy_rtos_delay_milliseconds(); see test/README.md.
+*/
+
+#ifndef CYABS_RTOS_H
+#define CYABS_RTOS_H
+
+#include "cy_result.h"
+
+typedef struct { uint32_t count; } cy_mutex_t;
+typedef struct { uint32_t count; uint32_t max; } cy_semaphore_t;
+typedef struct { uint32_t bits; } cy_event_t;
+typedef void *cy_thread_t;
+typedef void *cy_thread_arg_t;
+typedef uint32_t cy_time_t;
+typedef void (*cy_thread_entry_fn_t)(cy_thread_arg_t arg);
+
+typedef enum
+{
+    CY_RTOS_PRIORITY_NORMAL = 3,
+    CY_RTOS_PRIORITY_ABOVENORMAL = 4,
+    CY_RTOS_PRIORITY_HIGH = 5
+} cy_thread_priority_t;
+
+#define CY_RTOS_NEVER_TIMEOUT           (0xFFFFFFFFUL)
+#define CY_RTOS_TIMEOUT                 (0x1u)
+
+extern cy_time_t test_rtos_time;
+
+cy_rslt_t cy_rtos_init_mutex2(cy_mutex_t *mutex, bool recursive);
+cy_rslt_t cy_rtos_get_mutex(cy_mutex_t *mutex, cy_time_t timeout_ms);
+cy_rslt_t cy_rtos_set_mutex(cy_mutex_t *mutex);
+cy_rslt_t cy_rtos_deinit_mutex(cy_mutex_t *mutex);
+cy_rslt_t cy_rtos_init_semaphore(cy_semaphore_t *semaphore, uint32_t maxcount, uint32_t initcount);
+cy_rslt_t cy_rtos_get_semaphore(cy_semaphore_t *semaphore, cy_time_t timeout_ms, bool in_isr);
+cy_rslt_t cy_rtos_set_semaphore(cy_semaphore_t *semaphore, bool in_isr);
+cy_rslt_t cy_rtos_deinit_semaphore(cy_semaphore_t *semaphore);
+cy_rslt_t cy_rtos_delay_milliseconds(cy_time_t num_ms);
+cy_rslt_t cy_rtos_get_time(cy_time_t *tval);
+
+#endif /* CYABS_RTOS_H */
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file cycfg.h
+* @brief Host stand-in for the generated device configuration: both Ethernet interfaces enabled; see test/README.md.
+*/
+
+#ifndef CYCFG_H
+#define CYCFG_H
+
+#define eth_0_ENABLED               (1u)
+#define eth_1_ENABLED               (1u)
+#define eth_0_INTRSRC_Q0            (1)
+#define eth_0_INTRSRC_Q1            (2)
+#define eth_0_INTRSRC_Q2            (3)
+#define eth_0_INTRPRIORITY          (3)
+#define eth_0_INTRMUXNUMBER         (3)
+#define eth_1_INTRSRC_Q0            (4)
+#define eth_1_INTRSRC_Q1            (5)
+#define eth_1_INTRSRC_Q2            (6)
+#define eth_1_INTRPRIORITY          (3)
+#define eth_1_INTRMUXNUMBER         (4)
+#define eth_0_MAC_CLOCK             (0)
+#define eth_1_MAC_CLOCK             (0)
+
+#endif /* CYCFG_H */
@@ -0,0 +1,343 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file test_stubs.c
+* @brief Host implementations of the PDL, RTOS, and network stack functions that the ECM sources call. The Ethernet
+* MAC and the PHY are simulated just enough for the host tests: transmitted frames and frames handed to the network
+* stack are recorded, and one PHY answers on the MDIO bus.
+*/
+
+#include <string.h>
+#include <stdarg.h>
+
+#include "test_stubs.h"
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+ETH_Type       test_eth0, test_eth1;
+DWT_Type       test_dwt;
+CoreDebug_Type test_core_debug;
+uint32_t       SystemCoreClock = 100000000UL;
+cy_time_t      test_rtos_time;
+
+uint8_t *pRx_Q_buff_pool[CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE];
+
+test_mac_t test_mac;
+test_phy_t test_phy;
+void (*test_decode_event_hook)(ETH_Type *base);
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+void test_stubs_reset(void)
+{
+    memset(&test_eth0, 0, sizeof(test_eth0));
+    memset(&test_eth1, 0, sizeof(test_eth1));
+    memset(&test_mac, 0, sizeof(test_mac));
+    memset(&test_phy, 0, sizeof(test_phy));
+    test_phy.addr = TEST_PHY_ADDR;
+    test_decode_event_hook = NULL;
+}
+
+void cy_log_msg(int facility, int level, const char *fmt, ...)
+{
+    (void)facility;
+    (void)level;
+    (void)fmt;
+}
+
+/* Ethernet PDL driver */
+cy_en_ethif_status_t Cy_ETHIF_Init(ETH_Type *base, cy_stc_ethif_mac_config_t *config, cy_stc_ethif_intr_config_t *intr)
+{
+    (void)base;
+    (void)config;
+    (void)intr;
+    return CY_ETHIF_SUCCESS;
+}
+
+cy_en_ethif_status_t Cy_ETHIF_MdioInit(ETH_Type *base, cy_stc_ethif_mac_config_t *config)
+{
+    (void)base;
+    (void)config;
+    return CY_ETHIF_SUCCESS;
+}
+
+void Cy_ETHIF_RegisterCallbacks(ETH_Type *base, cy_stc_ethif_cb_t *callbacks)
+{
+    (void)base;
+    (void)callbacks;
+}
+
+void Cy_ETHIF_DecodeEvent(ETH_Type *base)
+{
+    if(test_decode_event_hook != NULL)
+    {
+        test_decode_event_hook(base);
+    }
+}
+
+void Cy_ETHIF_SetPromiscuousMode(ETH_Type *base, bool enable)
+{
+    (void)base;
+    (void)enable;
+}
+
+void Cy_ETHIF_SetNoBroadCast(ETH_Type *base, bool reject)
+{
+    (void)base;
+    (void)reject;
+}
+
+cy_en_ethif_status_t Cy_ETHIF_SetFilterAddress(ETH_Type *base, cy_en_ethif_filter_num_t num, const cy_stc_ethif_filter_config_t *config)
+{
+    (void)base;
+    (void)num;
+    (void)config;
+    return CY_ETHIF_SUCCESS;
+}
+
+cy_en_ethif_status_t Cy_ETHIF_TransmitFrame(ETH_Type *base, uint8_t *buffer, uint16_t length, uint8_t queue, bool end_of_frame)
+{
+    (void)end_of_frame;
+
+    if(test_mac.tx_status != CY_ETHIF_SUCCESS)
+    {
+        return test_mac.tx_status;
+    }
+    test_mac.tx_base = base;
+    test_mac.tx_queue = queue;
+    test_mac.tx_length = length;
+    memcpy(test_mac.tx_frame, buffer, (length < sizeof(test_mac.tx_frame)) ? length : sizeof(test_mac.tx_frame));
+    test_mac.tx_count++;
+    return CY_ETHIF_SUCCESS;
+}
+
+/* One PHY answers at test_phy.addr; the other addresses read as all ones, as an undriven bus does */
+uint32_t Cy_ETHIF_PhyRegRead(ETH_Type *base, uint8_t reg_addr, uint8_t phy_addr)
+{
+    (void)base;
+
+    test_phy.bus_reads++;
+    if(phy_addr != test_phy.addr)
+    {
+        return 0xFFFFu;
+    }
+    test_phy.reg_reads[reg_addr & 31u]++;
+    return test_phy.reg[reg_addr & 31u];
+}
+
+void Cy_ETHIF_PhyRegWrite(ETH_Type *base, uint8_t reg_addr, uint16_t data, uint8_t phy_addr)
+{
+    (void)base;
+
+    test_phy.bus_writes++;
+    if(phy_addr == test_phy.addr)
+    {
+        test_phy.reg[reg_addr & 31u] = data;
+    }
+}
+
+/* Network stack */
+void cy_process_ethernet_data_cb(ETH_Type *eth_type, uint8_t *rx_buffer, uint32_t length)
+{
+    (void)eth_type;
+
+    test_mac.rx_length = length;
+    memcpy(test_mac.rx_frame, rx_buffer, (length < sizeof(test_mac.rx_frame)) ? length : sizeof(test_mac.rx_frame));
+    test_mac.rx_count++;
+}
+
+void cy_notify_ethernet_rx_data_cb(ETH_Type *base, uint8_t **u8RxBuffer, uint32_t *u32Length)
+{
+    (void)base;
+    *u8RxBuffer = NULL;
+    *u32Length = 0;
+}
+
+void cy_tx_complete_cb(ETH_Type *pstcEth, uint8_t u8QueueIndex)
+{
+    (void)pstcEth;
+    (void)u8QueueIndex;
+}
+
+void cy_tx_failure_cb(ETH_Type *pstcEth, uint8_t u8QueueIndex)
+{
+    (void)pstcEth;
+    (void)u8QueueIndex;
+}
+
+/* Interrupts and core peripherals; the tests run on one thread without interrupts */
+int Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress handler)
+{
+    (void)config;
+    (void)handler;
+    return 0;
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irqn)
+{
+    (void)irqn;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irqn)
+{
+    (void)irqn;
+}
+
+void NVIC_DisableIRQ(IRQn_Type irqn)
+{
+    (void)irqn;
+}
+
+uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    return 0;
+}
+
+void Cy_SysLib_ExitCriticalSection(uint32_t state)
+{
+    (void)state;
+}
+
+void Cy_SysLib_DelayUs(uint16_t us)
+{
+    (void)us;
+}
+
+uint32_t Cy_SysClk_ClkPeriGetFrequency(void)
+{
+    return SystemCoreClock;
+}
+
+uint32_t Cy_SysClk_ClkHfGetFrequency(uint32_t clk_hf)
+{
+    (void)clk_hf;
+    return SystemCoreClock;
+}
+
+void SCB_CleanDCache_by_Addr(volatile void *addr, int32_t size)
+{
+    (void)addr;
+    (void)size;
+}
+
+void SCB_InvalidateDCache_by_Addr(volatile void *addr, int32_t size)
+{
+    (void)addr;
+    (void)size;
+}
+
+void SCB_CleanInvalidateDCache_by_Addr(volatile void *addr, int32_t size)
+{
+    (void)addr;
+    (void)size;
+}
+
+/* RTOS abstraction */
+cy_rslt_t cy_rtos_init_mutex2(cy_mutex_t *mutex, bool recursive)
+{
+    (void)recursive;
+    mutex->count = 0;
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_rtos_get_mutex(cy_mutex_t *mutex, cy_time_t timeout_ms)
+{
+    (void)timeout_ms;
+    mutex->count++;
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_rtos_set_mutex(cy_mutex_t *mutex)
+{
+    mutex->count--;
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_rtos_deinit_mutex(cy_mutex_t *mutex)
+{
+    (void)mutex;
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_rtos_init_semaphore(cy_semaphore_t *semaphore, uint32_t maxcount, uint32_t initcount)
+{
+    semaphore->max = maxcount;
+    semaphore->count = initcount;
+    return CY_RSLT_SUCCESS;
+}
+
+/* Nothing else runs while the test waits, so an empty semaphore times out at once */
+cy_rslt_t cy_rtos_get_semaphore(cy_semaphore_t *semaphore, cy_time_t timeout_ms, bool in_isr)
+{
+    (void)in_isr;
+
+    if(semaphore->count == 0u)
+    {
+        test_rtos_time += (timeout_ms == CY_RTOS_NEVER_TIMEOUT) ? 0u : timeout_ms;
+        return CY_RTOS_TIMEOUT;
+    }
+    semaphore->count--;
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_rtos_set_semaphore(cy_semaphore_t *semaphore, bool in_isr)
+{
+    (void)in_isr;
+
+    if(semaphore->count < semaphore->max)
+    {
+        semaphore->count++;
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_rtos_deinit_semaphore(cy_semaphore_t *semaphore)
+{
+    (void)semaphore;
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_rtos_delay_milliseconds(cy_time_t num_ms)
+{
+    test_rtos_time += num_ms;
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_rtos_get_time(cy_time_t *tval)
+{
+    *tval = test_rtos_time;
+    return CY_RSLT_SUCCESS;
+}
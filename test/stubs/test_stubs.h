@@ -0,0 +1,83 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file test_stubs.h
+* @brief State of the simulated MAC and PHY of the host tests; see test_stubs.c.
+*/
+
+#ifndef TEST_STUBS_H
+#define TEST_STUBS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cy_ethif.h"
+#include "cy_sysint.h"
+#include "cyabs_rtos.h"
+
+#define TEST_PHY_ADDR               (1u)
+#define TEST_FRAME_MAX              (1536u)
+
+/* Last frame transmitted and last frame handed to the network stack */
+typedef struct
+{
+    cy_en_ethif_status_t tx_status;     /* Returned by Cy_ETHIF_TransmitFrame */
+    ETH_Type            *tx_base;
+    uint8_t              tx_queue;
+    uint32_t             tx_length;
+    uint8_t              tx_frame[TEST_FRAME_MAX];
+    uint32_t             tx_count;
+    uint32_t             rx_length;
+    uint8_t              rx_frame[TEST_FRAME_MAX];
+    uint32_t             rx_count;
+} test_mac_t;
+
+/* Clause 22 register file of the PHY on the MDIO bus, with the frames seen on the bus */
+typedef struct
+{
+    uint8_t  addr;
+    uint16_t reg[32];
+    uint32_t reg_reads[32];
+    uint32_t bus_reads;
+    uint32_t bus_writes;
+} test_phy_t;
+
+extern test_mac_t test_mac;
+extern test_phy_t test_phy;
+/* Called by Cy_ETHIF_DecodeEvent() in place of the interrupt decoding of the PDL */
+extern void (*test_decode_event_hook)(ETH_Type *base);
+
+void test_stubs_reset(void);
+
+#endif /* TEST_STUBS_H */
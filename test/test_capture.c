@@ -0,0 +1,251 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file test_capture.c
+* @brief Host tests of the capture filter validator and interpreter and of the capture ring of cy_ecm_capture.c, with
+* the cost of a filter run and of a captured frame.
+*/
+
+#include <string.h>
+
+#include "ecm_test.h"
+#include "eth_internal.h"
+
+/* tcpdump -dd "ip and tcp dst port 80" */
+static const cy_ecm_capture_insn_t filter_tcp_80[] =
+{
+    { 0x28, 0, 0, 0x0000000C },     /* ldh [12]                 */
+    { 0x15, 0, 8, 0x00000800 },     /* jeq #0x800               */
+    { 0x30, 0, 0, 0x00000017 },     /* ldb [23]                 */
+    { 0x15, 0, 6, 0x00000006 },     /* jeq #6                   */
+    { 0x28, 0, 0, 0x00000014 },     /* ldh [20]                 */
+    { 0x45, 4, 0, 0x00001FFF },     /* jset #0x1fff             */
+    { 0xB1, 0, 0, 0x0000000E },     /* ldxb 4*([14]&0xf)        */
+    { 0x48, 0, 0, 0x00000010 },     /* ldh [x + 16]             */
+    { 0x15, 0, 1, 0x00000050 },     /* jeq #80                  */
+    { 0x06, 0, 0, 0x00040000 },     /* ret #262144              */
+    { 0x06, 0, 0, 0x00000000 },     /* ret #0                   */
+};
+
+#define FILTER_LEN(f)               ((uint32_t)(sizeof(f) / sizeof((f)[0])))
+
+/* Ethernet, IPv4 without options, and TCP headers */
+static void make_tcp_frame(uint8_t *frame, uint16_t ethertype, uint8_t protocol, uint16_t dst_port)
+{
+    memset(frame, 0, 54);
+    memset(frame, 0xFF, 6);
+    frame[12] = (uint8_t)(ethertype >> 8);
+    frame[13] = (uint8_t)ethertype;
+    frame[14] = 0x45;
+    frame[23] = protocol;
+    frame[36] = (uint8_t)(dst_port >> 8);
+    frame[37] = (uint8_t)dst_port;
+}
+
+static void test_filter_validate(void)
+{
+    const cy_ecm_capture_insn_t no_return[]     = { { 0x28, 0, 0, 12 } };
+    const cy_ecm_capture_insn_t jump_past_end[] = { { 0x15, 1, 0, 0 }, { 0x06, 0, 0, 0 } };
+    const cy_ecm_capture_insn_t ja_past_end[]   = { { 0x05, 0, 0, 1 }, { 0x06, 0, 0, 0 } };
+    const cy_ecm_capture_insn_t ld_mem_range[]  = { { 0x60, 0, 0, 16 }, { 0x16, 0, 0, 0 } };
+    const cy_ecm_capture_insn_t st_range[]      = { { 0x02, 0, 0, 16 }, { 0x16, 0, 0, 0 } };
+    const cy_ecm_capture_insn_t div_by_zero[]   = { { 0x34, 0, 0, 0 }, { 0x16, 0, 0, 0 } };
+    const cy_ecm_capture_insn_t ret_x[]         = { { 0x0E, 0, 0, 0 } };
+    const cy_ecm_capture_insn_t bad_misc[]      = { { 0x17, 0, 0, 0 }, { 0x06, 0, 0, 0 } };
+    const cy_ecm_capture_insn_t div_by_x[]      = { { 0x3C, 0, 0, 0 }, { 0x16, 0, 0, 0 } };
+
+    TEST_CHECK(cy_eth_filter_validate(filter_tcp_80, FILTER_LEN(filter_tcp_80)));
+    TEST_CHECK(cy_eth_filter_validate(div_by_x, FILTER_LEN(div_by_x)));
+
+    TEST_CHECK(!cy_eth_filter_validate(filter_tcp_80, 0));
+    TEST_CHECK(!cy_eth_filter_validate(filter_tcp_80, FILTER_LEN(filter_tcp_80) - 1u));
+    TEST_CHECK(!cy_eth_filter_validate(no_return, FILTER_LEN(no_return)));
+    TEST_CHECK(!cy_eth_filter_validate(jump_past_end, FILTER_LEN(jump_past_end)));
+    TEST_CHECK(!cy_eth_filter_validate(ja_past_end, FILTER_LEN(ja_past_end)));
+    TEST_CHECK(!cy_eth_filter_validate(ld_mem_range, FILTER_LEN(ld_mem_range)));
+    TEST_CHECK(!cy_eth_filter_validate(st_range, FILTER_LEN(st_range)));
+    TEST_CHECK(!cy_eth_filter_validate(div_by_zero, FILTER_LEN(div_by_zero)));
+    TEST_CHECK(!cy_eth_filter_validate(ret_x, FILTER_LEN(ret_x)));
+    TEST_CHECK(!cy_eth_filter_validate(bad_misc, FILTER_LEN(bad_misc)));
+}
+
+static void test_filter_run(void)
+{
+    /* ld #5; st M[3]; ld #0; ld M[3]; ret a */
+    const cy_ecm_capture_insn_t scratch[]  = { { 0x00, 0, 0, 5 }, { 0x02, 0, 0, 3 }, { 0x00, 0, 0, 0 }, { 0x60, 0, 0, 3 }, { 0x16, 0, 0, 0 } };
+    /* ld len; ret a */
+    const cy_ecm_capture_insn_t length[]   = { { 0x80, 0, 0, 0 }, { 0x16, 0, 0, 0 } };
+    /* ldx #0; ld #1; div x; ret #1 */
+    const cy_ecm_capture_insn_t div_by_x[] = { { 0x01, 0, 0, 0 }, { 0x00, 0, 0, 1 }, { 0x3C, 0, 0, 0 }, { 0x06, 0, 0, 1 } };
+    uint8_t frame[54];
+
+    make_tcp_frame(frame, 0x0800, 6, 80);
+    TEST_CHECK_EQ(cy_eth_filter_run(filter_tcp_80, frame, sizeof(frame)), 0x40000);
+
+    make_tcp_frame(frame, 0x0800, 6, 81);
+    TEST_CHECK_EQ(cy_eth_filter_run(filter_tcp_80, frame, sizeof(frame)), 0);
+
+    make_tcp_frame(frame, 0x0800, 17, 80);
+    TEST_CHECK_EQ(cy_eth_filter_run(filter_tcp_80, frame, sizeof(frame)), 0);
+
+    make_tcp_frame(frame, 0x0806, 6, 80);
+    TEST_CHECK_EQ(cy_eth_filter_run(filter_tcp_80, frame, sizeof(frame)), 0);
+
+    /* A fragment is rejected before its ports are read */
+    make_tcp_frame(frame, 0x0800, 6, 80);
+    frame[21] = 0x10;
+    TEST_CHECK_EQ(cy_eth_filter_run(filter_tcp_80, frame, sizeof(frame)), 0);
+
+    /* A load past the end of the frame rejects it */
+    make_tcp_frame(frame, 0x0800, 6, 80);
+    TEST_CHECK_EQ(cy_eth_filter_run(filter_tcp_80, frame, 37), 0);
+
+    TEST_CHECK_EQ(cy_eth_filter_run(scratch, frame, sizeof(frame)), 5);
+    TEST_CHECK_EQ(cy_eth_filter_run(length, frame, sizeof(frame)), sizeof(frame));
+    TEST_CHECK_EQ(cy_eth_filter_run(div_by_x, frame, sizeof(frame)), 0);
+}
+
+static void test_capture_ring(void)
+{
+    const cy_ecm_capture_insn_t accept_all[] = { { 0x06, 0, 0, 0x00040000 } };
+    cy_ecm_capture_config_t config = { .filter = filter_tcp_80, .filter_len = FILTER_LEN(filter_tcp_80), .snap_len = 40 };
+    cy_ecm_capture_stats_t stats;
+    static uint8_t buffer[CY_ECM_CAPTURE_RING_SIZE + 24u];
+    uint8_t frame[54];
+    uint32_t length, frames;
+
+    TEST_CHECK_EQ(cy_eth_capture_start(CY_ECM_INTERFACE_ETH0, &config), CY_RSLT_SUCCESS);
+    make_tcp_frame(frame, 0x0800, 6, 80);
+    cy_eth_capture_frame(frame, sizeof(frame));
+    make_tcp_frame(frame, 0x0806, 6, 80);
+    cy_eth_capture_frame(frame, sizeof(frame));
+
+    cy_eth_capture_get_stats(CY_ECM_INTERFACE_ETH0, &stats);
+    TEST_CHECK(stats.is_running);
+    TEST_CHECK_EQ(stats.frames_matched, 1);
+    TEST_CHECK_EQ(stats.frames_rejected, 1);
+    TEST_CHECK_EQ(stats.bytes_pending, 16 + 40);
+
+    /* File header, then the record cut at the snap length */
+    length = cy_eth_capture_read(CY_ECM_INTERFACE_ETH0, buffer, sizeof(buffer));
+    TEST_CHECK_EQ(length, 24 + 16 + 40);
+    TEST_CHECK_EQ(buffer[16], 40);
+    TEST_CHECK_EQ(buffer[24 + 8], 40);
+    TEST_CHECK_EQ(buffer[24 + 12], sizeof(frame));
+    TEST_CHECK_EQ(buffer[24 + 16 + 13], 0x00);
+    TEST_CHECK_EQ(buffer[24 + 16 + 12], 0x08);
+    TEST_CHECK_EQ(cy_eth_capture_read(CY_ECM_INTERFACE_ETH0, buffer, sizeof(buffer)), 0);
+
+    /* A restart switches to the other program; the frames rejected so far are taken */
+    config.filter = accept_all;
+    config.filter_len = FILTER_LEN(accept_all);
+    config.snap_len = 0;
+    TEST_CHECK_EQ(cy_eth_capture_start(CY_ECM_INTERFACE_ETH0, &config), CY_RSLT_SUCCESS);
+    cy_eth_capture_frame(frame, sizeof(frame));
+    cy_eth_capture_get_stats(CY_ECM_INTERFACE_ETH0, &stats);
+    TEST_CHECK_EQ(stats.frames_matched, 1);
+    TEST_CHECK_EQ(stats.frames_rejected, 0);
+    TEST_CHECK_EQ(stats.bytes_pending, 16 + 56);
+
+    /* And back to the first one */
+    config.filter = filter_tcp_80;
+    config.filter_len = FILTER_LEN(filter_tcp_80);
+    TEST_CHECK_EQ(cy_eth_capture_start(CY_ECM_INTERFACE_ETH0, &config), CY_RSLT_SUCCESS);
+    cy_eth_capture_frame(frame, sizeof(frame));
+    cy_eth_capture_get_stats(CY_ECM_INTERFACE_ETH0, &stats);
+    TEST_CHECK_EQ(stats.frames_matched, 0);
+    TEST_CHECK_EQ(stats.bytes_pending, 0);
+
+    /* The ring fills up, then takes new records as the old ones are read across its end */
+    config.filter = NULL;
+    config.filter_len = 0;
+    TEST_CHECK_EQ(cy_eth_capture_start(CY_ECM_INTERFACE_ETH0, &config), CY_RSLT_SUCCESS);
+    frames = CY_ECM_CAPTURE_RING_SIZE / (16u + 56u);
+    for(uint32_t i = 0; i <= frames; i++)
+    {
+        cy_eth_capture_frame(frame, sizeof(frame));
+    }
+    cy_eth_capture_get_stats(CY_ECM_INTERFACE_ETH0, &stats);
+    TEST_CHECK_EQ(stats.frames_matched, frames + 1u);
+    TEST_CHECK_EQ(stats.frames_dropped, 1);
+    TEST_CHECK_EQ(cy_eth_capture_read(CY_ECM_INTERFACE_ETH0, buffer, 24 + 2 * (16 + 54)), 24 + 2 * (16 + 54));
+    cy_eth_capture_frame(frame, sizeof(frame));
+    cy_eth_capture_get_stats(CY_ECM_INTERFACE_ETH0, &stats);
+    TEST_CHECK_EQ(stats.frames_dropped, 1);
+    TEST_CHECK_EQ(cy_eth_capture_read(CY_ECM_INTERFACE_ETH0, buffer, sizeof(buffer)), (frames - 1u) * (16u + 54u));
+    TEST_CHECK_EQ(buffer[(frames - 2u) * (16u + 54u) + 8u], 54);
+
+    cy_eth_capture_stop(CY_ECM_INTERFACE_ETH0);
+    cy_eth_capture_get_stats(CY_ECM_INTERFACE_ETH0, &stats);
+    TEST_CHECK(!stats.is_running);
+}
+
+static void test_filter_bench(void)
+{
+    uint8_t match[54], other[54];
+    volatile uint32_t sink = 0;
+
+    make_tcp_frame(match, 0x0800, 6, 80);
+    make_tcp_frame(other, 0x0806, 0, 0);
+
+    TEST_BENCH("filter tcp dst port 80, match (10 insns)", sink += cy_eth_filter_run(filter_tcp_80, match, sizeof(match)));
+    TEST_BENCH("filter tcp dst port 80, ARP (3 insns)", sink += cy_eth_filter_run(filter_tcp_80, other, sizeof(other)));
+    TEST_BENCH("filter validate (11 insns)", sink += cy_eth_filter_validate(filter_tcp_80, FILTER_LEN(filter_tcp_80)));
+    (void)sink;
+}
+
+static void test_capture_bench(void)
+{
+    cy_ecm_capture_config_t config = { .filter = filter_tcp_80, .filter_len = FILTER_LEN(filter_tcp_80), .snap_len = 0 };
+    static uint8_t buffer[CY_ECM_CAPTURE_RING_SIZE + 24u];
+    uint8_t match[54], other[54];
+
+    make_tcp_frame(match, 0x0800, 6, 80);
+    make_tcp_frame(other, 0x0806, 0, 0);
+
+    (void)cy_eth_capture_start(CY_ECM_INTERFACE_ETH0, &config);
+    TEST_BENCH("capture frame, rejected", cy_eth_capture_frame(other, sizeof(other)));
+    TEST_BENCH("capture frame, 54 bytes captured and read",
+               cy_eth_capture_frame(match, sizeof(match)); (void)cy_eth_capture_read(CY_ECM_INTERFACE_ETH0, buffer, sizeof(buffer)));
+    cy_eth_capture_stop(CY_ECM_INTERFACE_ETH0);
+}
+
+void test_capture_run(void)
+{
+    test_filter_validate();
+    test_filter_run();
+    test_capture_ring();
+    test_filter_bench();
+    test_capture_bench();
+}
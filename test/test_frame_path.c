@@ -0,0 +1,980 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file test_frame_path.c
+* @brief Host tests of the receive and raw send paths of eth_internal.c: VLAN policing and stripping, DSCP and 802.1p
+* classification, raw frame dispatch, the polled mode, the interrupt moderation, the Tx halt of the DMA fallback, and
+* the storm control, with the cost of each step. The source is included so that its static functions and state can be
+* reached.
+*/
+
+#include "eth_internal.c"
+
+#include "ecm_test.h"
+#include "test_stubs.h"
+
+#define TEST_ETHERTYPE_RAW          (0x88B5u)     /* IEEE 802 local experimental */
+#define TEST_ETHERTYPE_RAW2         (0x88B6u)
+#define TEST_FRAME_LEN              (64u)
+#define TEST_POLL_BUDGET            (8u)
+#define TEST_POLL_RUNS              (100000u)
+#define TEST_PCP_HIGH               (5u)
+#define TEST_PCP_BURST              (16u)         /* Four rings of 4 descriptors; every fourth frame has TEST_PCP_HIGH */
+#define TEST_PCP_BURSTS             (10000u)
+
+static uint32_t raw_rx_count;
+static uint32_t raw_rx_length;
+static void    *raw_rx_ctx;
+
+/* An untagged frame to this interface, or a frame with the tag of vlan_id and pcp if vlan_id is not CY_ECM_VLAN_ID_ANY */
+static uint32_t make_frame(uint8_t *frame, uint16_t vlan_id, uint8_t pcp, uint16_t ethertype)
+{
+    uint32_t offset = 12;
+
+    memset(frame, 0, TEST_FRAME_LEN);
+    frame[0] = 0x02;
+    frame[5] = 0x01;
+    frame[6] = 0x02;
+    frame[11] = 0x02;
+    if(vlan_id != CY_ECM_VLAN_ID_ANY)
+    {
+        frame[offset++] = 0x81;
+        frame[offset++] = 0x00;
+        frame[offset++] = (uint8_t)((pcp << 5) | (vlan_id >> 8));
+        frame[offset++] = (uint8_t)vlan_id;
+    }
+    frame[offset++] = (uint8_t)(ethertype >> 8);
+    frame[offset++] = (uint8_t)ethertype;
+    for(uint32_t i = offset; i < TEST_FRAME_LEN; i++)
+    {
+        frame[i] = (uint8_t)i;
+    }
+    return TEST_FRAME_LEN;
+}
+
+/* An IPv4 or IPv6 frame with the given DSCP */
+static uint32_t make_ip_frame(uint8_t *frame, uint16_t vlan_id, uint16_t ethertype, uint8_t dscp)
+{
+    uint32_t offset = (vlan_id != CY_ECM_VLAN_ID_ANY) ? 18u : 14u;
+
+    (void)make_frame(frame, vlan_id, 0, ethertype);
+    if(ethertype == ETH_ETHERTYPE_IPV4)
+    {
+        frame[offset] = 0x45;
+        frame[offset + 1u] = (uint8_t)(dscp << 2);
+    }
+    else
+    {
+        frame[offset] = (uint8_t)(0x60u | (dscp >> 2));
+        frame[offset + 1u] = (uint8_t)(dscp << 6);
+    }
+    return TEST_FRAME_LEN;
+}
+
+static void raw_rx_cb(cy_ecm_t ecm_handle, const uint8_t *frame, uint32_t length, void *ctx)
+{
+    (void)ecm_handle;
+    (void)frame;
+
+    raw_rx_count++;
+    raw_rx_length = length;
+    raw_rx_ctx = ctx;
+}
+
+/* Receives a frame as the PDL does, and hands its buffer back to the DMA if ECM dropped it */
+static bool receive(uint8_t *frame, uint32_t length)
+{
+    uint32_t delivered = test_mac.rx_count;
+
+    eth_rx_frame_cb(ETH0, frame, length);
+    eth_rx_recycled[CY_ECM_INTERFACE_ETH0] = NULL;
+    return test_mac.rx_count != delivered;
+}
+
+static void frame_path_reset(void)
+{
+    test_stubs_reset();
+    cy_eth_vlan_init(CY_ECM_INTERFACE_ETH0);
+    cy_eth_priority_init(CY_ECM_INTERFACE_ETH0);
+    cy_eth_raw_unregister_all(CY_ECM_INTERFACE_ETH0);
+    memset(eth_raw_stats, 0, sizeof(eth_raw_stats));
+    raw_rx_count = 0;
+}
+
+static void test_vlan(void)
+{
+    const cy_ecm_vlan_config_t config = { .pvid = 10, .filter = true, .strip_rx = true, .tag_tx = true };
+    const cy_ecm_vlan_config_t tagged_only = { .pvid = CY_ECM_VLAN_ID_NONE, .filter = true };
+    uint8_t frame[TEST_FRAME_LEN], expected[TEST_FRAME_LEN];
+    uint32_t length;
+
+    frame_path_reset();
+    cy_eth_set_vlan_config(CY_ECM_INTERFACE_ETH0, &config);
+    cy_eth_set_vlan_member(CY_ECM_INTERFACE_ETH0, 20, true);
+    TEST_CHECK_EQ(eth_vlan[CY_ECM_INTERFACE_ETH0].member_count, 1);
+    TEST_CHECK((ETH0->NETWORK_CONFIG & ETH_NETWORK_CONFIG_DISCARD_NON_VLAN) == 0u);
+
+    /* Untagged and priority tagged frames belong to the port VLAN */
+    length = make_frame(frame, CY_ECM_VLAN_ID_ANY, 0, ETH_ETHERTYPE_IPV4);
+    TEST_CHECK(!eth_vlan_police(CY_ECM_INTERFACE_ETH0, frame, length));
+    length = make_frame(frame, CY_ECM_VLAN_ID_NONE, 3, ETH_ETHERTYPE_IPV4);
+    TEST_CHECK(!eth_vlan_police(CY_ECM_INTERFACE_ETH0, frame, length));
+    length = make_frame(frame, 10, 0, ETH_ETHERTYPE_IPV4);
+    TEST_CHECK(!eth_vlan_police(CY_ECM_INTERFACE_ETH0, frame, length));
+    length = make_frame(frame, 20, 0, ETH_ETHERTYPE_IPV4);
+    TEST_CHECK(!eth_vlan_police(CY_ECM_INTERFACE_ETH0, frame, length));
+    length = make_frame(frame, 30, 0, ETH_ETHERTYPE_IPV4);
+    TEST_CHECK(eth_vlan_police(CY_ECM_INTERFACE_ETH0, frame, length));
+    TEST_CHECK_EQ(eth_vlan[CY_ECM_INTERFACE_ETH0].rx_dropped, 1);
+
+    /* The tag is removed by moving the payload; the addresses stay in place */
+    length = make_frame(frame, 10, 5, ETH_ETHERTYPE_IPV4);
+    (void)make_frame(expected, CY_ECM_VLAN_ID_ANY, 0, ETH_ETHERTYPE_IPV4);
+    memmove(&expected[14], &frame[18], TEST_FRAME_LEN - 18u);
+    TEST_CHECK_EQ(eth_vlan_strip(CY_ECM_INTERFACE_ETH0, frame, length), TEST_FRAME_LEN - 4u);
+    TEST_CHECK(memcmp(frame, expected, TEST_FRAME_LEN - 4u) == 0);
+    length = make_frame(frame, CY_ECM_VLAN_ID_ANY, 0, ETH_ETHERTYPE_IPV4);
+    TEST_CHECK_EQ(eth_vlan_strip(CY_ECM_INTERFACE_ETH0, frame, length), TEST_FRAME_LEN);
+    TEST_CHECK_EQ(eth_vlan[CY_ECM_INTERFACE_ETH0].rx_stripped, 1);
+
+    /* Receive path: a frame of another VLAN never reaches the network stack */
+    length = make_frame(frame, 30, 0, ETH_ETHERTYPE_IPV4);
+    TEST_CHECK(!receive(frame, length));
+    length = make_frame(frame, 10, 0, ETH_ETHERTYPE_IPV4);
+    TEST_CHECK(receive(frame, length));
+    TEST_CHECK_EQ(test_mac.rx_length, TEST_FRAME_LEN - 4u);
+    TEST_CHECK_EQ(test_mac.rx_frame[12], 0x08);
+
+    /* A frame of another member VLAN reaches its raw frame handler with its tag, and not the network stack */
+    TEST_CHECK_EQ(cy_eth_raw_register(CY_ECM_INTERFACE_ETH0, ETH_ETHERTYPE_IPV4, 20, raw_rx_cb, NULL, NULL), CY_RSLT_SUCCESS);
+    length = make_frame(frame, 20, 0, ETH_ETHERTYPE_IPV4);
+    TEST_CHECK(!receive(frame, length));
+    TEST_CHECK_EQ(raw_rx_count, 1);
+    TEST_CHECK_EQ(raw_rx_length, TEST_FRAME_LEN);
+    TEST_CHECK_EQ(frame[12], 0x81);
+    TEST_CHECK_EQ(eth_vlan[CY_ECM_INTERFACE_ETH0].rx_raw_only, 1);
+    TEST_CHECK_EQ(eth_vlan[CY_ECM_INTERFACE_ETH0].rx_stripped, 2);
+
+    /* Priority tagged frames are in the port VLAN */
+    length = make_frame(frame, CY_ECM_VLAN_ID_NONE, 3, ETH_ETHERTYPE_IPV4);
+    TEST_CHECK(receive(frame, length));
+    TEST_CHECK_EQ(test_mac.rx_length, TEST_FRAME_LEN - 4u);
+    cy_eth_raw_unregister_all(CY_ECM_INTERFACE_ETH0);
+
+    /* An untagged raw frame is sent with the port VLAN tag */
+    length = make_frame(frame, CY_ECM_VLAN_ID_ANY, 0, TEST_ETHERTYPE_RAW);
+    TEST_CHECK_EQ(cy_eth_raw_send(CY_ECM_INTERFACE_ETH0, frame, length, 0, 4), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(test_mac.tx_length, TEST_FRAME_LEN + 4u);
+    TEST_CHECK_EQ(test_mac.tx_frame[12], 0x81);
+    TEST_CHECK_EQ(test_mac.tx_frame[14], (4u << 5));
+    TEST_CHECK_EQ(test_mac.tx_frame[15], 10);
+    TEST_CHECK(memcmp(&test_mac.tx_frame[16], &frame[12], TEST_FRAME_LEN - 12u) == 0);
+    TEST_CHECK_EQ(eth_vlan[CY_ECM_INTERFACE_ETH0].tx_tagged, 1);
+
+    /* Without a port VLAN, the MAC discards the untagged frames */
+    cy_eth_set_vlan_config(CY_ECM_INTERFACE_ETH0, &tagged_only);
+    TEST_CHECK((ETH0->NETWORK_CONFIG & ETH_NETWORK_CONFIG_DISCARD_NON_VLAN) != 0u);
+    length = make_frame(frame, CY_ECM_VLAN_ID_ANY, 0, ETH_ETHERTYPE_IPV4);
+    TEST_CHECK(eth_vlan_police(CY_ECM_INTERFACE_ETH0, frame, length));
+    cy_eth_vlan_init(CY_ECM_INTERFACE_ETH0);
+    TEST_CHECK((ETH0->NETWORK_CONFIG & ETH_NETWORK_CONFIG_DISCARD_NON_VLAN) == 0u);
+}
+
+static void test_vlan_bench(void)
+{
+    const cy_ecm_vlan_config_t config = { .pvid = 10, .filter = true, .strip_rx = true };
+    uint8_t member[TEST_FRAME_LEN], other[TEST_FRAME_LEN], untagged[TEST_FRAME_LEN];
+    volatile uint32_t sink = 0;
+
+    frame_path_reset();
+    cy_eth_set_vlan_config(CY_ECM_INTERFACE_ETH0, &config);
+    cy_eth_set_vlan_member(CY_ECM_INTERFACE_ETH0, 20, true);
+    (void)make_frame(member, 20, 0, ETH_ETHERTYPE_IPV4);
+    (void)make_frame(other, 30, 0, ETH_ETHERTYPE_IPV4);
+    (void)make_frame(untagged, CY_ECM_VLAN_ID_ANY, 0, ETH_ETHERTYPE_IPV4);
+
+    TEST_BENCH("vlan police, member VLAN", sink += eth_vlan_police(CY_ECM_INTERFACE_ETH0, member, TEST_FRAME_LEN));
+    TEST_BENCH("vlan police, other VLAN", sink += eth_vlan_police(CY_ECM_INTERFACE_ETH0, other, TEST_FRAME_LEN));
+    TEST_BENCH("vlan strip, 64-byte frame",
+               { member[12] = 0x81; member[13] = 0x00; sink += eth_vlan_strip(CY_ECM_INTERFACE_ETH0, member, TEST_FRAME_LEN); });
+    TEST_BENCH("rx path, untagged, VLAN filter on", sink += receive(untagged, TEST_FRAME_LEN));
+    (void)sink;
+}
+
+static void test_priority(void)
+{
+    cy_ecm_priority_map_t map;
+    const cy_ecm_vlan_config_t config = { .pvid = 10, .tag_tx = true };
+    volatile uint32_t *screener = ETH0->SCREENING_TYPE_2_REGISTER_0;
+    uint8_t frame[TEST_FRAME_LEN];
+    uint32_t length;
+
+    frame_path_reset();
+
+    /* DSCP 46 (expedited forwarding) is class selector 5; DSCP 8 (CS1) is 1 */
+    length = make_ip_frame(frame, CY_ECM_VLAN_ID_ANY, ETH_ETHERTYPE_IPV4, 46);
+    TEST_CHECK_EQ(eth_dscp_priority(frame, length), 5);
+    length = make_ip_frame(frame, CY_ECM_VLAN_ID_ANY, ETH_ETHERTYPE_IPV4, 8);
+    TEST_CHECK_EQ(eth_dscp_priority(frame, length), 1);
+    length = make_ip_frame(frame, CY_ECM_VLAN_ID_ANY, ETH_ETHERTYPE_IPV6, 46);
+    TEST_CHECK_EQ(eth_dscp_priority(frame, length), 5);
+    length = make_ip_frame(frame, CY_ECM_VLAN_ID_ANY, ETH_ETHERTYPE_IPV6, 56);
+    TEST_CHECK_EQ(eth_dscp_priority(frame, length), 7);
+    length = make_ip_frame(frame, 10, ETH_ETHERTYPE_IPV4, 46);
+    TEST_CHECK_EQ(eth_dscp_priority(frame, length), 5);
+    length = make_frame(frame, CY_ECM_VLAN_ID_ANY, 0, 0x0806);
+    TEST_CHECK_EQ(eth_dscp_priority(frame, length), 0);
+    length = make_ip_frame(frame, CY_ECM_VLAN_ID_ANY, ETH_ETHERTYPE_IPV4, 46);
+    TEST_CHECK_EQ(eth_dscp_priority(frame, 15), 0);
+
+    /* Default map: every priority on queue 0 with its own priority code point; no screener in use */
+    cy_eth_get_priority_map(CY_ECM_INTERFACE_ETH0, &map);
+    TEST_CHECK_EQ(map.tx_pcp[6], 6);
+    TEST_CHECK_EQ(screener[0], 0);
+
+    /* Priority 5 to the queues 1, with the priority code point 6 */
+    map.rx_queue[5] = 1;
+    map.tx_queue[5] = 1;
+    map.tx_pcp[5] = 6;
+    TEST_CHECK_EQ(cy_eth_set_priority_map(CY_ECM_INTERFACE_ETH0, &map), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(screener[0], 1u | (5u << ETH_SCREENING_TYPE_2_VLAN_PRIORITY_POS) | ETH_SCREENING_TYPE_2_VLAN_ENABLE);
+    TEST_CHECK_EQ(screener[1], 0);
+
+    /* Queues that are not enabled, or do not exist, are rejected and leave the map unchanged */
+    map.rx_queue[2] = 3;
+    TEST_CHECK_EQ(cy_eth_set_priority_map(CY_ECM_INTERFACE_ETH0, &map), CY_RSLT_MODULE_ECM_BADARG);
+    map.rx_queue[2] = 0;
+    map.tx_pcp[2] = CY_ECM_PRIORITY_COUNT;
+    TEST_CHECK_EQ(cy_eth_set_priority_map(CY_ECM_INTERFACE_ETH0, &map), CY_RSLT_MODULE_ECM_BADARG);
+    map.tx_pcp[2] = 2;
+    TEST_CHECK_EQ(cy_eth_set_priority_map(CY_ECM_INTERFACE_ETH1, &map), CY_RSLT_MODULE_ECM_BADARG);
+    cy_eth_get_priority_map(CY_ECM_INTERFACE_ETH0, &map);
+    TEST_CHECK_EQ(map.tx_pcp[5], 6);
+
+    /* The DSCP picks the Tx queue and the priority code point of the inserted tag */
+    cy_eth_set_vlan_config(CY_ECM_INTERFACE_ETH0, &config);
+    length = make_ip_frame(frame, CY_ECM_VLAN_ID_ANY, ETH_ETHERTYPE_IPV4, 46);
+    TEST_CHECK_EQ(cy_eth_raw_send_priority(CY_ECM_INTERFACE_ETH0, frame, length, CY_ECM_PRIORITY_DSCP), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(test_mac.tx_queue, 1);
+    TEST_CHECK_EQ(test_mac.tx_frame[14], (6u << 5));
+    TEST_CHECK_EQ(test_mac.tx_frame[15], 10);
+
+    /* The priority code point of a tagged frame is replaced; its VLAN ID is kept */
+    length = make_frame(frame, 0x123, 1, TEST_ETHERTYPE_RAW);
+    TEST_CHECK_EQ(cy_eth_raw_send_priority(CY_ECM_INTERFACE_ETH0, frame, length, 5), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(test_mac.tx_length, TEST_FRAME_LEN);
+    TEST_CHECK_EQ(test_mac.tx_frame[14], (6u << 5) | 0x01u);
+    TEST_CHECK_EQ(test_mac.tx_frame[15], 0x23);
+    TEST_CHECK_EQ(frame[14], (1u << 5) | 0x01u);
+
+    length = make_frame(frame, CY_ECM_VLAN_ID_ANY, 0, TEST_ETHERTYPE_RAW);
+    TEST_CHECK_EQ(cy_eth_raw_send_priority(CY_ECM_INTERFACE_ETH0, frame, length, 3), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(test_mac.tx_queue, 0);
+    TEST_CHECK_EQ(test_mac.tx_frame[14], (3u << 5));
+}
+
+static void test_priority_bench(void)
+{
+    uint8_t ipv4[TEST_FRAME_LEN], ipv6_tagged[TEST_FRAME_LEN];
+    volatile uint32_t sink = 0;
+
+    (void)make_ip_frame(ipv4, CY_ECM_VLAN_ID_ANY, ETH_ETHERTYPE_IPV4, 46);
+    (void)make_ip_frame(ipv6_tagged, 10, ETH_ETHERTYPE_IPV6, 46);
+
+    TEST_BENCH("dscp priority, IPv4", sink += eth_dscp_priority(ipv4, TEST_FRAME_LEN));
+    TEST_BENCH("dscp priority, tagged IPv6", sink += eth_dscp_priority(ipv6_tagged, TEST_FRAME_LEN));
+    (void)sink;
+}
+
+/* Delivery of the frames of one priority code point over a run of bursts */
+typedef struct
+{
+    uint32_t received;
+    uint32_t dropped;                             /* No free descriptor in the Rx ring of the queue */
+    uint32_t delivered;
+    uint32_t max_ahead;                           /* Frames of other priorities handled before, in the same interrupt */
+    uint64_t total_ns;                            /* From the start of the interrupt to the delivery */
+} pcp_stats_t;
+
+/* Rx rings of the MAC: the priority code points of the frames waiting in each queue */
+static uint8_t     pcp_ring[CY_ECM_RX_QUEUE_COUNT][CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE];
+static uint32_t    pcp_ring_count[CY_ECM_RX_QUEUE_COUNT];
+static uint8_t     pcp_frame[CY_ECM_PRIORITY_COUNT][TEST_FRAME_LEN];
+static uint64_t    pcp_irq_ns;
+static uint32_t    pcp_handled;
+static uint32_t    pcp_handled_own[CY_ECM_PRIORITY_COUNT];
+static pcp_stats_t pcp_stats[CY_ECM_PRIORITY_COUNT];
+
+/* The Rx queue the type 2 screeners of the MAC steer a tagged frame to */
+static uint32_t pcp_rx_queue(uint8_t pcp)
+{
+    for(uint32_t i = 0; i < CY_ECM_PRIORITY_COUNT; i++)
+    {
+        uint32_t screener = ETH0->SCREENING_TYPE_2_REGISTER_0[i];
+
+        if(((screener & ETH_SCREENING_TYPE_2_VLAN_ENABLE) != 0u) &&
+           (((screener >> ETH_SCREENING_TYPE_2_VLAN_PRIORITY_POS) & 0x7u) == pcp))
+        {
+            return screener & 0xFu;
+        }
+    }
+    return 0;
+}
+
+/* The PDL empties the Rx rings one after the other, from queue 0 */
+static void pcp_decode_event(ETH_Type *base)
+{
+    for(uint32_t q = 0; q < CY_ECM_RX_QUEUE_COUNT; q++)
+    {
+        for(uint32_t i = 0; i < pcp_ring_count[q]; i++)
+        {
+            uint8_t      pcp = pcp_ring[q][i];
+            pcp_stats_t *stats = &pcp_stats[pcp];
+            uint32_t     delivered = test_mac.rx_count;
+            uint32_t     ahead = pcp_handled - pcp_handled_own[pcp];
+            uint64_t     ns;
+
+            eth_rx_frame_cb(base, pcp_frame[pcp], TEST_FRAME_LEN);
+            eth_rx_recycled[CY_ECM_INTERFACE_ETH0] = NULL;
+            ns = test_now_ns() - pcp_irq_ns;
+            pcp_handled++;
+            pcp_handled_own[pcp]++;
+            if(test_mac.rx_count != delivered)
+            {
+                stats->delivered++;
+                stats->total_ns += ns;
+                stats->max_ahead = (ahead > stats->max_ahead) ? ahead : stats->max_ahead;
+            }
+        }
+        pcp_ring_count[q] = 0;
+    }
+}
+
+/* Each burst fills the rings before the interrupt is served; a frame finding its ring full is dropped by the MAC */
+static void pcp_run(void)
+{
+    memset(pcp_stats, 0, sizeof(pcp_stats));
+    for(uint32_t b = 0; b < TEST_PCP_BURSTS; b++)
+    {
+        for(uint32_t i = 0; i < TEST_PCP_BURST; i++)
+        {
+            uint8_t  pcp = ((i % 4u) == 3u) ? TEST_PCP_HIGH : 0u;
+            uint32_t q = pcp_rx_queue(pcp);
+
+            pcp_stats[pcp].received++;
+            if(pcp_ring_count[q] < CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE)
+            {
+                pcp_ring[q][pcp_ring_count[q]++] = pcp;
+            }
+            else
+            {
+                pcp_stats[pcp].dropped++;
+            }
+        }
+        pcp_handled = 0;
+        memset(pcp_handled_own, 0, sizeof(pcp_handled_own));
+        pcp_irq_ns = test_now_ns();
+        Cy_ETHIF_DecodeEvent(ETH0);
+    }
+}
+
+static void pcp_report(const char *mapping)
+{
+    const uint8_t pcps[] = { 0, TEST_PCP_HIGH };
+    char name[48];
+
+    for(uint32_t i = 0; i < sizeof(pcps); i++)
+    {
+        const pcp_stats_t *stats = &pcp_stats[pcps[i]];
+
+        (void)snprintf(name, sizeof(name), "burst, PCP %u, %s", (unsigned int)pcps[i], mapping);
+        printf("BENCH %-44s %7.1f ns mean  (up to %u frames ahead, %u of %u dropped)\n", name,
+               (stats->delivered != 0u) ? (double)stats->total_ns / stats->delivered : 0.0,
+               (unsigned int)stats->max_ahead, (unsigned int)stats->dropped, (unsigned int)stats->received);
+    }
+}
+
+/* Bursts of bulk frames with high priority frames among them, through the stubbed interrupt decoding: latency from the
+ * start of the interrupt to the network stack, and drops, per priority code point */
+static void test_priority_bursts(void)
+{
+    cy_ecm_priority_map_t map;
+
+    frame_path_reset();
+    for(uint8_t pcp = 0; pcp < CY_ECM_PRIORITY_COUNT; pcp++)
+    {
+        (void)make_frame(pcp_frame[pcp], 10, pcp, ETH_ETHERTYPE_IPV4);
+    }
+    test_decode_event_hook = pcp_decode_event;
+
+    /* Default map: the high priority frames share ring 0 with the bulk, and only those before it filled are kept */
+    pcp_run();
+    TEST_CHECK_EQ(pcp_stats[0].delivered, 3u * TEST_PCP_BURSTS);
+    TEST_CHECK_EQ(pcp_stats[TEST_PCP_HIGH].delivered, TEST_PCP_BURSTS);
+    TEST_CHECK_EQ(pcp_stats[TEST_PCP_HIGH].dropped, 3u * TEST_PCP_BURSTS);
+    TEST_CHECK_EQ(pcp_stats[TEST_PCP_HIGH].max_ahead, 3);
+    pcp_report("all on queue 0");
+
+    /* High priority on queue 2: none is dropped, and each waits for the frames of ring 0 at most */
+    cy_eth_get_priority_map(CY_ECM_INTERFACE_ETH0, &map);
+    map.rx_queue[TEST_PCP_HIGH] = 2;
+    TEST_CHECK_EQ(cy_eth_set_priority_map(CY_ECM_INTERFACE_ETH0, &map), CY_RSLT_SUCCESS);
+    pcp_run();
+    TEST_CHECK_EQ(pcp_stats[0].delivered, CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE * TEST_PCP_BURSTS);
+    TEST_CHECK_EQ(pcp_stats[0].dropped, 8u * TEST_PCP_BURSTS);
+    TEST_CHECK_EQ(pcp_stats[0].max_ahead, 0);
+    TEST_CHECK_EQ(pcp_stats[TEST_PCP_HIGH].delivered, 4u * TEST_PCP_BURSTS);
+    TEST_CHECK_EQ(pcp_stats[TEST_PCP_HIGH].dropped, 0);
+    TEST_CHECK_EQ(pcp_stats[TEST_PCP_HIGH].max_ahead, CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE);
+    pcp_report("high on queue 2");
+
+    test_decode_event_hook = NULL;
+    cy_eth_priority_init(CY_ECM_INTERFACE_ETH0);
+}
+
+static void test_raw_dispatch(void)
+{
+    uint8_t frame[TEST_FRAME_LEN];
+    uint32_t length;
+    int ctx_a, ctx_b;
+
+    frame_path_reset();
+
+    /* Any VLAN: untagged and tagged frames of the EtherType */
+    TEST_CHECK_EQ(cy_eth_raw_register(CY_ECM_INTERFACE_ETH0, TEST_ETHERTYPE_RAW, CY_ECM_VLAN_ID_ANY, raw_rx_cb, &ctx_a, NULL), CY_RSLT_SUCCESS);
+    length = make_frame(frame, CY_ECM_VLAN_ID_ANY, 0, TEST_ETHERTYPE_RAW);
+    eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, frame, length);
+    TEST_CHECK_EQ(raw_rx_count, 1);
+    TEST_CHECK_EQ(raw_rx_length, TEST_FRAME_LEN);
+    TEST_CHECK(raw_rx_ctx == &ctx_a);
+    length = make_frame(frame, 7, 0, TEST_ETHERTYPE_RAW);
+    eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, frame, length);
+    TEST_CHECK_EQ(raw_rx_count, 2);
+    length = make_frame(frame, CY_ECM_VLAN_ID_ANY, 0, TEST_ETHERTYPE_RAW2);
+    eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, frame, length);
+    TEST_CHECK_EQ(raw_rx_count, 2);
+    eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, frame, CY_ECM_RAW_FRAME_MIN_LEN - 1u);
+    TEST_CHECK_EQ(raw_rx_count, 2);
+
+    /* One VLAN only */
+    TEST_CHECK_EQ(cy_eth_raw_register(CY_ECM_INTERFACE_ETH0, TEST_ETHERTYPE_RAW2, 7, raw_rx_cb, &ctx_b, NULL), CY_RSLT_SUCCESS);
+    length = make_frame(frame, 7, 0, TEST_ETHERTYPE_RAW2);
+    eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, frame, length);
+    TEST_CHECK_EQ(raw_rx_count, 3);
+    TEST_CHECK(raw_rx_ctx == &ctx_b);
+    length = make_frame(frame, 8, 0, TEST_ETHERTYPE_RAW2);
+    eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, frame, length);
+    length = make_frame(frame, CY_ECM_VLAN_ID_ANY, 0, TEST_ETHERTYPE_RAW2);
+    eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, frame, length);
+    TEST_CHECK_EQ(raw_rx_count, 3);
+    TEST_CHECK_EQ(eth_dispatch_count[CY_ECM_INTERFACE_ETH0], 2);
+
+    /* Registering the same key again replaces the handler; a NULL callback removes it */
+    TEST_CHECK_EQ(cy_eth_raw_register(CY_ECM_INTERFACE_ETH0, TEST_ETHERTYPE_RAW, CY_ECM_VLAN_ID_ANY, raw_rx_cb, &ctx_b, NULL), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(eth_dispatch_count[CY_ECM_INTERFACE_ETH0], 2);
+    length = make_frame(frame, CY_ECM_VLAN_ID_ANY, 0, TEST_ETHERTYPE_RAW);
+    eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, frame, length);
+    TEST_CHECK(raw_rx_ctx == &ctx_b);
+    TEST_CHECK_EQ(cy_eth_raw_register(CY_ECM_INTERFACE_ETH0, TEST_ETHERTYPE_RAW, CY_ECM_VLAN_ID_ANY, NULL, NULL, NULL), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(eth_dispatch_count[CY_ECM_INTERFACE_ETH0], 1);
+    eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, frame, length);
+    TEST_CHECK_EQ(raw_rx_count, 4);
+    TEST_CHECK_EQ(eth_raw_stats[CY_ECM_INTERFACE_ETH0].rx_frames, 4);
+
+    /* The handler of the VLAN of the frame takes precedence over a handler of any VLAN, in either registration order */
+    for(uint32_t order = 0; order < 2u; order++)
+    {
+        cy_eth_raw_unregister_all(CY_ECM_INTERFACE_ETH0);
+        if(order == 0u)
+        {
+            (void)cy_eth_raw_register(CY_ECM_INTERFACE_ETH0, TEST_ETHERTYPE_RAW, CY_ECM_VLAN_ID_ANY, raw_rx_cb, &ctx_a, NULL);
+        }
+        TEST_CHECK_EQ(cy_eth_raw_register(CY_ECM_INTERFACE_ETH0, TEST_ETHERTYPE_RAW, 7, raw_rx_cb, &ctx_b, NULL), CY_RSLT_SUCCESS);
+        if(order == 1u)
+        {
+            (void)cy_eth_raw_register(CY_ECM_INTERFACE_ETH0, TEST_ETHERTYPE_RAW, CY_ECM_VLAN_ID_ANY, raw_rx_cb, &ctx_a, NULL);
+        }
+        length = make_frame(frame, 7, 0, TEST_ETHERTYPE_RAW);
+        eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, frame, length);
+        TEST_CHECK(raw_rx_ctx == &ctx_b);
+        length = make_frame(frame, 8, 0, TEST_ETHERTYPE_RAW);
+        eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, frame, length);
+        TEST_CHECK(raw_rx_ctx == &ctx_a);
+        length = make_frame(frame, CY_ECM_VLAN_ID_ANY, 0, TEST_ETHERTYPE_RAW);
+        eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, frame, length);
+        TEST_CHECK(raw_rx_ctx == &ctx_a);
+    }
+
+    /* A key is looked up in CY_ECM_DISPATCH_PROBE_MAX slots only, so that many VLANs of one EtherType fill its window */
+    cy_eth_raw_unregister_all(CY_ECM_INTERFACE_ETH0);
+    for(uint16_t vlan_id = 1; vlan_id <= CY_ECM_DISPATCH_PROBE_MAX; vlan_id++)
+    {
+        TEST_CHECK_EQ(cy_eth_raw_register(CY_ECM_INTERFACE_ETH0, TEST_ETHERTYPE_RAW, vlan_id, raw_rx_cb, NULL, NULL), CY_RSLT_SUCCESS);
+    }
+    TEST_CHECK_EQ(cy_eth_raw_register(CY_ECM_INTERFACE_ETH0, TEST_ETHERTYPE_RAW, CY_ECM_DISPATCH_PROBE_MAX + 1u, raw_rx_cb, NULL, NULL),
+                  CY_RSLT_ECM_ERROR_NOMEM);
+    cy_eth_raw_unregister_all(CY_ECM_INTERFACE_ETH0);
+    TEST_CHECK_EQ(eth_dispatch_count[CY_ECM_INTERFACE_ETH0], 0);
+}
+
+static void test_raw_dispatch_bench(void)
+{
+    uint8_t hit[TEST_FRAME_LEN], miss[TEST_FRAME_LEN], tagged[TEST_FRAME_LEN];
+
+    frame_path_reset();
+    for(uint16_t i = 0; i < (CY_ECM_DISPATCH_TABLE_SIZE / 2u); i++)
+    {
+        (void)cy_eth_raw_register(CY_ECM_INTERFACE_ETH0, (uint16_t)(TEST_ETHERTYPE_RAW + i), CY_ECM_VLAN_ID_ANY, raw_rx_cb, NULL, NULL);
+    }
+    (void)make_frame(hit, CY_ECM_VLAN_ID_ANY, 0, TEST_ETHERTYPE_RAW);
+    (void)make_frame(miss, CY_ECM_VLAN_ID_ANY, 0, ETH_ETHERTYPE_IPV4);
+    (void)make_frame(tagged, 7, 0, TEST_ETHERTYPE_RAW + 3u);
+
+    TEST_BENCH("raw dispatch, hit, half-full table", eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, hit, TEST_FRAME_LEN));
+    TEST_BENCH("raw dispatch, tagged hit", eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, tagged, TEST_FRAME_LEN));
+    TEST_BENCH("raw dispatch, miss", eth_raw_dispatch(CY_ECM_INTERFACE_ETH0, miss, TEST_FRAME_LEN));
+    cy_eth_raw_unregister_all(CY_ECM_INTERFACE_ETH0);
+}
+
+/* Send path up to the stubbed Cy_ETHIF_TransmitFrame, which copies the frame into its record as a driver would into
+ * its Tx buffer; the descriptor handling of the PDL and the time on the wire are not included */
+static void test_raw_send_bench(void)
+{
+    const cy_ecm_vlan_config_t config = { .pvid = 10, .tag_tx = true };
+    uint8_t frame[TEST_FRAME_LEN], ipv4[TEST_FRAME_LEN];
+
+    frame_path_reset();
+    (void)make_frame(frame, CY_ECM_VLAN_ID_ANY, 0, TEST_ETHERTYPE_RAW);
+    (void)make_ip_frame(ipv4, CY_ECM_VLAN_ID_ANY, ETH_ETHERTYPE_IPV4, 46);
+
+    TEST_CHECK_EQ(cy_eth_raw_send(CY_ECM_INTERFACE_ETH0, frame, TEST_FRAME_LEN, 0, CY_ETH_PCP_KEEP), CY_RSLT_SUCCESS);
+    TEST_BENCH("raw send, 64-byte frame", (void)cy_eth_raw_send(CY_ECM_INTERFACE_ETH0, frame, TEST_FRAME_LEN, 0, CY_ETH_PCP_KEEP));
+    TEST_BENCH("raw send by DSCP priority, IPv4", (void)cy_eth_raw_send_priority(CY_ECM_INTERFACE_ETH0, ipv4, TEST_FRAME_LEN, CY_ECM_PRIORITY_DSCP));
+
+    cy_eth_set_vlan_config(CY_ECM_INTERFACE_ETH0, &config);
+    TEST_CHECK_EQ(cy_eth_raw_send(CY_ECM_INTERFACE_ETH0, frame, TEST_FRAME_LEN, 0, 5), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(test_mac.tx_length, TEST_FRAME_LEN + ETH_VLAN_TAG_LEN);
+    TEST_BENCH("raw send, VLAN tag inserted", (void)cy_eth_raw_send(CY_ECM_INTERFACE_ETH0, frame, TEST_FRAME_LEN, 0, 5));
+    cy_eth_vlan_init(CY_ECM_INTERFACE_ETH0);
+}
+
+/* Frames waiting in the Rx ring; each pass of the PDL handles at most one ring of descriptors */
+static uint32_t poll_pending;
+static uint8_t  poll_frame[TEST_FRAME_LEN];
+
+static uint32_t poll_ns[TEST_POLL_RUNS];
+
+static int compare_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void poll_decode_event(ETH_Type *base)
+{
+    for(uint32_t i = 0; (i < CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE) && (poll_pending > 0u); i++, poll_pending--)
+    {
+        eth_rx_frame_cb(base, poll_frame, TEST_FRAME_LEN);
+        eth_rx_recycled[CY_ECM_INTERFACE_ETH0] = NULL;
+    }
+}
+
+static void test_poll(void)
+{
+    const cy_ecm_vlan_config_t config = { .pvid = 10, .filter = true, .strip_rx = true };
+    cy_ecm_poll_stats_t stats;
+    uint64_t total = 0, start;
+
+    frame_path_reset();
+    cy_eth_set_vlan_config(CY_ECM_INTERFACE_ETH0, &config);
+    (void)cy_eth_raw_register(CY_ECM_INTERFACE_ETH0, TEST_ETHERTYPE_RAW, CY_ECM_VLAN_ID_ANY, raw_rx_cb, NULL, NULL);
+    (void)make_frame(poll_frame, CY_ECM_VLAN_ID_ANY, 0, ETH_ETHERTYPE_IPV4);
+    test_decode_event_hook = poll_decode_event;
+    memset(eth_poll_stats, 0, sizeof(eth_poll_stats));
+
+    cy_eth_set_polled_mode(CY_ECM_INTERFACE_ETH0, true);
+    TEST_CHECK(cy_eth_is_polled_mode(CY_ECM_INTERFACE_ETH0));
+    TEST_CHECK_EQ(ETH0->INT_MODERATION, 0);
+
+    /* The budget stops the passes; the rest waits for the next call */
+    poll_pending = 3u * TEST_POLL_BUDGET;
+    cy_eth_poll(CY_ECM_INTERFACE_ETH0, TEST_POLL_BUDGET);
+    TEST_CHECK_EQ(test_mac.rx_count, TEST_POLL_BUDGET);
+    TEST_CHECK_EQ(poll_pending, 2u * TEST_POLL_BUDGET);
+    cy_eth_poll(CY_ECM_INTERFACE_ETH0, 1);
+    TEST_CHECK_EQ(test_mac.rx_count, TEST_POLL_BUDGET + CY_ETH_DEFINE_TOTAL_BD_PER_RXQUEUE);
+    poll_pending = 0;
+    cy_eth_poll(CY_ECM_INTERFACE_ETH0, TEST_POLL_BUDGET);
+    cy_eth_get_poll_stats(CY_ECM_INTERFACE_ETH0, &stats);
+    TEST_CHECK_EQ(stats.poll_count, 3);
+    TEST_CHECK_EQ(stats.max_frames, TEST_POLL_BUDGET);
+    TEST_CHECK_EQ(stats.budget_exhausted_count, 2);
+    TEST_CHECK(stats.is_polled);
+
+    /* Duration of a call with a full budget: VLAN filter, raw dispatch miss, and delivery of every frame. Each call is
+     * timed on its own; the high percentiles of the host include its own interrupts and scheduling */
+    for(uint32_t i = 0; i < TEST_POLL_RUNS; i++)
+    {
+        poll_pending = TEST_POLL_BUDGET;
+        start = test_now_ns();
+        cy_eth_poll(CY_ECM_INTERFACE_ETH0, TEST_POLL_BUDGET);
+        poll_ns[i] = (uint32_t)(test_now_ns() - start);
+        total += poll_ns[i];
+    }
+    qsort(poll_ns, TEST_POLL_RUNS, sizeof(poll_ns[0]), compare_u32);
+    printf("BENCH %-44s %7.1f ns/call  (median %u, 99.9%% %u, max %u ns)\n", "poll, budget 8 frames, ECM share",
+           (double)total / TEST_POLL_RUNS, poll_ns[TEST_POLL_RUNS / 2u], poll_ns[(TEST_POLL_RUNS * 999u) / 1000u],
+           poll_ns[TEST_POLL_RUNS - 1u]);
+
+    cy_eth_set_polled_mode(CY_ECM_INTERFACE_ETH0, false);
+    TEST_CHECK(!cy_eth_is_polled_mode(CY_ECM_INTERFACE_ETH0));
+    test_decode_event_hook = NULL;
+    cy_eth_raw_unregister_all(CY_ECM_INTERFACE_ETH0);
+}
+
+/* One moderation interval with the given Rx and Tx frame counts, ended by an interrupt */
+static void moderation_interval(uint32_t rx_frames, uint32_t tx_frames)
+{
+    eth_moderation[CY_ECM_INTERFACE_ETH0].rx_frames = rx_frames;
+    eth_moderation[CY_ECM_INTERFACE_ETH0].tx_frames = tx_frames;
+    (void)cy_rtos_delay_milliseconds(CY_ECM_INT_MODERATION_INTERVAL_MS);
+    eth_moderation_update(CY_ECM_INTERFACE_ETH0);
+}
+
+static void test_moderation(void)
+{
+    cy_ecm_int_moderation_stats_t stats;
+    cy_time_t now = 0;
+
+    /* No delay up to the low rate, linear up to the maximum at the high rate, and capped above it */
+    TEST_CHECK_EQ(eth_moderation_target(0), 0);
+    TEST_CHECK_EQ(eth_moderation_target(CY_ECM_INT_MODERATION_LOW_RATE), 0);
+    TEST_CHECK_EQ(eth_moderation_target((CY_ECM_INT_MODERATION_LOW_RATE + CY_ECM_INT_MODERATION_HIGH_RATE) / 2u),
+                  CY_ECM_INT_MODERATION_MAX_DELAY_US / 2u);
+    TEST_CHECK_EQ(eth_moderation_target(CY_ECM_INT_MODERATION_HIGH_RATE), CY_ECM_INT_MODERATION_MAX_DELAY_US);
+    TEST_CHECK_EQ(eth_moderation_target(UINT32_MAX), CY_ECM_INT_MODERATION_MAX_DELAY_US);
+    for(uint32_t rate = CY_ECM_INT_MODERATION_LOW_RATE; rate < CY_ECM_INT_MODERATION_HIGH_RATE; rate += 100u)
+    {
+        TEST_CHECK(eth_moderation_target(rate) <= eth_moderation_target(rate + 100u));
+    }
+
+    /* The delay rises halfway to the target per interval and drops at once */
+    TEST_CHECK_EQ(eth_moderation_step(0, 100), 50);
+    TEST_CHECK_EQ(eth_moderation_step(50, 100), 75);
+    TEST_CHECK_EQ(eth_moderation_step(99, 100), 100);
+    TEST_CHECK_EQ(eth_moderation_step(100, 10), 10);
+
+    /* End to end: the rates of an interval set the delays, in units of 800 ns, in the moderation register */
+    frame_path_reset();
+    memset(&eth_moderation[CY_ECM_INTERFACE_ETH0], 0, sizeof(eth_moderation[0]));
+    (void)cy_rtos_get_time(&now);
+    eth_moderation[CY_ECM_INTERFACE_ETH0].interval_start = now;
+    ETH0->INT_MODERATION = 0;
+
+    moderation_interval(110, 0);                 /* 11000 frames/s: target 50 us */
+    cy_eth_get_int_moderation_stats(CY_ECM_INTERFACE_ETH0, &stats);
+    TEST_CHECK_EQ(stats.rx_frame_rate, 11000);
+    TEST_CHECK_EQ(stats.rx_delay_us, 25);
+    TEST_CHECK_EQ(stats.tx_delay_us, 0);
+    TEST_CHECK_EQ(stats.irq_rate, 100);
+    TEST_CHECK_EQ(ETH0->INT_MODERATION, (25u * 1000u) / ETH_INT_MODERATION_UNIT_NS);
+
+    moderation_interval(110, 300);               /* Tx at 30000 frames/s: target 100 us */
+    cy_eth_get_int_moderation_stats(CY_ECM_INTERFACE_ETH0, &stats);
+    TEST_CHECK_EQ(stats.rx_delay_us, 38);
+    TEST_CHECK_EQ(stats.tx_delay_us, 50);
+    TEST_CHECK_EQ(ETH0->INT_MODERATION, (((50u * 1000u) / ETH_INT_MODERATION_UNIT_NS) << ETH_INT_MODERATION_TX_POS) |
+                                        ((38u * 1000u) / ETH_INT_MODERATION_UNIT_NS));
+    TEST_CHECK_EQ(stats.adjust_count, 2);
+
+    /* An interrupt before the end of the interval changes nothing; an idle interval clears the delays */
+    eth_moderation_update(CY_ECM_INTERFACE_ETH0);
+    cy_eth_get_int_moderation_stats(CY_ECM_INTERFACE_ETH0, &stats);
+    TEST_CHECK_EQ(stats.adjust_count, 2);
+    moderation_interval(0, 0);
+    cy_eth_get_int_moderation_stats(CY_ECM_INTERFACE_ETH0, &stats);
+    TEST_CHECK_EQ(stats.rx_delay_us, 0);
+    TEST_CHECK_EQ(stats.tx_delay_us, 0);
+    TEST_CHECK_EQ(ETH0->INT_MODERATION, 0);
+    memset(&eth_moderation[CY_ECM_INTERFACE_ETH0], 0, sizeof(eth_moderation[0]));
+}
+
+/* The Tx DMA fallback halts the transmitter without waiting: each call checks TX_GO once */
+static void test_tx_halt(void)
+{
+    frame_path_reset();
+    ETH0->PBUF_TXCUTTHRU = ETH_PBUF_TXCUTTHRU_ENABLE;
+    ETH0->DMA_CONFIG = 16u;
+    ETH0->TRANSMIT_STATUS = ETH_TRANSMIT_STATUS_TX_GO;
+    ETH0->NETWORK_CONTROL = 0;
+
+    /* The halt is requested once, and the setting changes only after the frame in progress ended */
+    TEST_CHECK_EQ(cy_eth_tx_fallback(CY_ECM_INTERFACE_ETH0), CY_RSLT_ECM_BUSY);
+    TEST_CHECK_EQ(ETH0->NETWORK_CONTROL, ETH_NETWORK_CONTROL_TX_HALT);
+    TEST_CHECK(cy_eth_tx_is_halting(CY_ECM_INTERFACE_ETH0));
+    ETH0->NETWORK_CONTROL = 0;
+    TEST_CHECK_EQ(cy_eth_tx_fallback(CY_ECM_INTERFACE_ETH0), CY_RSLT_ECM_BUSY);
+    TEST_CHECK_EQ(ETH0->NETWORK_CONTROL, 0);
+    TEST_CHECK_EQ(ETH0->PBUF_TXCUTTHRU, ETH_PBUF_TXCUTTHRU_ENABLE);
+    ETH0->TRANSMIT_STATUS = 0;
+    TEST_CHECK_EQ(cy_eth_tx_fallback(CY_ECM_INTERFACE_ETH0), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(ETH0->PBUF_TXCUTTHRU, 0);
+    TEST_CHECK_EQ(ETH0->NETWORK_CONTROL, ETH_NETWORK_CONTROL_TX_START);
+    TEST_CHECK(!cy_eth_tx_is_halting(CY_ECM_INTERFACE_ETH0));
+
+    /* A frame that does not end: the transmitter is resumed after the last check, and the next call starts over */
+    ETH0->TRANSMIT_STATUS = ETH_TRANSMIT_STATUS_TX_GO;
+    ETH0->NETWORK_CONTROL = 0;
+    for(uint32_t i = 0; i < ETH_TX_HALT_MAX_CHECKS; i++)
+    {
+        TEST_CHECK_EQ(cy_eth_tx_fallback(CY_ECM_INTERFACE_ETH0), CY_RSLT_ECM_BUSY);
+        TEST_CHECK(cy_eth_tx_is_halting(CY_ECM_INTERFACE_ETH0));
+    }
+    TEST_CHECK_EQ(cy_eth_tx_fallback(CY_ECM_INTERFACE_ETH0), CY_RSLT_ECM_BUSY);
+    TEST_CHECK(!cy_eth_tx_is_halting(CY_ECM_INTERFACE_ETH0));
+    TEST_CHECK((ETH0->NETWORK_CONTROL & ETH_NETWORK_CONTROL_TX_START) != 0u);
+    TEST_CHECK_EQ(ETH0->DMA_CONFIG, 16u);
+
+    /* A halt dropped by a link change is undone by the restore, which has nothing to restore */
+    TEST_CHECK_EQ(cy_eth_tx_fallback(CY_ECM_INTERFACE_ETH0), CY_RSLT_ECM_BUSY);
+    ETH0->NETWORK_CONTROL = 0;
+    TEST_CHECK_EQ(cy_eth_tx_restore_burst(CY_ECM_INTERFACE_ETH0), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(ETH0->NETWORK_CONTROL, ETH_NETWORK_CONTROL_TX_START);
+    TEST_CHECK(!cy_eth_tx_is_halting(CY_ECM_INTERFACE_ETH0));
+
+    /* The burst reduction and its restore */
+    ETH0->TRANSMIT_STATUS = 0;
+    TEST_CHECK_EQ(cy_eth_tx_fallback(CY_ECM_INTERFACE_ETH0), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(ETH0->DMA_CONFIG, 8u);
+    TEST_CHECK_EQ(cy_eth_tx_restore_burst(CY_ECM_INTERFACE_ETH0), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(ETH0->DMA_CONFIG, 16u);
+}
+
+/* The storm control buckets: a burst, then the rate in thousandths of a frame per millisecond */
+static void test_storm_bucket(void)
+{
+    eth_token_bucket_t bucket;
+
+    memset(&bucket, 0, sizeof(bucket));
+    test_rtos_time = 1000;
+    eth_bucket_set(&bucket, 500, 3);             /* Half a frame per ms */
+    for(uint32_t i = 0; i < 3u; i++)
+    {
+        TEST_CHECK(eth_bucket_take(&bucket));
+    }
+    TEST_CHECK(!eth_bucket_take(&bucket));
+    (void)cy_rtos_delay_milliseconds(1);
+    TEST_CHECK(!eth_bucket_take(&bucket));
+    TEST_CHECK_EQ(bucket.tokens, ETH_TOKEN_UNIT / 2u);
+    (void)cy_rtos_delay_milliseconds(1);
+    TEST_CHECK(eth_bucket_take(&bucket));
+    TEST_CHECK_EQ(bucket.passed, 4);
+    TEST_CHECK_EQ(bucket.dropped, 2);
+
+    /* An idle minute refills no more than the burst */
+    (void)cy_rtos_delay_milliseconds(60000);
+    TEST_CHECK(eth_bucket_take(&bucket));
+    TEST_CHECK_EQ(bucket.tokens, 2u * ETH_TOKEN_UNIT);
+    TEST_CHECK(eth_bucket_take(&bucket));
+    TEST_CHECK(eth_bucket_take(&bucket));
+    TEST_CHECK(!eth_bucket_take(&bucket));
+
+    /* The tick counter wraps around between two frames */
+    memset(&bucket, 0, sizeof(bucket));
+    test_rtos_time = UINT32_MAX - 1u;
+    eth_bucket_set(&bucket, 500, 3);
+    for(uint32_t i = 0; i < 3u; i++)
+    {
+        TEST_CHECK(eth_bucket_take(&bucket));
+    }
+    (void)cy_rtos_delay_milliseconds(4);
+    TEST_CHECK(test_rtos_time < 4u);
+    TEST_CHECK(eth_bucket_take(&bucket));
+    TEST_CHECK(eth_bucket_take(&bucket));
+    TEST_CHECK(!eth_bucket_take(&bucket));
+
+    /* The highest rate and burst do not overflow the refill */
+    memset(&bucket, 0, sizeof(bucket));
+    eth_bucket_set(&bucket, UINT32_MAX, ETH_TOKEN_BURST_MAX);
+    bucket.tokens = 0;
+    (void)cy_rtos_delay_milliseconds(1000);
+    TEST_CHECK(eth_bucket_take(&bucket));
+    TEST_CHECK_EQ(bucket.tokens, (ETH_TOKEN_BURST_MAX - 1u) * ETH_TOKEN_UNIT);
+}
+
+/* Receives a frame to the destination address */
+static bool storm_receive(const uint8_t *destination)
+{
+    uint8_t frame[TEST_FRAME_LEN];
+
+    (void)make_frame(frame, CY_ECM_VLAN_ID_ANY, 0, ETH_ETHERTYPE_IPV4);
+    memcpy(frame, destination, CY_ECM_MAC_ADDR_LEN);
+    return receive(frame, TEST_FRAME_LEN);
+}
+
+static void test_storm_police(void)
+{
+    const uint8_t own[CY_ECM_MAC_ADDR_LEN]              = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+    const uint8_t unknown[CY_ECM_MAC_ADDR_LEN]          = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+    const uint8_t broadcast[CY_ECM_MAC_ADDR_LEN]        = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    const uint8_t multicast[CY_ECM_MAC_ADDR_LEN]        = { 0x01, 0x00, 0x5E, 0x00, 0x00, 0x01 };
+    const uint8_t almost_broadcast[CY_ECM_MAC_ADDR_LEN] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE };
+    cy_ecm_storm_stats_t stats;
+
+    frame_path_reset();
+    cy_eth_storm_init(CY_ECM_INTERFACE_ETH0, own);
+    TEST_CHECK_EQ(cy_eth_set_storm_control(CY_ECM_INTERFACE_ETH0, CY_ECM_STORM_BROADCAST, 1000, 0),
+                  CY_RSLT_MODULE_ECM_BADARG);
+    TEST_CHECK_EQ(cy_eth_set_storm_control(CY_ECM_INTERFACE_ETH0, CY_ECM_STORM_BROADCAST, 1000, ETH_TOKEN_BURST_MAX + 1u),
+                  CY_RSLT_MODULE_ECM_BADARG);
+    TEST_CHECK(!eth_storm_enabled[CY_ECM_INTERFACE_ETH0]);
+    TEST_CHECK_EQ(cy_eth_set_storm_control(CY_ECM_INTERFACE_ETH0, CY_ECM_STORM_BROADCAST, 1000, 2), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(cy_eth_set_storm_control(CY_ECM_INTERFACE_ETH0, CY_ECM_STORM_MULTICAST, 1000, 1), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(cy_eth_set_storm_control(CY_ECM_INTERFACE_ETH0, CY_ECM_STORM_UNKNOWN_UNICAST, 1000, 1), CY_RSLT_SUCCESS);
+
+    /* The clock stands still: each class passes its burst, then drops, without taking the tokens of another class */
+    TEST_CHECK(storm_receive(broadcast));
+    TEST_CHECK(storm_receive(broadcast));
+    TEST_CHECK(!storm_receive(broadcast));
+    TEST_CHECK(storm_receive(multicast));
+    TEST_CHECK(!storm_receive(multicast));
+    TEST_CHECK(!storm_receive(almost_broadcast));
+    TEST_CHECK(storm_receive(unknown));
+    TEST_CHECK(!storm_receive(unknown));
+
+    /* The frames to this interface are never limited */
+    for(uint32_t i = 0; i < 5u; i++)
+    {
+        TEST_CHECK(storm_receive(own));
+    }
+
+    cy_eth_get_storm_stats(CY_ECM_INTERFACE_ETH0, &stats);
+    TEST_CHECK_EQ(stats.passed[CY_ECM_STORM_BROADCAST], 2);
+    TEST_CHECK_EQ(stats.dropped[CY_ECM_STORM_BROADCAST], 1);
+    TEST_CHECK_EQ(stats.passed[CY_ECM_STORM_MULTICAST], 1);
+    TEST_CHECK_EQ(stats.dropped[CY_ECM_STORM_MULTICAST], 2);
+    TEST_CHECK_EQ(stats.passed[CY_ECM_STORM_UNKNOWN_UNICAST], 1);
+    TEST_CHECK_EQ(stats.dropped[CY_ECM_STORM_UNKNOWN_UNICAST], 1);
+    TEST_CHECK_EQ(stats.burst[CY_ECM_STORM_BROADCAST], 2);
+
+    /* One frame per ms at 1000 frames/s; a class without a limit passes everything */
+    (void)cy_rtos_delay_milliseconds(1);
+    TEST_CHECK(storm_receive(broadcast));
+    TEST_CHECK(!storm_receive(broadcast));
+    TEST_CHECK_EQ(cy_eth_set_storm_control(CY_ECM_INTERFACE_ETH0, CY_ECM_STORM_MULTICAST, 0, 0), CY_RSLT_SUCCESS);
+    TEST_CHECK(storm_receive(multicast));
+    TEST_CHECK(storm_receive(multicast));
+    TEST_CHECK(eth_storm_enabled[CY_ECM_INTERFACE_ETH0]);
+
+    cy_eth_storm_init(CY_ECM_INTERFACE_ETH0, own);
+    TEST_CHECK(!eth_storm_enabled[CY_ECM_INTERFACE_ETH0]);
+}
+
+/* CY_ECM_EVENT_STORM_START at the first drop of a class, and CY_ECM_EVENT_STORM_END after an interval without one */
+static void test_storm_events(void)
+{
+    ecm_storm_monitor_t sm;
+    uint32_t dropped[CY_ECM_STORM_CLASS_COUNT] = { 0 };
+    cy_ecm_storm_class_t storm_class = CY_ECM_STORM_CLASS_COUNT;
+
+    memset(&sm, 0, sizeof(sm));
+    TEST_CHECK(!cy_eth_storm_update(&sm, dropped, 0, &storm_class));
+
+    /* A storm starts without waiting for the end of the interval */
+    dropped[CY_ECM_STORM_MULTICAST] = 5;
+    TEST_CHECK(cy_eth_storm_update(&sm, dropped, 10, &storm_class));
+    TEST_CHECK_EQ(storm_class, CY_ECM_STORM_MULTICAST);
+    TEST_CHECK(sm.is_storm[CY_ECM_STORM_MULTICAST]);
+    TEST_CHECK_EQ(sm.storm_count[CY_ECM_STORM_MULTICAST], 1);
+    TEST_CHECK(!cy_eth_storm_update(&sm, dropped, 20, &storm_class));
+
+    /* Two classes starting together are reported one per call */
+    dropped[CY_ECM_STORM_BROADCAST] = 1;
+    dropped[CY_ECM_STORM_UNKNOWN_UNICAST] = 1;
+    TEST_CHECK(cy_eth_storm_update(&sm, dropped, 30, &storm_class));
+    TEST_CHECK_EQ(storm_class, CY_ECM_STORM_BROADCAST);
+    TEST_CHECK(cy_eth_storm_update(&sm, dropped, 30, &storm_class));
+    TEST_CHECK_EQ(storm_class, CY_ECM_STORM_UNKNOWN_UNICAST);
+    TEST_CHECK(!cy_eth_storm_update(&sm, dropped, 30, &storm_class));
+
+    /* An interval with drops keeps a storm; one without a drop ends it */
+    TEST_CHECK(!cy_eth_storm_update(&sm, dropped, CY_ECM_STORM_INTERVAL_MS, &storm_class));
+    dropped[CY_ECM_STORM_MULTICAST]++;
+    TEST_CHECK(!cy_eth_storm_update(&sm, dropped, (3u * CY_ECM_STORM_INTERVAL_MS) / 2u, &storm_class));
+    TEST_CHECK(cy_eth_storm_update(&sm, dropped, 2u * CY_ECM_STORM_INTERVAL_MS, &storm_class));
+    TEST_CHECK_EQ(storm_class, CY_ECM_STORM_BROADCAST);
+    TEST_CHECK(!sm.is_storm[CY_ECM_STORM_BROADCAST]);
+    TEST_CHECK(cy_eth_storm_update(&sm, dropped, 2u * CY_ECM_STORM_INTERVAL_MS, &storm_class));
+    TEST_CHECK_EQ(storm_class, CY_ECM_STORM_UNKNOWN_UNICAST);
+    TEST_CHECK(!cy_eth_storm_update(&sm, dropped, 2u * CY_ECM_STORM_INTERVAL_MS, &storm_class));
+    TEST_CHECK(sm.is_storm[CY_ECM_STORM_MULTICAST]);
+    TEST_CHECK(cy_eth_storm_update(&sm, dropped, 3u * CY_ECM_STORM_INTERVAL_MS, &storm_class));
+    TEST_CHECK_EQ(storm_class, CY_ECM_STORM_MULTICAST);
+    TEST_CHECK(!sm.is_storm[CY_ECM_STORM_MULTICAST]);
+
+    /* A new drop is a new storm */
+    dropped[CY_ECM_STORM_MULTICAST]++;
+    TEST_CHECK(cy_eth_storm_update(&sm, dropped, 3u * CY_ECM_STORM_INTERVAL_MS + 1u, &storm_class));
+    TEST_CHECK_EQ(storm_class, CY_ECM_STORM_MULTICAST);
+    TEST_CHECK_EQ(sm.storm_count[CY_ECM_STORM_MULTICAST], 2);
+    TEST_CHECK_EQ(sm.storm_count[CY_ECM_STORM_BROADCAST], 1);
+
+    /* The interval is measured across the tick counter wraparound */
+    sm.last_sample_time = UINT32_MAX - 100u;
+    TEST_CHECK(!cy_eth_storm_update(&sm, dropped, UINT32_MAX - 50u, &storm_class));
+    TEST_CHECK(!cy_eth_storm_update(&sm, dropped, CY_ECM_STORM_INTERVAL_MS - 50u, &storm_class));
+    TEST_CHECK(sm.is_storm[CY_ECM_STORM_MULTICAST]);
+    TEST_CHECK(cy_eth_storm_update(&sm, dropped, 2u * CY_ECM_STORM_INTERVAL_MS - 50u, &storm_class));
+    TEST_CHECK_EQ(storm_class, CY_ECM_STORM_MULTICAST);
+    TEST_CHECK(!sm.is_storm[CY_ECM_STORM_MULTICAST]);
+}
+
+void test_frame_path_run(void)
+{
+    test_vlan();
+    test_vlan_bench();
+    test_priority();
+    test_priority_bench();
+    test_priority_bursts();
+    test_raw_dispatch();
+    test_raw_dispatch_bench();
+    test_raw_send_bench();
+    test_poll();
+    test_moderation();
+    test_tx_halt();
+    test_storm_bucket();
+    test_storm_police();
+    test_storm_events();
+}
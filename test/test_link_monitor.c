@@ -0,0 +1,200 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file test_link_monitor.c
+* @brief Host tests of the link monitors that ECM runs once per sample interval on the MAC counters: the rolling link
+* quality score and its thresholds, and the duplex mismatch window.
+*/
+
+#include <string.h>
+
+#include "ecm_test.h"
+#include "test_stubs.h"
+#include "eth_internal.h"
+
+static ecm_link_quality_t    lq;
+static cy_eth_mac_counters_t lq_mac;
+
+/* Starts the link quality monitor as ECM does at link up */
+static void lq_start(void)
+{
+    memset(&lq, 0, sizeof(lq));
+    memset(&lq_mac, 0, sizeof(lq_mac));
+    lq.is_started = true;
+    lq.score_q8 = (100 << 8);
+    lq.info.score = 100;
+    lq.info.sqi = CY_ECM_SQI_UNKNOWN;
+}
+
+/* One sample interval with the given good frames and errors; returns true if the score crossed a threshold */
+static bool lq_sample(uint32_t frames, uint32_t fcs, uint32_t symbol, uint32_t sqi)
+{
+    cy_ecm_phy_quality_t phy;
+
+    lq_mac.frames_rx     += frames;
+    lq_mac.fcs_errors    += fcs;
+    lq_mac.symbol_errors += symbol;
+    phy.sqi = sqi;
+    phy.rx_errors = 0;
+    return cy_eth_link_quality_update(&lq, &lq_mac, &phy);
+}
+
+static void test_link_quality_score(void)
+{
+    /* An idle link leaves the score alone, and an error-free sample keeps it at 100 */
+    lq_start();
+    TEST_CHECK(!lq_sample(0, 0, 0, CY_ECM_SQI_UNKNOWN));
+    TEST_CHECK_EQ(lq.info.score, 100);
+    TEST_CHECK(!lq_sample(1000, 0, 0, CY_ECM_SQI_UNKNOWN));
+    TEST_CHECK_EQ(lq.info.score, 100);
+
+    /* 5 errors in 1000 frames is half of the 10000 ppm full scale: a sample of 50, smoothed by 1/8 */
+    lq_start();
+    TEST_CHECK(!lq_sample(995, 5, 0, CY_ECM_SQI_UNKNOWN));
+    TEST_CHECK_EQ(lq.score_q8, (100 << 8) - (50 << 8) / 8);
+    TEST_CHECK_EQ(lq.info.score, 94);
+    TEST_CHECK_EQ(lq.info.frames_rx, 995);
+    TEST_CHECK_EQ(lq.info.fcs_errors, 5);
+
+    /* The SQI of the PHY caps an error-free sample */
+    lq_start();
+    TEST_CHECK(!lq_sample(1000, 0, 0, 40));
+    TEST_CHECK_EQ(lq.info.score, 93);
+    TEST_CHECK_EQ(lq.info.sqi, 40);
+
+    /* Errors without any frame score 0 */
+    lq_start();
+    TEST_CHECK(!lq_sample(0, 0, 3, CY_ECM_SQI_UNKNOWN));
+    TEST_CHECK_EQ(lq.info.score, 88);
+
+    /* The MAC counters wrap around */
+    lq_start();
+    lq_mac.frames_rx = 0xFFFFFF00u;
+    lq.mac_prev.frames_rx = 0xFFFFFF00u;
+    TEST_CHECK(!lq_sample(0x164u, 0, 0, CY_ECM_SQI_UNKNOWN));
+    TEST_CHECK_EQ(lq.info.frames_rx, 0x164u);
+    TEST_CHECK_EQ(lq.info.score, 100);
+}
+
+static void test_link_quality_thresholds(void)
+{
+    uint32_t events = 0, prev_score;
+
+    /* Samples at 0 bring the score down 1/8 at a time: 88, 77, then 67, below the degraded threshold of 70 */
+    lq_start();
+    TEST_CHECK(!lq_sample(1000, 50, 0, CY_ECM_SQI_UNKNOWN));
+    TEST_CHECK_EQ(lq.info.score, 88);
+    TEST_CHECK(!lq_sample(1000, 50, 0, CY_ECM_SQI_UNKNOWN));
+    TEST_CHECK_EQ(lq.info.score, 77);
+    TEST_CHECK(lq_sample(1000, 50, 0, CY_ECM_SQI_UNKNOWN));
+    TEST_CHECK_EQ(lq.info.score, 67);
+    TEST_CHECK(lq.info.is_degraded);
+    TEST_CHECK_EQ(lq.info.degraded_count, 1);
+
+    /* Reported once while degraded */
+    TEST_CHECK(!lq_sample(1000, 50, 0, CY_ECM_SQI_UNKNOWN));
+    TEST_CHECK_EQ(lq.info.degraded_count, 1);
+
+    /* Clean samples restore the link only at the restored threshold of 85, not on crossing 70 again */
+    for(uint32_t i = 0; i < 30u; i++)
+    {
+        prev_score = lq.info.score;
+        if(lq_sample(1000, 0, 0, CY_ECM_SQI_UNKNOWN))
+        {
+            events++;
+            TEST_CHECK(prev_score < CY_ECM_LINK_QUALITY_RESTORED_THRESHOLD);
+            TEST_CHECK(lq.info.score >= CY_ECM_LINK_QUALITY_RESTORED_THRESHOLD);
+            TEST_CHECK(!lq.info.is_degraded);
+        }
+        else if(lq.info.is_degraded)
+        {
+            TEST_CHECK(lq.info.score < CY_ECM_LINK_QUALITY_RESTORED_THRESHOLD);
+        }
+    }
+    TEST_CHECK_EQ(events, 1);
+    TEST_CHECK_EQ(lq.info.degraded_count, 1);
+}
+
+static ecm_duplex_monitor_t dm;
+
+/* One duplex mismatch interval with the given late collisions and retry limit errors */
+static bool dm_sample(uint32_t late, uint32_t excessive)
+{
+    cy_eth_mac_counters_t mac = dm.mac_prev;
+
+    mac.late_collisions      += late;
+    mac.excessive_collisions += excessive;
+    return cy_eth_duplex_mismatch_update(&dm, &mac);
+}
+
+static void test_duplex_mismatch_window(void)
+{
+    memset(&dm, 0, sizeof(dm));
+
+    /* Below the threshold of 4 in one interval; the errors of two intervals are not added up */
+    TEST_CHECK(!dm_sample(3, 0));
+    TEST_CHECK(!dm_sample(0, 3));
+    TEST_CHECK_EQ(dm.stats.mismatch_count, 0);
+
+    /* Late collisions and retry limit errors count together */
+    TEST_CHECK(dm_sample(2, 2));
+    TEST_CHECK_EQ(dm.stats.mismatch_count, 1);
+    TEST_CHECK_EQ(dm.stats.late_collisions, 5);
+    TEST_CHECK_EQ(dm.stats.excessive_collisions, 5);
+
+    /* Reported once while the errors go on, including through a quieter interval */
+    TEST_CHECK(!dm_sample(10, 0));
+    TEST_CHECK(!dm_sample(1, 0));
+    TEST_CHECK(!dm_sample(4, 0));
+    TEST_CHECK_EQ(dm.stats.mismatch_count, 1);
+
+    /* A collision-free interval re-arms the report */
+    TEST_CHECK(!dm_sample(0, 0));
+    TEST_CHECK(dm_sample(4, 0));
+    TEST_CHECK_EQ(dm.stats.mismatch_count, 2);
+
+    /* The MAC counters wrap around */
+    TEST_CHECK(!dm_sample(0, 0));
+    dm.mac_prev.late_collisions = 0xFFFFFFFEu;
+    TEST_CHECK(dm_sample(4, 0));
+    TEST_CHECK_EQ(dm.mac_prev.late_collisions, 2);
+    TEST_CHECK_EQ(dm.stats.mismatch_count, 3);
+}
+
+void test_link_monitor_run(void)
+{
+    test_link_quality_score();
+    test_link_quality_thresholds();
+    test_duplex_mismatch_window();
+}
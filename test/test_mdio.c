@@ -0,0 +1,209 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file test_mdio.c
+* @brief Host tests of the register cache policy of cy_ecm_mdio.c and of the switch to synchronous MDIO completion in
+* polled mode, with the cost of a cached and an uncached read.
+*/
+
+#include <string.h>
+
+#include "ecm_test.h"
+#include "test_stubs.h"
+#include "eth_internal.h"
+
+#define REG_BMCR                    (0x00u)
+#define REG_BMSR                    (0x01u)
+#define REG_PHYID1                  (0x02u)
+#define REG_PHYID2                  (0x03u)
+#define REG_ANAR                    (0x04u)
+#define REG_ANER                    (0x06u)
+#define REG_VENDOR                  (0x10u)
+
+#define BMCR_RESET                  (0x8000u)
+#define BMCR_AN_ENABLE              (0x1000u)
+#define MAN_DONE                    (0x00000004UL)
+
+static uint32_t txn_done_count;
+
+static void txn_done(cy_ecm_mdio_transaction_t *txn)
+{
+    (void)txn;
+    txn_done_count++;
+}
+
+static uint16_t read_reg(uint8_t reg_addr)
+{
+    uint16_t value = 0;
+
+    TEST_CHECK_EQ(cy_ecm_mdio_read(CY_ECM_INTERFACE_ETH0, TEST_PHY_ADDR, reg_addr, &value), CY_RSLT_SUCCESS);
+    return value;
+}
+
+static void test_mdio_cache(void)
+{
+    cy_ecm_mdio_stats_t stats;
+    uint8_t phy_addr = 0xFF;
+    uint16_t value = 0;
+
+    test_stubs_reset();
+    test_phy.reg[REG_BMCR]   = BMCR_AN_ENABLE;
+    test_phy.reg[REG_BMSR]   = 0x7809;
+    test_phy.reg[REG_PHYID1] = 0x0022;
+    test_phy.reg[REG_PHYID2] = 0x1622;
+    test_phy.reg[REG_ANAR]   = 0x01E1;
+    test_phy.reg[REG_ANER]   = 0x0001;
+    TEST_CHECK_EQ(cy_eth_mdio_init(CY_ECM_INTERFACE_ETH0, ETH0), CY_RSLT_SUCCESS);
+
+    /* The first access scans the bus: PHYID1 of every address, and PHYID2 where a PHY answered */
+    TEST_CHECK_EQ(cy_ecm_mdio_find_phy(CY_ECM_INTERFACE_ETH0, &phy_addr), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(phy_addr, TEST_PHY_ADDR);
+    TEST_CHECK_EQ(test_phy.bus_reads, 33);
+
+    /* The identifiers come from the scan */
+    TEST_CHECK_EQ(read_reg(REG_PHYID1), 0x0022);
+    TEST_CHECK_EQ(read_reg(REG_PHYID2), 0x1622);
+    TEST_CHECK_EQ(test_phy.bus_reads, 33);
+
+    /* Status: read once per PHY poll cycle */
+    TEST_CHECK_EQ(read_reg(REG_BMSR), 0x7809);
+    test_phy.reg[REG_BMSR] = 0x782D;
+    TEST_CHECK_EQ(read_reg(REG_BMSR), 0x7809);
+    TEST_CHECK_EQ(test_phy.reg_reads[REG_BMSR], 1);
+    cy_eth_mdio_new_cycle(CY_ECM_INTERFACE_ETH0);
+    TEST_CHECK_EQ(read_reg(REG_BMSR), 0x782D);
+    TEST_CHECK_EQ(test_phy.reg_reads[REG_BMSR], 2);
+
+    /* Clear-on-read and vendor registers: always from the bus */
+    (void)read_reg(REG_ANER);
+    (void)read_reg(REG_ANER);
+    (void)read_reg(REG_VENDOR);
+    (void)read_reg(REG_VENDOR);
+    TEST_CHECK_EQ(test_phy.reg_reads[REG_ANER], 2);
+    TEST_CHECK_EQ(test_phy.reg_reads[REG_VENDOR], 2);
+
+    /* Configuration: kept across poll cycles, and updated by a write without reading it back */
+    TEST_CHECK_EQ(read_reg(REG_ANAR), 0x01E1);
+    cy_eth_mdio_new_cycle(CY_ECM_INTERFACE_ETH0);
+    TEST_CHECK_EQ(read_reg(REG_ANAR), 0x01E1);
+    TEST_CHECK_EQ(cy_ecm_mdio_write(CY_ECM_INTERFACE_ETH0, TEST_PHY_ADDR, REG_ANAR, 0x0061), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(read_reg(REG_ANAR), 0x0061);
+    TEST_CHECK_EQ(test_phy.reg_reads[REG_ANAR], 1);
+
+    /* A BMCR with a self-clearing bit set is not cached, and a PHY reset drops the whole cache */
+    test_phy.reg[REG_BMCR] = BMCR_RESET | BMCR_AN_ENABLE;
+    (void)read_reg(REG_BMCR);
+    (void)read_reg(REG_BMCR);
+    TEST_CHECK_EQ(test_phy.reg_reads[REG_BMCR], 2);
+    TEST_CHECK_EQ(cy_ecm_mdio_write(CY_ECM_INTERFACE_ETH0, TEST_PHY_ADDR, REG_BMCR, BMCR_RESET), CY_RSLT_SUCCESS);
+    test_phy.reg[REG_ANAR] = 0x01E1;
+    TEST_CHECK_EQ(read_reg(REG_ANAR), 0x01E1);
+    TEST_CHECK_EQ(test_phy.reg_reads[REG_ANAR], 2);
+
+    /* An access to another PHY address starts over */
+    (void)read_reg(REG_ANAR);
+    TEST_CHECK_EQ(cy_ecm_mdio_read(CY_ECM_INTERFACE_ETH0, TEST_PHY_ADDR + 1u, REG_ANAR, &value), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(value, 0xFFFF);
+    (void)read_reg(REG_ANAR);
+    TEST_CHECK_EQ(test_phy.reg_reads[REG_ANAR], 3);
+
+    TEST_CHECK_EQ(cy_ecm_mdio_read(CY_ECM_INTERFACE_ETH0, TEST_PHY_ADDR, 32, &value), CY_RSLT_MODULE_ECM_BADARG);
+    cy_eth_mdio_get_stats(CY_ECM_INTERFACE_ETH0, &stats);
+    TEST_CHECK(stats.cache_hits >= 6u);
+    TEST_CHECK_EQ(stats.reads, stats.cache_hits + (test_phy.bus_reads - 33u));
+}
+
+/* Polled mode: with the Ethernet interrupt disabled, the frames in flight are completed by polling and the later
+ * accesses are completed synchronously */
+static void test_mdio_polled(void)
+{
+    cy_ecm_mdio_transaction_t txn[2];
+    uint16_t value = 0;
+
+    memset(txn, 0, sizeof(txn));
+    txn_done_count = 0;
+    ETH0->NETWORK_STATUS = 0;
+    cy_eth_mdio_set_async(CY_ECM_INTERFACE_ETH0, true);
+
+    for(uint32_t i = 0; i < 2u; i++)
+    {
+        txn[i].phy_addr = TEST_PHY_ADDR;
+        txn[i].reg_addr = REG_VENDOR;
+        txn[i].callback = txn_done;
+        TEST_CHECK_EQ(cy_ecm_mdio_submit(CY_ECM_INTERFACE_ETH0, &txn[i]), CY_RSLT_SUCCESS);
+    }
+    TEST_CHECK_EQ(txn_done_count, 0);
+    TEST_CHECK(ETH0->PHY_MANAGEMENT != 0u);
+
+    /* The frame on the bus completes; entering polled mode drains the queue */
+    ETH0->NETWORK_STATUS = MAN_DONE;
+    cy_eth_set_polled_mode(CY_ECM_INTERFACE_ETH0, true);
+    TEST_CHECK_EQ(txn_done_count, 2);
+
+    /* The interrupt handler leaves the bus alone, and the accesses no longer wait for it */
+    test_phy.reg[REG_VENDOR] = 0x1234;
+    TEST_CHECK_EQ(cy_ecm_mdio_read(CY_ECM_INTERFACE_ETH0, TEST_PHY_ADDR, REG_VENDOR, &value), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(value, 0x1234);
+    txn[0].next = NULL;
+    TEST_CHECK_EQ(cy_ecm_mdio_submit(CY_ECM_INTERFACE_ETH0, &txn[0]), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(txn_done_count, 3);
+    TEST_CHECK_EQ(txn[0].data, 0x1234);
+
+    /* Back in interrupt mode, a transaction is queued for the interrupt again */
+    cy_eth_set_polled_mode(CY_ECM_INTERFACE_ETH0, false);
+    ETH0->NETWORK_STATUS = 0;
+    TEST_CHECK_EQ(cy_ecm_mdio_submit(CY_ECM_INTERFACE_ETH0, &txn[1]), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(txn_done_count, 3);
+    ETH0->NETWORK_STATUS = MAN_DONE;
+    cy_eth_mdio_isr(CY_ECM_INTERFACE_ETH0);
+    TEST_CHECK_EQ(txn_done_count, 4);
+    cy_eth_mdio_set_async(CY_ECM_INTERFACE_ETH0, false);
+}
+
+static void test_mdio_bench(void)
+{
+    uint16_t value;
+
+    (void)read_reg(REG_ANAR);
+    TEST_BENCH("mdio read, cache hit", (void)cy_ecm_mdio_read(CY_ECM_INTERFACE_ETH0, TEST_PHY_ADDR, REG_ANAR, &value));
+    TEST_BENCH("mdio read, uncached (bus simulated)", (void)cy_ecm_mdio_read(CY_ECM_INTERFACE_ETH0, TEST_PHY_ADDR, REG_VENDOR, &value));
+}
+
+void test_mdio_run(void)
+{
+    test_mdio_cache();
+    test_mdio_polled();
+    test_mdio_bench();
+    cy_eth_mdio_deinit(CY_ECM_INTERFACE_ETH0);
+}
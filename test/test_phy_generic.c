@@ -0,0 +1,165 @@
+/*
+ * Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+*/
+
+/**
+* @file test_phy_generic.c
+* @brief Host tests of the generic PHY driver against the simulated PHY: resolution of the negotiated mode, forced and
+* autonegotiated configuration, and the identification of the PHY before a vendor-specific phy_init. The source is
+* included so that its static functions can be reached.
+*/
+
+#include "cy_ecm_phy_generic.c"
+
+#include "ecm_test.h"
+#include "test_stubs.h"
+#include "eth_internal.h"
+
+/* 100FD, 100HD, and 10FD, without 10HD; extended status present */
+#define TEST_BMSR                   (0x7109u)
+#define TEST_ESTATUS_1000FD         (0x2000u)
+#define TEST_ANAR_PAUSE             (0x0C00u)
+
+static uint32_t vendor_init_count;
+
+static cy_rslt_t vendor_init(uint8_t eth_idx, ETH_Type *reg_base)
+{
+    (void)eth_idx;
+    (void)reg_base;
+    vendor_init_count++;
+    return CY_RSLT_SUCCESS;
+}
+
+static void resolve(uint16_t anar_common, uint16_t gbcr_common, uint32_t exp_duplex, uint32_t exp_speed)
+{
+    uint32_t duplex = 0xFF, speed = 0xFF;
+
+    phy_generic_resolve(anar_common, gbcr_common, &duplex, &speed);
+    TEST_CHECK_EQ(duplex, exp_duplex);
+    TEST_CHECK_EQ(speed, exp_speed);
+}
+
+static void test_phy_generic_resolve(void)
+{
+    resolve(PHY_ANAR_ABILITY_MSK, PHY_GBCR_ABILITY_MSK, CY_ECM_DUPLEX_FULL, CY_ECM_PHY_SPEED_1000M);
+    resolve(PHY_ANAR_ABILITY_MSK, PHY_GBCR_1000HD, CY_ECM_DUPLEX_HALF, CY_ECM_PHY_SPEED_1000M);
+    resolve(PHY_ANAR_ABILITY_MSK, 0, CY_ECM_DUPLEX_FULL, CY_ECM_PHY_SPEED_100M);
+    resolve(PHY_ANAR_100HD | PHY_ANAR_10FD | PHY_ANAR_10HD, 0, CY_ECM_DUPLEX_HALF, CY_ECM_PHY_SPEED_100M);
+    resolve(PHY_ANAR_10FD | PHY_ANAR_10HD, 0, CY_ECM_DUPLEX_FULL, CY_ECM_PHY_SPEED_10M);
+    resolve(PHY_ANAR_10HD, 0, CY_ECM_DUPLEX_HALF, CY_ECM_PHY_SPEED_10M);
+    /* Nothing in common: the lowest mode, as the parallel detection fallback of IEEE 802.3 annex 28B */
+    resolve(0, 0, CY_ECM_DUPLEX_HALF, CY_ECM_PHY_SPEED_10M);
+}
+
+static void test_phy_generic_identify_first(void)
+{
+    cy_ecm_phy_callbacks_t overrides;
+    cy_ecm_phy_generic_config_t config;
+
+    memset(&overrides, 0, sizeof(overrides));
+    overrides.phy_init = vendor_init;
+    config.phy_addr = TEST_PHY_ADDR + 1u;
+    config.overrides = &overrides;
+    vendor_init_count = 0;
+
+    /* No PHY answers at the configured address: the identification error is returned, and the vendor init is not run */
+    TEST_CHECK_EQ(cy_ecm_phy_generic_set_config(CY_ECM_INTERFACE_ETH0, &config), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(phy_generic_init(CY_ECM_INTERFACE_ETH0, ETH0), CY_RSLT_ECM_ERROR);
+    TEST_CHECK_EQ(vendor_init_count, 0);
+
+    config.phy_addr = TEST_PHY_ADDR;
+    TEST_CHECK_EQ(cy_ecm_phy_generic_set_config(CY_ECM_INTERFACE_ETH0, &config), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(phy_generic_init(CY_ECM_INTERFACE_ETH0, ETH0), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(vendor_init_count, 1);
+}
+
+static void test_phy_generic_configure(void)
+{
+    cy_ecm_phy_generic_config_t config;
+    uint32_t writes;
+
+    config.phy_addr = TEST_PHY_ADDR;
+    config.overrides = NULL;
+    TEST_CHECK_EQ(cy_ecm_phy_generic_set_config(CY_ECM_INTERFACE_ETH0, &config), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(phy_generic_init(CY_ECM_INTERFACE_ETH0, ETH0), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(phy_generic_ctx[0].gbcr_caps, PHY_GBCR_1000FD);
+
+    /* Forced 10/100 modes are written to BMCR without autonegotiation */
+    TEST_CHECK_EQ(phy_generic_configure(0, CY_ECM_DUPLEX_FULL, CY_ECM_PHY_SPEED_100M), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(test_phy.reg[PHY_REG_BMCR], PHY_BMCR_SPEED_LSB | PHY_BMCR_FULL_DUPLEX);
+    TEST_CHECK_EQ(phy_generic_configure(0, CY_ECM_DUPLEX_HALF, CY_ECM_PHY_SPEED_100M), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(test_phy.reg[PHY_REG_BMCR], PHY_BMCR_SPEED_LSB);
+    TEST_CHECK_EQ(phy_generic_configure(0, CY_ECM_DUPLEX_FULL, CY_ECM_PHY_SPEED_10M), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(test_phy.reg[PHY_REG_BMCR], PHY_BMCR_FULL_DUPLEX);
+
+    /* A forced mode that the PHY does not support is rejected without touching the PHY */
+    writes = test_phy.bus_writes;
+    TEST_CHECK_EQ(phy_generic_configure(0, CY_ECM_DUPLEX_HALF, CY_ECM_PHY_SPEED_10M), CY_RSLT_MODULE_ECM_BADARG);
+    TEST_CHECK_EQ(phy_generic_configure(0, CY_ECM_DUPLEX_HALF, CY_ECM_PHY_SPEED_1000M), CY_RSLT_MODULE_ECM_BADARG);
+    TEST_CHECK_EQ(test_phy.bus_writes, writes);
+
+    /* 1000 Mbps full duplex is negotiated with only that mode advertised; the pause bits are kept */
+    TEST_CHECK_EQ(phy_generic_configure(0, CY_ECM_DUPLEX_FULL, CY_ECM_PHY_SPEED_1000M), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(test_phy.reg[PHY_REG_ANAR], TEST_ANAR_PAUSE | PHY_ANAR_SELECTOR_8023);
+    TEST_CHECK_EQ(test_phy.reg[PHY_REG_GBCR], PHY_GBCR_1000FD);
+    TEST_CHECK_EQ(test_phy.reg[PHY_REG_BMCR], PHY_BMCR_AN_ENABLE | PHY_BMCR_RESTART_AN);
+    TEST_CHECK_EQ(test_phy.reg[PHY_REG_BMCR] & PHY_BMCR_SPEED_MSB, 0);
+
+    /* Full autonegotiation advertises every ability of the PHY */
+    TEST_CHECK_EQ(phy_generic_configure(0, CY_ECM_DUPLEX_AUTO, CY_ECM_PHY_SPEED_AUTO), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(test_phy.reg[PHY_REG_ANAR], TEST_ANAR_PAUSE | PHY_ANAR_100FD | PHY_ANAR_100HD | PHY_ANAR_10FD | PHY_ANAR_SELECTOR_8023);
+    TEST_CHECK_EQ(test_phy.reg[PHY_REG_GBCR], PHY_GBCR_1000FD);
+
+    /* The same advertisement again does not restart the negotiation */
+    writes = test_phy.bus_writes;
+    TEST_CHECK_EQ(phy_generic_configure(0, CY_ECM_DUPLEX_AUTO, CY_ECM_PHY_SPEED_AUTO), CY_RSLT_SUCCESS);
+    TEST_CHECK_EQ(test_phy.bus_writes, writes);
+}
+
+void test_phy_generic_run(void)
+{
+    test_stubs_reset();
+    test_phy.reg[PHY_REG_BMCR]    = PHY_BMCR_AN_ENABLE;
+    test_phy.reg[PHY_REG_BMSR]    = TEST_BMSR;
+    test_phy.reg[PHY_REG_PHYID1]  = 0x0022;
+    test_phy.reg[PHY_REG_PHYID2]  = 0x1622;
+    test_phy.reg[PHY_REG_ANAR]    = TEST_ANAR_PAUSE | PHY_ANAR_SELECTOR_8023;
+    test_phy.reg[PHY_REG_ESTATUS] = TEST_ESTATUS_1000FD;
+    TEST_CHECK_EQ(cy_eth_mdio_init(CY_ECM_INTERFACE_ETH0, ETH0), CY_RSLT_SUCCESS);
+
+    test_phy_generic_resolve();
+    test_phy_generic_identify_first();
+    test_phy_generic_configure();
+
+    cy_eth_mdio_deinit(CY_ECM_INTERFACE_ETH0);
+    memset(phy_generic_ctx, 0, sizeof(phy_generic_ctx));
+}